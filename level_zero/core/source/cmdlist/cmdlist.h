@@ -147,6 +147,8 @@ struct CommandList : _ze_command_list_handle_t {
                                                     uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) = 0;
 
     virtual void *asMutable() { return nullptr; };
+    // returns ZE_RESULT_NOT_READY when pending batched submission is kept, because owning thread is appending or batch has not expired yet
+    virtual ze_result_t tryFlushBatchedSubmission(bool onlyExpired) { return ZE_RESULT_SUCCESS; };
 
     virtual ze_result_t reserveSpace(size_t size, void **ptr) = 0;
     virtual ze_result_t reset() = 0;
@@ -393,6 +395,7 @@ struct CommandList : _ze_command_list_handle_t {
     uint32_t defaultMocsIndex = 0;
 
     bool isFlushTaskSubmissionEnabled = false;
+    bool isSubmissionBatchingEnabled = false;
     bool isSyncModeQueue = false;
     bool isTbxMode = false;
     bool commandListSLMEnabled = false;
@@ -12,6 +12,8 @@
 #include "level_zero/core/source/cmdlist/cmdlist_hw.h"
 
 #include <atomic>
+#include <chrono>
+#include <mutex>
 
 namespace NEO {
 struct SvmAllocationData;
@@ -24,6 +26,8 @@ namespace L0 {
 struct EventPool;
 struct Event;
 inline constexpr size_t maxImmediateCommandSize = 4 * MemoryConstants::kiloByte;
+inline constexpr size_t defaultBatchedSubmissionSizeThreshold = 16 * MemoryConstants::kiloByte;
+inline constexpr int64_t defaultBatchedSubmissionTimeThresholdUs = 100;
 
 struct CpuMemCopyInfo {
     void *const dstPtr;
@@ -43,6 +47,8 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     using BaseClass::executeCommandListImmediate;
     using BaseClass::isCopyOnly;
 
+    ~CommandListCoreFamilyImmediate() override;
+
     ze_result_t appendLaunchKernel(ze_kernel_handle_t kernelHandle,
                                    const ze_group_count_t *threadGroupDimensions,
                                    ze_event_handle_t hEvent, uint32_t numWaitEvents,
@@ -147,10 +153,17 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     NEO::CompletionStamp flushRegularTask(NEO::LinearStream &cmdStreamTask, size_t taskStartOffset, bool hasStallingCmds, bool hasRelaxedOrderingDependencies);
     NEO::CompletionStamp flushBcsTask(NEO::LinearStream &cmdStreamTask, size_t taskStartOffset, bool hasStallingCmds, bool hasRelaxedOrderingDependencies, NEO::CommandStreamReceiver *csr);
 
-    void checkAvailableSpace(uint32_t numEvents, bool hasRelaxedOrderingDependencies);
+    ze_result_t checkAvailableSpace(uint32_t numEvents, bool hasRelaxedOrderingDependencies);
     void updateDispatchFlagsWithRequiredStreamState(NEO::DispatchFlags &dispatchFlags);
 
     ze_result_t flushImmediate(ze_result_t inputRet, bool performMigration, bool hasStallingCmds, bool hasRelaxedOrderingDependencies, ze_event_handle_t hSignalEvent);
+    ze_result_t flushBatchedSubmission();
+    ze_result_t tryFlushBatchedSubmission(bool onlyExpired) override;
+    bool isBatchedSubmissionAllowed(Kernel &kernel, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, const CmdListKernelLaunchParams &launchParams, bool relaxedOrderingDispatch) const;
+    bool isBatchedSubmissionCompatible(Kernel &kernel, const ze_group_count_t *threadGroupDimensions, bool isCooperative);
+    bool isBatchedSubmissionThresholdReached() const;
+
+    ze_result_t destroy() override;
 
     void createLogicalStateHelper() override {}
     NEO::LogicalStateHelper *getLogicalStateHelper() const override;
@@ -166,11 +179,17 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     TransferType getTransferType(NEO::SvmAllocationData *dstAlloc, NEO::SvmAllocationData *srcAlloc);
     size_t getTransferThreshold(TransferType transferType);
     bool isBarrierRequired();
+    uint32_t getCopyRegionSplitDimension(const ze_copy_region_t *region, size_t engineCount);
 
   protected:
     void printKernelsPrintfOutput(bool hangDetected);
     MOCKABLE_VIRTUAL void checkAssert();
     std::atomic<bool> dependenciesPresent{false};
+
+    std::recursive_mutex batchedSubmissionMutex;
+    std::chrono::steady_clock::time_point batchedSubmissionStartTime;
+    bool batchedSubmissionPending = false;
+    bool appendJoinsBatchedSubmission = false;
 };
 
 template <PRODUCT_FAMILY gfxProductFamily>
@@ -14,12 +14,14 @@
 #include "shared/source/command_stream/wait_status.h"
 #include "shared/source/debugger/debugger_l0.h"
 #include "shared/source/direct_submission/relaxed_ordering_helper.h"
+#include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/helpers/bindless_heaps_helper.h"
 #include "shared/source/helpers/completion_stamp.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
+#include "shared/source/utilities/cpu_copy.h"
 
 #include "level_zero/core/source/cmdlist/cmdlist_hw_immediate.h"
 #include "level_zero/core/source/cmdqueue/cmdqueue_hw.h"
@@ -30,18 +32,36 @@
 
 namespace L0 {
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+CommandListCoreFamilyImmediate<gfxCoreFamily>::~CommandListCoreFamilyImmediate() {
+    if (this->isSubmissionBatchingEnabled && this->device) {
+        static_cast<DriverHandleImp *>(this->device->getDriverHandle())->unregisterBatchedSubmissionCmdList(this);
+    }
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 NEO::LogicalStateHelper *CommandListCoreFamilyImmediate<gfxCoreFamily>::getLogicalStateHelper() const {
     return this->csr->getLogicalStateHelper();
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
-void CommandListCoreFamilyImmediate<gfxCoreFamily>::checkAvailableSpace(uint32_t numEvents, bool hasRelaxedOrderingDependencies) {
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::checkAvailableSpace(uint32_t numEvents, bool hasRelaxedOrderingDependencies) {
+    if (!this->appendJoinsBatchedSubmission) {
+        auto ret = this->flushBatchedSubmission();
+        if (ret != ZE_RESULT_SUCCESS) {
+            return ret;
+        }
+    }
+
     this->commandContainer.fillReusableAllocationLists();
 
     /* Command container might has two command buffers. If it has, one is in local memory, because relaxed ordering requires that and one in system for copying it into ring buffer.
        If relaxed ordering is needed in given dispatch and current command stream is in system memory, swap of command streams is required to ensure local memory. Same in the opposite scenario. */
     if (hasRelaxedOrderingDependencies == NEO::MemoryPoolHelper::isSystemMemoryPool(this->commandContainer.getCommandStream()->getGraphicsAllocation()->getMemoryPool())) {
+        auto ret = this->flushBatchedSubmission();
+        if (ret != ZE_RESULT_SUCCESS) {
+            return ret;
+        }
         if (this->commandContainer.swapStreams()) {
             this->cmdListCurrentStartOffset = this->commandContainer.getCommandStream()->getUsed();
         }
@@ -49,6 +69,11 @@ void CommandListCoreFamilyImmediate<gfxCoreFamily>::checkAvailableSpace(uint32_t
 
     size_t semaphoreSize = NEO::EncodeSemaphore<GfxFamily>::getSizeMiSemaphoreWait() * numEvents;
     if (this->commandContainer.getCommandStream()->getAvailableSpace() < maxImmediateCommandSize + semaphoreSize) {
+        auto ret = this->flushBatchedSubmission();
+        if (ret != ZE_RESULT_SUCCESS) {
+            return ret;
+        }
+
         bool requireSystemMemoryCommandBuffer = !hasRelaxedOrderingDependencies;
 
         auto alloc = this->commandContainer.reuseExistingCmdBuffer(requireSystemMemoryCommandBuffer);
@@ -61,6 +86,7 @@ void CommandListCoreFamilyImmediate<gfxCoreFamily>::checkAvailableSpace(uint32_t
         this->commandContainer.setCmdBuffer(alloc);
         this->cmdListCurrentStartOffset = 0;
     }
+    return ZE_RESULT_SUCCESS;
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
@@ -329,8 +355,30 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernel(
 
     relaxedOrderingDispatch = NEO::RelaxedOrderingHelper::isRelaxedOrderingDispatchAllowed(*this->csr, numWaitEvents);
 
+    auto driverHandle = static_cast<DriverHandleImp *>(this->device->getDriverHandle());
+    std::unique_lock<std::recursive_mutex> batchedSubmissionLock(this->batchedSubmissionMutex, std::defer_lock);
+    if (this->isSubmissionBatchingEnabled && isBatchedSubmissionAllowed(*Kernel::fromHandle(kernelHandle), hSignalEvent, numWaitEvents, launchParams, relaxedOrderingDispatch)) {
+        // batches of other idle command lists are submitted once expired, registry must not be accessed with list lock held
+        auto ret = driverHandle->flushBatchedSubmissions(true);
+        if (ret != ZE_RESULT_SUCCESS) {
+            return ret;
+        }
+        batchedSubmissionLock.lock();
+        if (!isBatchedSubmissionCompatible(*Kernel::fromHandle(kernelHandle), threadGroupDimensions, launchParams.isCooperative)) {
+            ret = this->flushBatchedSubmission();
+            if (ret != ZE_RESULT_SUCCESS) {
+                return ret;
+            }
+        }
+        this->appendJoinsBatchedSubmission = true;
+    }
+
     if (this->isFlushTaskSubmissionEnabled) {
-        checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch);
+        auto ret = checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch);
+        if (ret != ZE_RESULT_SUCCESS) {
+            this->appendJoinsBatchedSubmission = false;
+            return ret;
+        }
     }
     bool hostWait = waitForEventsFromHost();
     if (hostWait || this->eventWaitlistSyncRequired()) {
@@ -341,10 +389,18 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernel(
         }
     }
 
+    bool startsBatchedSubmission = this->appendJoinsBatchedSubmission && !this->batchedSubmissionPending;
+
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernel(kernelHandle, threadGroupDimensions,
                                                                         hSignalEvent, numWaitEvents, phWaitEvents,
                                                                         launchParams, relaxedOrderingDispatch);
-    return flushImmediate(ret, true, false, relaxedOrderingDispatch, hSignalEvent);
+    ret = flushImmediate(ret, true, false, relaxedOrderingDispatch, hSignalEvent);
+
+    if (startsBatchedSubmission && this->batchedSubmissionPending) {
+        batchedSubmissionLock.unlock();
+        driverHandle->registerBatchedSubmissionCmdList(this);
+    }
+    return ret;
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
@@ -354,7 +410,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernelInd
     relaxedOrderingDispatch = NEO::RelaxedOrderingHelper::isRelaxedOrderingDispatchAllowed(*this->csr, numWaitEvents);
 
     if (this->isFlushTaskSubmissionEnabled) {
-        checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch);
+        auto ret = checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch);
+        if (ret != ZE_RESULT_SUCCESS) {
+            return ret;
+        }
         checkWaitEventsState(numWaitEvents, phWaitEvents);
     }
 
@@ -371,7 +430,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendBarrier(
     ze_result_t ret = ZE_RESULT_SUCCESS;
 
     if (this->isFlushTaskSubmissionEnabled) {
-        checkAvailableSpace(numWaitEvents, false);
+        ret = checkAvailableSpace(numWaitEvents, false);
+        if (ret != ZE_RESULT_SUCCESS) {
+            return ret;
+        }
         checkWaitEventsState(numWaitEvents, phWaitEvents);
     }
     ret = CommandListCoreFamily<gfxCoreFamily>::appendBarrier(hSignalEvent, numWaitEvents, phWaitEvents);
@@ -391,7 +453,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopy(
     relaxedOrderingDispatch = NEO::RelaxedOrderingHelper::isRelaxedOrderingDispatchAllowed(*this->csr, numWaitEvents);
 
     if (this->isFlushTaskSubmissionEnabled) {
-        checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch);
+        auto ret = checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch);
+        if (ret != ZE_RESULT_SUCCESS) {
+            return ret;
+        }
         checkWaitEventsState(numWaitEvents, phWaitEvents);
     }
 
@@ -410,7 +475,7 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopy(
     auto isSplitNeeded = this->isAppendSplitNeeded(dstptr, srcptr, size, direction);
     if (isSplitNeeded) {
         relaxedOrderingDispatch = NEO::RelaxedOrderingHelper::isRelaxedOrderingDispatchAllowed(*this->csr, 1); // split generates more than 1 event
-        ret = static_cast<DeviceImp *>(this->device)->bcsSplit.appendSplitCall<gfxCoreFamily, void *, const void *>(this, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents, true, relaxedOrderingDispatch, direction, [&](void *dstptrParam, const void *srcptrParam, size_t sizeParam, ze_event_handle_t hSignalEventParam) {
+        ret = static_cast<DeviceImp *>(this->device)->bcsSplit.appendSplitCall<gfxCoreFamily, void *, const void *>(this, dstptr, srcptr, size, 1u, hSignalEvent, numWaitEvents, phWaitEvents, true, relaxedOrderingDispatch, direction, [&](void *dstptrParam, const void *srcptrParam, size_t sizeParam, ze_event_handle_t hSignalEventParam) {
             return CommandListCoreFamily<gfxCoreFamily>::appendMemoryCopy(dstptrParam, srcptrParam, sizeParam, hSignalEventParam, 0u, nullptr, relaxedOrderingDispatch);
         });
     } else {
@@ -436,7 +501,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopyRegio
     relaxedOrderingDispatch = NEO::RelaxedOrderingHelper::isRelaxedOrderingDispatchAllowed(*this->csr, numWaitEvents);
 
     if (this->isFlushTaskSubmissionEnabled) {
-        checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch);
+        auto ret = checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch);
+        if (ret != ZE_RESULT_SUCCESS) {
+            return ret;
+        }
         checkWaitEventsState(numWaitEvents, phWaitEvents);
     }
 
@@ -446,15 +514,40 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopyRegio
     auto isSplitNeeded = this->isAppendSplitNeeded(dstPtr, srcPtr, this->getTotalSizeForCopyRegion(dstRegion, dstPitch, dstSlicePitch), direction);
     if (isSplitNeeded) {
         relaxedOrderingDispatch = NEO::RelaxedOrderingHelper::isRelaxedOrderingDispatchAllowed(*this->csr, 1); // split generates more than 1 event
-        ret = static_cast<DeviceImp *>(this->device)->bcsSplit.appendSplitCall<gfxCoreFamily, uint32_t, uint32_t>(this, dstRegion->originX, srcRegion->originX, dstRegion->width, hSignalEvent, numWaitEvents, phWaitEvents, true, relaxedOrderingDispatch, direction, [&](uint32_t dstOriginXParam, uint32_t srcOriginXParam, size_t sizeParam, ze_event_handle_t hSignalEventParam) {
+        auto regionSize = static_cast<size_t>(dstRegion->width) * dstRegion->height * dstRegion->depth;
+        auto engineCount = static_cast<DeviceImp *>(this->device)->bcsSplit.getEngineCountForSplit(direction, regionSize);
+        auto splitDimension = this->getCopyRegionSplitDimension(dstRegion, engineCount);
+        uint32_t extents[3] = {dstRegion->width, dstRegion->height, dstRegion->depth};
+        uint32_t dstOrigins[3] = {dstRegion->originX, dstRegion->originY, dstRegion->originZ};
+        uint32_t srcOrigins[3] = {srcRegion->originX, srcRegion->originY, srcRegion->originZ};
+        size_t bytesPerUnit = 1u;
+        for (uint32_t i = 0; i < 3; i++) {
+            if (i != splitDimension) {
+                bytesPerUnit *= extents[i];
+            }
+        }
+
+        ret = static_cast<DeviceImp *>(this->device)->bcsSplit.appendSplitCall<gfxCoreFamily, uint32_t, uint32_t>(this, dstOrigins[splitDimension], srcOrigins[splitDimension], extents[splitDimension], bytesPerUnit, hSignalEvent, numWaitEvents, phWaitEvents, true, relaxedOrderingDispatch, direction, [&](uint32_t dstOriginParam, uint32_t srcOriginParam, size_t sizeParam, ze_event_handle_t hSignalEventParam) {
             ze_copy_region_t dstRegionLocal = {};
             ze_copy_region_t srcRegionLocal = {};
             memcpy(&dstRegionLocal, dstRegion, sizeof(ze_copy_region_t));
             memcpy(&srcRegionLocal, srcRegion, sizeof(ze_copy_region_t));
-            dstRegionLocal.originX = dstOriginXParam;
-            dstRegionLocal.width = static_cast<uint32_t>(sizeParam);
-            srcRegionLocal.originX = srcOriginXParam;
-            srcRegionLocal.width = static_cast<uint32_t>(sizeParam);
+            if (splitDimension == 2u) {
+                dstRegionLocal.originZ = dstOriginParam;
+                dstRegionLocal.depth = static_cast<uint32_t>(sizeParam);
+                srcRegionLocal.originZ = srcOriginParam;
+                srcRegionLocal.depth = static_cast<uint32_t>(sizeParam);
+            } else if (splitDimension == 1u) {
+                dstRegionLocal.originY = dstOriginParam;
+                dstRegionLocal.height = static_cast<uint32_t>(sizeParam);
+                srcRegionLocal.originY = srcOriginParam;
+                srcRegionLocal.height = static_cast<uint32_t>(sizeParam);
+            } else {
+                dstRegionLocal.originX = dstOriginParam;
+                dstRegionLocal.width = static_cast<uint32_t>(sizeParam);
+                srcRegionLocal.originX = srcOriginParam;
+                srcRegionLocal.width = static_cast<uint32_t>(sizeParam);
+            }
             return CommandListCoreFamily<gfxCoreFamily>::appendMemoryCopyRegion(dstPtr, &dstRegionLocal, dstPitch, dstSlicePitch,
                                                                                 srcPtr, &srcRegionLocal, srcPitch, srcSlicePitch,
                                                                                 hSignalEventParam, 0u, nullptr, relaxedOrderingDispatch);
@@ -477,11 +570,30 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryFill(void
     relaxedOrderingDispatch = NEO::RelaxedOrderingHelper::isRelaxedOrderingDispatchAllowed(*this->csr, numWaitEvents);
 
     if (this->isFlushTaskSubmissionEnabled) {
-        checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch);
+        auto ret = checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch);
+        if (ret != ZE_RESULT_SUCCESS) {
+            return ret;
+        }
         checkWaitEventsState(numWaitEvents, phWaitEvents);
     }
 
-    auto ret = CommandListCoreFamily<gfxCoreFamily>::appendMemoryFill(ptr, pattern, patternSize, size, hSignalEvent, numWaitEvents, phWaitEvents, relaxedOrderingDispatch);
+    ze_result_t ret;
+
+    NEO::SvmAllocationData *dstAllocData = nullptr;
+    NEO::TransferDirection direction;
+    auto isSplitNeeded = this->isCopyOnly() &&
+                         this->device->getDriverHandle()->findAllocationDataForRange(ptr, size, &dstAllocData) &&
+                         this->isAppendSplitNeeded(dstAllocData->gpuAllocations.getDefaultGraphicsAllocation()->getMemoryPool(), NEO::MemoryPool::System4KBPages, size, direction);
+    if (isSplitNeeded) {
+        // fill has no host source, so it is not limited to engines dedicated to host transfers
+        direction = NEO::TransferDirection::LocalToLocal;
+        relaxedOrderingDispatch = NEO::RelaxedOrderingHelper::isRelaxedOrderingDispatchAllowed(*this->csr, 1); // split generates more than 1 event
+        ret = static_cast<DeviceImp *>(this->device)->bcsSplit.appendSplitCall<gfxCoreFamily, void *, size_t>(this, ptr, 0u, size, 1u, hSignalEvent, numWaitEvents, phWaitEvents, true, relaxedOrderingDispatch, direction, [&](void *ptrParam, size_t patternOffsetParam, size_t sizeParam, ze_event_handle_t hSignalEventParam) {
+            return CommandListCoreFamily<gfxCoreFamily>::appendMemoryFill(ptrParam, pattern, patternSize, sizeParam, hSignalEventParam, 0u, nullptr, relaxedOrderingDispatch);
+        });
+    } else {
+        ret = CommandListCoreFamily<gfxCoreFamily>::appendMemoryFill(ptr, pattern, patternSize, size, hSignalEvent, numWaitEvents, phWaitEvents, relaxedOrderingDispatch);
+    }
 
     return flushImmediate(ret, true, false, relaxedOrderingDispatch, hSignalEvent);
 }
@@ -492,7 +604,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendSignalEvent(ze_
     ze_result_t ret = ZE_RESULT_SUCCESS;
 
     if (this->isFlushTaskSubmissionEnabled) {
-        checkAvailableSpace(0, false);
+        ret = checkAvailableSpace(0, false);
+        if (ret != ZE_RESULT_SUCCESS) {
+            return ret;
+        }
     }
     ret = CommandListCoreFamily<gfxCoreFamily>::appendSignalEvent(hSignalEvent);
     return flushImmediate(ret, true, true, false, hSignalEvent);
@@ -504,7 +619,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendEventReset(ze_e
     ze_result_t ret = ZE_RESULT_SUCCESS;
 
     if (this->isFlushTaskSubmissionEnabled) {
-        checkAvailableSpace(0, false);
+        ret = checkAvailableSpace(0, false);
+        if (ret != ZE_RESULT_SUCCESS) {
+            return ret;
+        }
     }
     ret = CommandListCoreFamily<gfxCoreFamily>::appendEventReset(hSignalEvent);
     return flushImmediate(ret, true, true, false, hSignalEvent);
@@ -516,7 +634,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendPageFaultCopy(N
                                                                                size_t size, bool flushHost) {
 
     if (this->isFlushTaskSubmissionEnabled) {
-        checkAvailableSpace(0, false);
+        auto ret = checkAvailableSpace(0, false);
+        if (ret != ZE_RESULT_SUCCESS) {
+            return ret;
+        }
     }
 
     ze_result_t ret;
@@ -530,7 +651,7 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendPageFaultCopy(N
         relaxedOrdering = NEO::RelaxedOrderingHelper::isRelaxedOrderingDispatchAllowed(*this->csr, 1); // split generates more than 1 event
         uintptr_t dstAddress = static_cast<uintptr_t>(dstAllocation->getGpuAddress());
         uintptr_t srcAddress = static_cast<uintptr_t>(srcAllocation->getGpuAddress());
-        ret = static_cast<DeviceImp *>(this->device)->bcsSplit.appendSplitCall<gfxCoreFamily, uintptr_t, uintptr_t>(this, dstAddress, srcAddress, size, nullptr, 0u, nullptr, false, relaxedOrdering, direction, [&](uintptr_t dstAddressParam, uintptr_t srcAddressParam, size_t sizeParam, ze_event_handle_t hSignalEventParam) {
+        ret = static_cast<DeviceImp *>(this->device)->bcsSplit.appendSplitCall<gfxCoreFamily, uintptr_t, uintptr_t>(this, dstAddress, srcAddress, size, 1u, nullptr, 0u, nullptr, false, relaxedOrdering, direction, [&](uintptr_t dstAddressParam, uintptr_t srcAddressParam, size_t sizeParam, ze_event_handle_t hSignalEventParam) {
             this->appendMemoryCopyBlit(dstAddressParam, dstAllocation, 0u,
                                        srcAddressParam, srcAllocation, 0u,
                                        sizeParam);
@@ -552,7 +673,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWaitOnEvents(ui
         return ZE_RESULT_SUCCESS;
     }
     if (this->isFlushTaskSubmissionEnabled) {
-        checkAvailableSpace(numEvents, false);
+        auto ret = checkAvailableSpace(numEvents, false);
+        if (ret != ZE_RESULT_SUCCESS) {
+            return ret;
+        }
         checkWaitEventsState(numEvents, phWaitEvents);
     }
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendWaitOnEvents(numEvents, phWaitEvents, relaxedOrderingAllowed, trackDependencies);
@@ -566,7 +690,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWriteGlobalTime
     uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
 
     if (this->isFlushTaskSubmissionEnabled) {
-        checkAvailableSpace(numWaitEvents, false);
+        auto ret = checkAvailableSpace(numWaitEvents, false);
+        if (ret != ZE_RESULT_SUCCESS) {
+            return ret;
+        }
         checkWaitEventsState(numWaitEvents, phWaitEvents);
     }
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendWriteGlobalTimestamp(dstptr, hSignalEvent, numWaitEvents, phWaitEvents);
@@ -604,7 +731,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyRegion
     relaxedOrderingDispatch = NEO::RelaxedOrderingHelper::isRelaxedOrderingDispatchAllowed(*this->csr, numWaitEvents);
 
     if (this->isFlushTaskSubmissionEnabled) {
-        checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch);
+        auto ret = checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch);
+        if (ret != ZE_RESULT_SUCCESS) {
+            return ret;
+        }
         checkWaitEventsState(numWaitEvents, phWaitEvents);
     }
 
@@ -624,7 +754,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyFromMe
     relaxedOrderingDispatch = NEO::RelaxedOrderingHelper::isRelaxedOrderingDispatchAllowed(*this->csr, numWaitEvents);
 
     if (this->isFlushTaskSubmissionEnabled) {
-        checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch);
+        auto ret = checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch);
+        if (ret != ZE_RESULT_SUCCESS) {
+            return ret;
+        }
         checkWaitEventsState(numWaitEvents, phWaitEvents);
     }
 
@@ -645,7 +778,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyToMemo
     relaxedOrderingDispatch = NEO::RelaxedOrderingHelper::isRelaxedOrderingDispatchAllowed(*this->csr, numWaitEvents);
 
     if (this->isFlushTaskSubmissionEnabled) {
-        checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch);
+        auto ret = checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch);
+        if (ret != ZE_RESULT_SUCCESS) {
+            return ret;
+        }
         checkWaitEventsState(numWaitEvents, phWaitEvents);
     }
 
@@ -663,7 +799,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryRangesBar
                                                                                      uint32_t numWaitEvents,
                                                                                      ze_event_handle_t *phWaitEvents) {
     if (this->isFlushTaskSubmissionEnabled) {
-        checkAvailableSpace(numWaitEvents, false);
+        auto ret = checkAvailableSpace(numWaitEvents, false);
+        if (ret != ZE_RESULT_SUCCESS) {
+            return ret;
+        }
         checkWaitEventsState(numWaitEvents, phWaitEvents);
     }
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendMemoryRangesBarrier(numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEvents);
@@ -679,7 +818,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchCooperati
     relaxedOrderingDispatch = NEO::RelaxedOrderingHelper::isRelaxedOrderingDispatchAllowed(*this->csr, numWaitEvents);
 
     if (this->isFlushTaskSubmissionEnabled) {
-        checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch);
+        auto ret = checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch);
+        if (ret != ZE_RESULT_SUCCESS) {
+            return ret;
+        }
         checkWaitEventsState(numWaitEvents, waitEventHandles);
     }
 
@@ -690,8 +832,19 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchCooperati
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::flushImmediate(ze_result_t inputRet, bool performMigration, bool hasStallingCmds,
                                                                           bool hasRelaxedOrderingDependencies, ze_event_handle_t hSignalEvent) {
+    bool appendBatched = this->appendJoinsBatchedSubmission;
+    this->appendJoinsBatchedSubmission = false;
+
     if (inputRet == ZE_RESULT_SUCCESS) {
-        if (this->isFlushTaskSubmissionEnabled) {
+        if (appendBatched) {
+            if (!this->batchedSubmissionPending) {
+                this->batchedSubmissionPending = true;
+                this->batchedSubmissionStartTime = std::chrono::steady_clock::now();
+            }
+            if (isBatchedSubmissionThresholdReached()) {
+                inputRet = flushBatchedSubmission();
+            }
+        } else if (this->isFlushTaskSubmissionEnabled) {
             inputRet = executeCommandListImmediateWithFlushTask(performMigration, hasStallingCmds, hasRelaxedOrderingDependencies);
         } else {
             inputRet = executeCommandListImmediate(performMigration);
@@ -703,6 +856,121 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::flushImmediate(ze_res
     return inputRet;
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::flushBatchedSubmission() {
+    std::lock_guard<std::recursive_mutex> lock(this->batchedSubmissionMutex);
+    if (!this->batchedSubmissionPending) {
+        return ZE_RESULT_SUCCESS;
+    }
+    this->batchedSubmissionPending = false;
+    return executeCommandListImmediateWithFlushTask(true, false, false);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::tryFlushBatchedSubmission(bool onlyExpired) {
+    // called by driver at host synchronization points, with batched command lists registry locked.
+    // Owning thread never accesses registry with list lock held, so waiting for its append to finish is safe.
+    std::lock_guard<std::recursive_mutex> lock(this->batchedSubmissionMutex);
+    if (this->appendJoinsBatchedSubmission) {
+        return ZE_RESULT_NOT_READY;
+    }
+    if (onlyExpired && this->batchedSubmissionPending && !isBatchedSubmissionThresholdReached()) {
+        return ZE_RESULT_NOT_READY;
+    }
+    return flushBatchedSubmission();
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamilyImmediate<gfxCoreFamily>::isBatchedSubmissionAllowed(Kernel &kernel, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, const CmdListKernelLaunchParams &launchParams, bool relaxedOrderingDispatch) const {
+    // appends observable from host (signal events, printf, asserts, sync mode) or depending on other work are never deferred
+    auto &kernelAttributes = kernel.getKernelDescriptor().kernelAttributes;
+    return this->isFlushTaskSubmissionEnabled &&
+           !kernelAttributes.flags.usesPrintf &&
+           !kernelAttributes.flags.usesAssert &&
+           !this->isSyncModeQueue &&
+           hSignalEvent == nullptr &&
+           numWaitEvents == 0 &&
+           !relaxedOrderingDispatch &&
+           !launchParams.isIndirect &&
+           this->printfKernelContainer.empty() &&
+           !this->kernelWithAssertAppended;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamilyImmediate<gfxCoreFamily>::isBatchedSubmissionCompatible(Kernel &kernel, const ze_group_count_t *threadGroupDimensions, bool isCooperative) {
+    if (!this->batchedSubmissionPending) {
+        return true;
+    }
+
+    auto &kernelDescriptor = kernel.getKernelDescriptor();
+
+    // whole batch is submitted with single state programming, so kernel must not change required stream state
+    const auto requiredStreamStateBeforeAppend = this->requiredStreamState;
+    this->updateStreamPropertiesForFlushTaskDispatchFlags(kernel, isCooperative, threadGroupDimensions, false);
+    const auto &requiredStreamStateAfterAppend = this->requiredStreamState;
+    bool stateChanged = requiredStreamStateAfterAppend.stateComputeMode.largeGrfMode.value != requiredStreamStateBeforeAppend.stateComputeMode.largeGrfMode.value ||
+                        requiredStreamStateAfterAppend.stateComputeMode.threadArbitrationPolicy.value != requiredStreamStateBeforeAppend.stateComputeMode.threadArbitrationPolicy.value ||
+                        requiredStreamStateAfterAppend.frontEndState.computeDispatchAllWalkerEnable.value != requiredStreamStateBeforeAppend.frontEndState.computeDispatchAllWalkerEnable.value ||
+                        requiredStreamStateAfterAppend.frontEndState.disableEUFusion.value != requiredStreamStateBeforeAppend.frontEndState.disableEUFusion.value ||
+                        requiredStreamStateAfterAppend.pipelineSelect.systolicMode.value != requiredStreamStateBeforeAppend.pipelineSelect.systolicMode.value;
+    this->requiredStreamState = requiredStreamStateBeforeAppend;
+    if (stateChanged) {
+        return false;
+    }
+
+    // heap reallocation would move base addresses programmed once for whole batch
+    auto hasHeapSpace = [](NEO::IndirectHeap *heap, size_t requiredSize) {
+        return heap == nullptr || requiredSize == 0 || (heap->getGraphicsAllocation() != nullptr && heap->getAvailableSpace() >= requiredSize);
+    };
+
+    auto kernelInfo = kernel.getImmutableData()->getKernelInfo();
+    size_t sshSize = NEO::EncodeDispatchKernel<GfxFamily>::getSizeRequiredSsh(*kernelInfo) + NEO::EncodeDispatchKernel<GfxFamily>::getDefaultSshAlignment();
+    size_t dshSize = this->dynamicHeapRequired ? NEO::EncodeDispatchKernel<GfxFamily>::getSizeRequiredDsh(kernelDescriptor, 0) + NEO::EncodeDispatchKernel<GfxFamily>::getDefaultDshAlignment() : 0;
+    size_t iohSize = kernel.getCrossThreadDataSize() + kernel.getPerThreadDataSizeForWholeThreadGroup() + GfxFamily::WALKER_TYPE::INDIRECTDATASTARTADDRESS_ALIGN_SIZE;
+
+    NEO::IndirectHeap *ssh = nullptr;
+    NEO::IndirectHeap *dsh = nullptr;
+    if (this->cmdListHeapAddressModel == NEO::HeapAddressModel::PrivateHeaps) {
+        if (this->immediateCmdListHeapSharing) {
+            ssh = this->commandContainer.getSurfaceStateHeapReserve().indirectHeapReservation;
+            dsh = this->commandContainer.getDynamicStateHeapReserve().indirectHeapReservation;
+        } else {
+            ssh = this->commandContainer.getIndirectHeap(NEO::IndirectHeap::Type::SURFACE_STATE);
+            dsh = this->commandContainer.getIndirectHeap(NEO::IndirectHeap::Type::DYNAMIC_STATE);
+        }
+    }
+    auto ioh = this->commandContainer.getIndirectHeap(NEO::IndirectHeap::Type::INDIRECT_OBJECT);
+
+    return hasHeapSpace(ssh, sshSize) && hasHeapSpace(dsh, dshSize) && hasHeapSpace(ioh, iohSize);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamilyImmediate<gfxCoreFamily>::isBatchedSubmissionThresholdReached() const {
+    size_t sizeThreshold = defaultBatchedSubmissionSizeThreshold;
+    if (NEO::DebugManager.flags.ExperimentalImmediateCmdListBatchingSizeThreshold.get() != -1) {
+        sizeThreshold = static_cast<size_t>(NEO::DebugManager.flags.ExperimentalImmediateCmdListBatchingSizeThreshold.get());
+    }
+    int64_t timeThresholdUs = defaultBatchedSubmissionTimeThresholdUs;
+    if (NEO::DebugManager.flags.ExperimentalImmediateCmdListBatchingTimeThreshold.get() != -1) {
+        timeThresholdUs = NEO::DebugManager.flags.ExperimentalImmediateCmdListBatchingTimeThreshold.get();
+    }
+
+    auto batchedSize = this->commandContainer.getCommandStream()->getUsed() - this->cmdListCurrentStartOffset;
+    if (batchedSize >= sizeThreshold) {
+        return true;
+    }
+
+    auto elapsedTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - this->batchedSubmissionStartTime).count();
+    return elapsedTime >= timeThresholdUs;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::destroy() {
+    auto ret = this->flushBatchedSubmission();
+    auto destroyRet = CommandListCoreFamily<gfxCoreFamily>::destroy();
+    return (ret != ZE_RESULT_SUCCESS) ? ret : destroyRet;
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 bool CommandListCoreFamilyImmediate<gfxCoreFamily>::preferCopyThroughLockedPtr(CpuMemCopyInfo &cpuMemCopyInfo, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
     if (NEO::DebugManager.flags.ExperimentalForceCopyThroughLock.get() == 1) {
@@ -820,7 +1088,8 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::performCpuMemcpy(cons
         signalEvent->setGpuStartTimestamp();
     }
 
-    memcpy_s(cpuMemcpyDstPtr, cpuMemCopyInfo.size, cpuMemcpySrcPtr, cpuMemCopyInfo.size);
+    NEO::CpuCopy::copy(cpuMemcpyDstPtr, cpuMemCopyInfo.size, cpuMemcpySrcPtr, cpuMemCopyInfo.size, dstLockPointer != nullptr,
+                       this->device->getNEODevice()->getExecutionEnvironment()->cpuCopyThreadPool.get());
 
     if (signalEvent) {
         signalEvent->setGpuEndTimestamp();
@@ -989,6 +1258,25 @@ size_t CommandListCoreFamilyImmediate<gfxCoreFamily>::getTransferThreshold(Trans
     return retVal;
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+uint32_t CommandListCoreFamilyImmediate<gfxCoreFamily>::getCopyRegionSplitDimension(const ze_copy_region_t *region, size_t engineCount) {
+    // Splitting along the outermost dimension keeps whole rows and slices in each chunk, so the number of blits per chunk does not grow
+    uint32_t extents[3] = {region->width, region->height, region->depth};
+    for (uint32_t dimension = 2; dimension > 0; dimension--) {
+        if (extents[dimension] >= engineCount) {
+            return dimension;
+        }
+    }
+
+    uint32_t largestDimension = 0u;
+    for (uint32_t dimension = 1; dimension < 3; dimension++) {
+        if (extents[dimension] > extents[largestDimension]) {
+            largestDimension = dimension;
+        }
+    }
+    return largestDimension;
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 bool CommandListCoreFamilyImmediate<gfxCoreFamily>::isBarrierRequired() {
     return *this->csr->getBarrierCountTagAddress() < this->csr->peekBarrierCount();
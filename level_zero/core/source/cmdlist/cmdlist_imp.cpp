@@ -143,6 +143,12 @@ CommandList *CommandList::createImmediate(uint32_t productFamily, Device *device
             }
             PRINT_DEBUG_STRING(NEO::DebugManager.flags.PrintDebugMessages.get(), stderr, "Flush Task for Immediate command list : %s\n", commandList->isFlushTaskSubmissionEnabled ? "Enabled" : "Disabled");
 
+            if (NEO::DebugManager.flags.ExperimentalImmediateCmdListSubmissionBatching.get() != -1) {
+                commandList->isSubmissionBatchingEnabled = commandList->isFlushTaskSubmissionEnabled &&
+                                                           !commandList->isSyncModeQueue &&
+                                                           !!NEO::DebugManager.flags.ExperimentalImmediateCmdListSubmissionBatching.get();
+            }
+
             auto &rootDeviceEnvironment = device->getNEODevice()->getRootDeviceEnvironment();
             bool enabledCmdListSharing = !NEO::EngineHelper::isCopyOnlyEngineType(engineGroupType) && commandList->isFlushTaskSubmissionEnabled;
             commandList->immediateCmdListHeapSharing = L0GfxCoreHelper::enableImmediateCmdListHeapSharing(rootDeviceEnvironment, enabledCmdListSharing);
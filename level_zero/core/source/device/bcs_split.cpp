@@ -11,8 +11,11 @@
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/os_interface/os_context.h"
 
+#include "level_zero/core/source/cmdqueue/cmdqueue_imp.h"
 #include "level_zero/core/source/device/device_imp.h"
 
+#include <algorithm>
+
 namespace L0 {
 
 bool BcsSplit::setupDevice(uint32_t productFamily, bool internalUsage, const ze_command_queue_desc_t *desc, NEO::CommandStreamReceiver *csr) {
@@ -65,6 +68,7 @@ bool BcsSplit::setupDevice(uint32_t productFamily, bool internalUsage, const ze_
 
         this->cmdQs.push_back(commandQueue);
     }
+    this->engineLoads.resize(this->cmdQs.size());
 
     if (NEO::DebugManager.flags.SplitBcsMaskH2D.get() > 0) {
         this->h2dEngines = NEO::DebugManager.flags.SplitBcsMaskH2D.get();
@@ -100,6 +104,7 @@ void BcsSplit::releaseResources() {
         cmdQs.clear();
         d2hCmdQs.clear();
         h2dCmdQs.clear();
+        engineLoads.clear();
         this->events.releaseResources();
     }
 }
@@ -114,9 +119,90 @@ std::vector<CommandQueue *> &BcsSplit::getCmdQsForSplit(NEO::TransferDirection d
     return this->cmdQs;
 }
 
+StackVec<CommandQueue *, 4> BcsSplit::selectCmdQsForSplit(NEO::TransferDirection direction, size_t size, size_t bytesPerUnit) {
+    auto &availableCmdQs = this->getCmdQsForSplit(direction);
+
+    size_t engineCount = std::min(this->getEngineCountForSplit(direction, size * bytesPerUnit), size);
+
+    StackVec<CommandQueue *, 4> selectedCmdQs;
+    if (engineCount == availableCmdQs.size()) {
+        for (auto &cmdQ : availableCmdQs) {
+            selectedCmdQs.push_back(cmdQ);
+        }
+        return selectedCmdQs;
+    }
+
+    StackVec<std::pair<uint64_t, CommandQueue *>, 4> candidates;
+    for (auto &cmdQ : availableCmdQs) {
+        auto engineIndex = static_cast<size_t>(std::distance(this->cmdQs.begin(), std::find(this->cmdQs.begin(), this->cmdQs.end(), cmdQ)));
+        candidates.push_back({this->getOutstandingBytes(engineIndex), cmdQ});
+    }
+    std::stable_sort(candidates.begin(), candidates.end(), [](const auto &lhs, const auto &rhs) { return lhs.first < rhs.first; });
+
+    for (size_t i = 0; i < engineCount; i++) {
+        selectedCmdQs.push_back(candidates[i].second);
+    }
+    return selectedCmdQs;
+}
+
+size_t BcsSplit::getEngineCountForSplit(NEO::TransferDirection direction, size_t totalBytes) {
+    size_t engineCount = std::max(size_t(1u), totalBytes / this->getMinChunkSize());
+    return std::min(engineCount, this->getCmdQsForSplit(direction).size());
+}
+
+size_t BcsSplit::getMinChunkSize() const {
+    size_t minChunkSize = MemoryConstants::megaByte;
+    if (NEO::DebugManager.flags.SplitBcsMinChunkSize.get() > 0) {
+        minChunkSize = static_cast<size_t>(NEO::DebugManager.flags.SplitBcsMinChunkSize.get());
+    }
+    return std::max(minChunkSize, MemoryConstants::pageSize);
+}
+
+void BcsSplit::trackSubmission(CommandQueue *cmdQ, size_t bytes) {
+    auto engineIndex = static_cast<size_t>(std::distance(this->cmdQs.begin(), std::find(this->cmdQs.begin(), this->cmdQs.end(), cmdQ)));
+    auto taskCount = static_cast<CommandQueueImp *>(cmdQ)->getCsr()->peekTaskCount();
+    auto completedTaskCount = this->getCompletedTaskCount(engineIndex);
+
+    std::lock_guard<std::mutex> lock(this->loadMtx);
+    auto &engineLoad = this->engineLoads[engineIndex];
+    // retire here as well, outstanding bytes are queried only when split does not use all engines
+    retireCompletedSubmissions(engineLoad, completedTaskCount);
+    engineLoad.submittedBytes += bytes;
+    engineLoad.outstandingBytes += bytes;
+    engineLoad.inFlight.push_back({taskCount, bytes});
+}
+
+uint64_t BcsSplit::getSubmittedBytes(size_t engineIndex) {
+    std::lock_guard<std::mutex> lock(this->loadMtx);
+    return this->engineLoads[engineIndex].submittedBytes;
+}
+
+uint64_t BcsSplit::getOutstandingBytes(size_t engineIndex) {
+    auto completedTaskCount = this->getCompletedTaskCount(engineIndex);
+
+    std::lock_guard<std::mutex> lock(this->loadMtx);
+    auto &engineLoad = this->engineLoads[engineIndex];
+    retireCompletedSubmissions(engineLoad, completedTaskCount);
+    return engineLoad.outstandingBytes;
+}
+
+TaskCountType BcsSplit::getCompletedTaskCount(size_t engineIndex) {
+    auto csr = static_cast<CommandQueueImp *>(this->cmdQs[engineIndex])->getCsr();
+    return static_cast<TaskCountType>(*csr->getTagAddress());
+}
+
+void BcsSplit::retireCompletedSubmissions(EngineLoad &engineLoad, TaskCountType completedTaskCount) {
+    while (!engineLoad.inFlight.empty() && engineLoad.inFlight.front().first <= completedTaskCount) {
+        engineLoad.outstandingBytes -= engineLoad.inFlight.front().second;
+        engineLoad.inFlight.pop_front();
+    }
+}
+
 size_t BcsSplit::Events::obtainForSplit(Context *context, size_t maxEventCountInPool) {
     std::lock_guard<std::mutex> lock(this->mtx);
-    for (size_t i = 0; i < this->marker.size(); i++) {
+    // Splits complete roughly in submission order, so start from the marker following the last reused one
+    for (size_t checked = 0; checked < this->marker.size(); checked++) {
+        auto i = (this->nextReuseCandidate + checked) % this->marker.size();
         auto ret = this->marker[i]->queryStatus();
         if (ret == ZE_RESULT_SUCCESS) {
             this->marker[i]->reset();
@@ -124,11 +210,14 @@ size_t BcsSplit::Events::obtainForSplit(Context *context, size_t maxEventCountIn
             for (size_t j = 0; j < this->bcsSplit.cmdQs.size(); j++) {
                 this->subcopy[i * this->bcsSplit.cmdQs.size() + j]->reset();
             }
+            this->nextReuseCandidate = (i + 1) % this->marker.size();
             return i;
         }
     }
 
-    return this->allocateNew(context, maxEventCountInPool);
+    auto newIndex = this->allocateNew(context, maxEventCountInPool);
+    this->nextReuseCandidate = (newIndex + 1) % this->marker.size();
+    return newIndex;
 }
 
 size_t BcsSplit::Events::allocateNew(Context *context, size_t maxEventCountInPool) {
@@ -197,5 +286,6 @@ void BcsSplit::Events::releaseResources() {
         pool->destroy();
     }
     pools.clear();
+    nextReuseCandidate = 0u;
 }
 } // namespace L0
\ No newline at end of file
@@ -7,8 +7,11 @@
 
 #pragma once
 
+#include "shared/source/command_stream/task_count_helper.h"
 #include "shared/source/command_stream/transfer_direction.h"
+#include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/engine_node_helper.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/sku_info/sku_info_base.h"
 
 #include "level_zero/core/source/cmdlist/cmdlist_hw_immediate.h"
@@ -16,6 +19,7 @@
 #include "level_zero/core/source/context/context.h"
 #include "level_zero/core/source/event/event.h"
 
+#include <deque>
 #include <functional>
 #include <mutex>
 #include <vector>
@@ -43,6 +47,7 @@ struct BcsSplit {
         std::vector<Event *> subcopy;
         std::vector<Event *> marker;
         size_t createdFromLatestPool = 0u;
+        size_t nextReuseCandidate = 0u;
 
         size_t obtainForSplit(Context *context, size_t maxEventCountInPool);
         size_t allocateNew(Context *context, size_t maxEventCountInPool);
@@ -52,7 +57,15 @@ struct BcsSplit {
         Events(BcsSplit &bcsSplit) : bcsSplit(bcsSplit){};
     } events;
 
+    struct EngineLoad {
+        uint64_t submittedBytes = 0u;
+        uint64_t outstandingBytes = 0u;
+        std::deque<std::pair<TaskCountType, size_t>> inFlight;
+    };
+
     std::vector<CommandQueue *> cmdQs;
+    std::vector<EngineLoad> engineLoads;
+    std::mutex loadMtx;
     std::vector<CommandQueue *> h2dCmdQs;
     std::vector<CommandQueue *> d2hCmdQs;
 
@@ -67,6 +80,7 @@ struct BcsSplit {
                                 T dstptr,
                                 K srcptr,
                                 size_t size,
+                                size_t bytesPerUnit,
                                 ze_event_handle_t hSignalEvent,
                                 uint32_t numWaitEvents,
                                 ze_event_handle_t *phWaitEvents,
@@ -86,7 +100,10 @@ struct BcsSplit {
         auto subcopyEventIndex = markerEventIndex * this->cmdQs.size();
         StackVec<ze_event_handle_t, 4> eventHandles;
 
-        auto &cmdQsForSplit = this->getCmdQsForSplit(direction);
+        auto cmdQsForSplit = this->selectCmdQsForSplit(direction, size, bytesPerUnit);
+
+        // Split points of linear transfers are page aligned in destination address space, region transfers are split on unit granularity
+        const size_t splitAlignment = (bytesPerUnit == 1u) ? MemoryConstants::pageSize : 1u;
 
         auto totalSize = size;
         auto engineCount = cmdQsForSplit.size();
@@ -101,7 +118,15 @@ struct BcsSplit {
                 cmdList->appendEventForProfilingAllWalkers(Event::fromHandle(hSignalEvent), true, true);
             }
 
-            auto localSize = totalSize / engineCount;
+            auto localSize = totalSize;
+            if (engineCount > 1u) {
+                localSize = totalSize / engineCount;
+                auto chunkStartAddress = getSplitAddress(dstptr) + (size - totalSize);
+                auto alignedSplitAddress = alignDown(chunkStartAddress + localSize, splitAlignment);
+                if (alignedSplitAddress > chunkStartAddress) {
+                    localSize = static_cast<size_t>(alignedSplitAddress - chunkStartAddress);
+                }
+            }
             auto localDstPtr = ptrOffset(dstptr, size - totalSize);
             auto localSrcPtr = ptrOffset(srcptr, size - totalSize);
 
@@ -113,6 +138,7 @@ struct BcsSplit {
             } else {
                 cmdList->executeCommandListImmediateImpl(performMigration, cmdQsForSplit[i]);
             }
+            this->trackSubmission(cmdQsForSplit[i], localSize * bytesPerUnit);
 
             eventHandles.push_back(eventHandle);
 
@@ -132,6 +158,17 @@ struct BcsSplit {
     bool setupDevice(uint32_t productFamily, bool internalUsage, const ze_command_queue_desc_t *desc, NEO::CommandStreamReceiver *csr);
     void releaseResources();
     std::vector<CommandQueue *> &getCmdQsForSplit(NEO::TransferDirection direction);
+    StackVec<CommandQueue *, 4> selectCmdQsForSplit(NEO::TransferDirection direction, size_t size, size_t bytesPerUnit);
+    size_t getEngineCountForSplit(NEO::TransferDirection direction, size_t totalBytes);
+    size_t getMinChunkSize() const;
+    void trackSubmission(CommandQueue *cmdQ, size_t bytes);
+    uint64_t getSubmittedBytes(size_t engineIndex);
+    uint64_t getOutstandingBytes(size_t engineIndex);
+    TaskCountType getCompletedTaskCount(size_t engineIndex);
+    static void retireCompletedSubmissions(EngineLoad &engineLoad, TaskCountType completedTaskCount);
+
+    static uint64_t getSplitAddress(const void *ptr) { return castToUint64(ptr); }
+    static uint64_t getSplitAddress(uint64_t address) { return address; }
 
     BcsSplit(DeviceImp &device) : device(device), events(*this){};
 };
@@ -178,6 +178,10 @@ ze_result_t DeviceImp::canAccessPeer(ze_device_handle_t hPeerDevice, ze_bool_t *
     uint32_t bandwidth = 0;
     ze_result_t res = queryFabricStats(pPeerDevice, latency, bandwidth);
     if (res == ZE_RESULT_ERROR_UNSUPPORTED_FEATURE || bandwidth == 0) {
+        if (hasDirectFabricConnectionToPeer(pPeerDevice)) {
+            *value = true;
+            return ZE_RESULT_SUCCESS;
+        }
         return submitCopyForP2P(hPeerDevice, value);
     }
 
@@ -185,6 +189,26 @@ ze_result_t DeviceImp::canAccessPeer(ze_device_handle_t hPeerDevice, ze_bool_t *
     return ZE_RESULT_SUCCESS;
 }
 
+bool DeviceImp::hasDirectFabricConnectionToPeer(DeviceImp *pPeerDevice) {
+    auto driverHandleImp = static_cast<DriverHandleImp *>(getDriverHandle());
+    driverHandleImp->initializeVertexes();
+
+    if (this->fabricVertex == nullptr || pPeerDevice->fabricVertex == nullptr) {
+        return false;
+    }
+
+    // peer copies are not forwarded by intermediate devices, so only a direct link grants access
+    auto directEdge = driverHandleImp->getDirectFabricEdge(this->fabricVertex, pPeerDevice->fabricVertex);
+    if (directEdge == nullptr) {
+        return false;
+    }
+
+    PRINT_DEBUG_STRING(NEO::DebugManager.flags.PrintDebugMessages.get(), stderr,
+                       "Direct fabric connection detected between device %d and peer device %d: latency %u, bandwidth %u\n",
+                       this->getRootDeviceIndex(), pPeerDevice->getRootDeviceIndex(), directEdge->properties.latency, directEdge->properties.bandwidth);
+    return true;
+}
+
 ze_result_t DeviceImp::createCommandList(const ze_command_list_desc_t *desc,
                                          ze_command_list_handle_t *commandList) {
     if (!this->isQueueGroupOrdinalValid(desc->commandQueueGroupOrdinal)) {
@@ -454,9 +478,7 @@ void DeviceImp::getP2PPropertiesDirectFabricConnection(DeviceImp *peerDeviceImp,
                                                        ze_device_p2p_bandwidth_exp_properties_t *bandwidthPropertiesDesc) {
 
     auto driverHandleImp = static_cast<DriverHandleImp *>(getDriverHandle());
-    if (driverHandleImp->fabricVertices.empty()) {
-        driverHandleImp->initializeVertexes();
-    }
+    driverHandleImp->initializeVertexes();
 
     if (this->fabricVertex != nullptr && peerDeviceImp->fabricVertex != nullptr) {
         uint32_t directEdgeCount = 0;
@@ -1619,9 +1641,7 @@ NEO::EngineGroupType DeviceImp::getEngineGroupTypeForOrdinal(uint32_t ordinal) c
 ze_result_t DeviceImp::getFabricVertex(ze_fabric_vertex_handle_t *phVertex) {
     auto driverHandle = this->getDriverHandle();
     DriverHandleImp *driverHandleImp = static_cast<DriverHandleImp *>(driverHandle);
-    if (driverHandleImp->fabricVertices.empty()) {
-        driverHandleImp->initializeVertexes();
-    }
+    driverHandleImp->initializeVertexes();
 
     if (fabricVertex == nullptr) {
         return ZE_RESULT_EXP_ERROR_DEVICE_IS_NOT_VERTEX;
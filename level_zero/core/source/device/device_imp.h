@@ -18,6 +18,7 @@
 
 #include <map>
 #include <mutex>
+#include <unordered_map>
 
 namespace NEO {
 class AllocationsList;
@@ -29,11 +30,18 @@ struct SysmanDevice;
 struct FabricVertex;
 class CacheReservation;
 
+struct PeerAllocationTracker {
+    size_t getNumAllocs() const { return allocations.size(); };
+
+    std::unordered_map<const void *, NEO::SvmAllocationData> allocations;
+};
+
 struct DeviceImp : public Device {
     DeviceImp();
     ze_result_t submitCopyForP2P(ze_device_handle_t hPeerDevice, ze_bool_t *value);
     MOCKABLE_VIRTUAL ze_result_t queryFabricStats(DeviceImp *pPeerDevice, uint32_t &latency, uint32_t &bandwidth);
     ze_result_t canAccessPeer(ze_device_handle_t hPeerDevice, ze_bool_t *value) override;
+    bool hasDirectFabricConnectionToPeer(DeviceImp *pPeerDevice);
     ze_result_t createCommandList(const ze_command_list_desc_t *desc,
                                   ze_command_list_handle_t *commandList) override;
     ze_result_t createCommandListImmediate(const ze_command_queue_desc_t *desc,
@@ -131,7 +139,7 @@ struct DeviceImp : public Device {
     bool resourcesReleased = false;
     void releaseResources();
 
-    NEO::SVMAllocsManager::MapBasedAllocationTracker peerAllocations;
+    PeerAllocationTracker peerAllocations;
     NEO::SpinLock peerAllocationsMutex;
     std::map<NEO::SvmAllocationData *, NEO::MemAdviseFlags> memAdviseSharedAllocations;
     std::unique_ptr<NEO::AllocationsList> allocationsForReuse;
@@ -19,8 +19,10 @@
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/os_interface/os_library.h"
+#include "shared/source/utilities/stackvec.h"
 
 #include "level_zero/core/source/builtin/builtin_functions_lib.h"
+#include "level_zero/core/source/cmdlist/cmdlist.h"
 #include "level_zero/core/source/context/context_imp.h"
 #include "level_zero/core/source/device/device_imp.h"
 #include "level_zero/core/source/driver/driver_imp.h"
@@ -29,9 +31,11 @@
 
 #include "driver_version_l0.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 #include <ctime>
+#include <limits>
 #include <vector>
 
 namespace L0 {
@@ -174,6 +178,7 @@ DriverHandleImp::~DriverHandleImp() {
         delete edge;
     }
     this->fabricEdges.clear();
+    this->fabricRoutes.clear();
 
     if (this->svmAllocsManager) {
         this->svmAllocsManager->trimUSMDeviceAllocCache();
@@ -665,6 +670,11 @@ ze_result_t DriverHandleImp::checkMemoryAccessFromDevice(Device *device, const v
 }
 
 void DriverHandleImp::initializeVertexes() {
+    std::lock_guard<std::mutex> lock(this->fabricVerticesMutex);
+    if (!this->fabricVertices.empty()) {
+        return;
+    }
+
     for (auto &device : this->devices) {
         auto deviceImpl = static_cast<DeviceImp *>(device);
         auto fabricVertex = FabricVertex::createFromDevice(device);
@@ -676,13 +686,51 @@ void DriverHandleImp::initializeVertexes() {
     }
 
     FabricEdge::createEdgesFromVertices(this->fabricVertices, this->fabricEdges);
+    invalidateFabricRoutes();
 }
 
-ze_result_t DriverHandleImp::fabricVertexGetExp(uint32_t *pCount, ze_fabric_vertex_handle_t *phVertices) {
+void DriverHandleImp::invalidateFabricRoutes() {
+    std::lock_guard<std::mutex> lock(this->fabricRoutesMutex);
+    this->fabricRoutes.clear();
+}
+
+void DriverHandleImp::registerBatchedSubmissionCmdList(CommandList *cmdList) {
+    std::lock_guard<std::mutex> lock(this->batchedSubmissionCmdListsMutex);
+    this->batchedSubmissionCmdLists.insert(cmdList);
+    this->batchedSubmissionCmdListsCount = this->batchedSubmissionCmdLists.size();
+}
+
+void DriverHandleImp::unregisterBatchedSubmissionCmdList(CommandList *cmdList) {
+    std::lock_guard<std::mutex> lock(this->batchedSubmissionCmdListsMutex);
+    this->batchedSubmissionCmdLists.erase(cmdList);
+    this->batchedSubmissionCmdListsCount = this->batchedSubmissionCmdLists.size();
+}
+
+ze_result_t DriverHandleImp::flushBatchedSubmissions(bool onlyExpired) {
+    if (this->batchedSubmissionCmdListsCount == 0) {
+        return ZE_RESULT_SUCCESS;
+    }
 
-    if (fabricVertices.empty()) {
-        this->initializeVertexes();
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::lock_guard<std::mutex> lock(this->batchedSubmissionCmdListsMutex);
+    for (auto cmdListIt = this->batchedSubmissionCmdLists.begin(); cmdListIt != this->batchedSubmissionCmdLists.end();) {
+        auto ret = (*cmdListIt)->tryFlushBatchedSubmission(onlyExpired);
+        if (ret == ZE_RESULT_NOT_READY) {
+            cmdListIt++;
+            continue;
+        }
+        if (result == ZE_RESULT_SUCCESS) {
+            result = ret;
+        }
+        cmdListIt = this->batchedSubmissionCmdLists.erase(cmdListIt);
     }
+    this->batchedSubmissionCmdListsCount = this->batchedSubmissionCmdLists.size();
+    return result;
+}
+
+ze_result_t DriverHandleImp::fabricVertexGetExp(uint32_t *pCount, ze_fabric_vertex_handle_t *phVertices) {
+
+    this->initializeVertexes();
 
     bool exposeSubDevices = false;
     if (NEO::DebugManager.flags.ReturnSubDevicesAsApiDevices.get() != -1) {
@@ -759,6 +807,126 @@ ze_result_t DriverHandleImp::fabricEdgeGetExp(ze_fabric_vertex_handle_t hVertexA
     return ZE_RESULT_SUCCESS;
 }
 
+size_t DriverHandleImp::getRootFabricVertexIndex(FabricVertex *vertex) const {
+    // Links between sub-vertices connect the root devices owning them
+    const size_t vertexCount = this->fabricVertices.size();
+    for (size_t i = 0; i < vertexCount; i++) {
+        auto &subVertices = this->fabricVertices[i]->subVertices;
+        if (this->fabricVertices[i] == vertex || std::find(subVertices.begin(), subVertices.end(), vertex) != subVertices.end()) {
+            return i;
+        }
+    }
+    return vertexCount;
+}
+
+FabricEdge *DriverHandleImp::getDirectFabricEdge(FabricVertex *source, FabricVertex *destination) const {
+    const size_t vertexCount = this->fabricVertices.size();
+    const size_t sourceIndex = getRootFabricVertexIndex(source);
+    const size_t destinationIndex = getRootFabricVertexIndex(destination);
+    if (sourceIndex == vertexCount || destinationIndex == vertexCount || sourceIndex == destinationIndex) {
+        return nullptr;
+    }
+
+    FabricEdge *directEdge = nullptr;
+    for (const auto &edge : this->fabricEdges) {
+        auto vertexA = getRootFabricVertexIndex(edge->vertexA);
+        auto vertexB = getRootFabricVertexIndex(edge->vertexB);
+        bool connectsDevices = (vertexA == sourceIndex && vertexB == destinationIndex) || (vertexA == destinationIndex && vertexB == sourceIndex);
+        if (connectsDevices && edge->properties.bandwidth > 0 &&
+            (directEdge == nullptr || edge->properties.bandwidth > directEdge->properties.bandwidth)) {
+            directEdge = edge;
+        }
+    }
+    return directEdge;
+}
+
+bool DriverHandleImp::getFabricRoute(FabricVertex *source, FabricVertex *destination, FabricRoute &route) {
+    std::lock_guard<std::mutex> lock(this->fabricRoutesMutex);
+
+    auto routeKey = std::make_pair(source, destination);
+    auto iter = this->fabricRoutes.find(routeKey);
+    if (iter != this->fabricRoutes.end()) {
+        route = iter->second;
+        return !route.path.empty();
+    }
+
+    const size_t vertexCount = this->fabricVertices.size();
+    StackVec<std::pair<size_t, size_t>, 32> edgeEndpoints;
+    for (const auto &edge : this->fabricEdges) {
+        edgeEndpoints.push_back({getRootFabricVertexIndex(edge->vertexA), getRootFabricVertexIndex(edge->vertexB)});
+    }
+
+    FabricRoute newRoute;
+    const size_t sourceIndex = getRootFabricVertexIndex(source);
+    const size_t destinationIndex = getRootFabricVertexIndex(destination);
+
+    if (sourceIndex < vertexCount && destinationIndex < vertexCount && sourceIndex != destinationIndex) {
+        // Shortest path on accumulated latency, ties resolved towards higher bottleneck bandwidth
+        constexpr uint64_t unreachable = std::numeric_limits<uint64_t>::max();
+        std::vector<uint64_t> latency(vertexCount, unreachable);
+        std::vector<uint32_t> bandwidth(vertexCount, 0u);
+        std::vector<size_t> previous(vertexCount, vertexCount);
+        std::vector<bool> visited(vertexCount, false);
+        latency[sourceIndex] = 0u;
+        bandwidth[sourceIndex] = std::numeric_limits<uint32_t>::max();
+
+        for (size_t step = 0; step < vertexCount; step++) {
+            size_t current = vertexCount;
+            for (size_t i = 0; i < vertexCount; i++) {
+                if (visited[i] || latency[i] == unreachable) {
+                    continue;
+                }
+                if (current == vertexCount || latency[i] < latency[current] ||
+                    (latency[i] == latency[current] && bandwidth[i] > bandwidth[current])) {
+                    current = i;
+                }
+            }
+            if (current == vertexCount || current == destinationIndex) {
+                break;
+            }
+            visited[current] = true;
+
+            for (size_t edgeIndex = 0; edgeIndex < edgeEndpoints.size(); edgeIndex++) {
+                auto [vertexA, vertexB] = edgeEndpoints[edgeIndex];
+                if (vertexA == vertexB || vertexA == vertexCount || vertexB == vertexCount) {
+                    continue;
+                }
+                size_t neighbor = vertexCount;
+                if (vertexA == current) {
+                    neighbor = vertexB;
+                } else if (vertexB == current) {
+                    neighbor = vertexA;
+                }
+                if (neighbor == vertexCount || visited[neighbor]) {
+                    continue;
+                }
+
+                auto &edgeProperties = this->fabricEdges[edgeIndex]->properties;
+                uint64_t candidateLatency = latency[current] + std::max(edgeProperties.latency, 1u);
+                uint32_t candidateBandwidth = std::min(bandwidth[current], edgeProperties.bandwidth);
+                if (candidateLatency < latency[neighbor] ||
+                    (candidateLatency == latency[neighbor] && candidateBandwidth > bandwidth[neighbor])) {
+                    latency[neighbor] = candidateLatency;
+                    bandwidth[neighbor] = candidateBandwidth;
+                    previous[neighbor] = current;
+                }
+            }
+        }
+
+        if (latency[destinationIndex] != unreachable) {
+            for (size_t index = destinationIndex; index != vertexCount; index = previous[index]) {
+                newRoute.path.insert(newRoute.path.begin(), this->fabricVertices[index]);
+            }
+            newRoute.latency = latency[destinationIndex];
+            newRoute.bandwidth = bandwidth[destinationIndex];
+        }
+    }
+
+    this->fabricRoutes[routeKey] = newRoute;
+    route = newRoute;
+    return !route.path.empty();
+}
+
 uint32_t DriverHandleImp::getEventMaxPacketCount(uint32_t numDevices, ze_device_handle_t *deviceHandles) const {
     uint32_t maxCount = 0;
 
@@ -12,13 +12,17 @@
 
 #include "level_zero/api/extensions/public/ze_exp_ext.h"
 #include "level_zero/core/source/driver/driver_handle.h"
+#include "level_zero/core/source/fabric/fabric.h"
 #include "level_zero/core/source/get_extension_function_lookup_map.h"
 
+#include <atomic>
 #include <map>
 #include <mutex>
+#include <unordered_set>
 
 namespace L0 {
 class HostPointerManager;
+struct CommandList;
 struct FabricVertex;
 struct FabricEdge;
 
@@ -85,6 +89,13 @@ struct DriverHandleImp : public DriverHandle {
                                 Device *device);
     ze_result_t fabricEdgeGetExp(ze_fabric_vertex_handle_t hVertexA, ze_fabric_vertex_handle_t hVertexB,
                                  uint32_t *pCount, ze_fabric_edge_handle_t *phEdges);
+    bool getFabricRoute(FabricVertex *source, FabricVertex *destination, FabricRoute &route);
+    FabricEdge *getDirectFabricEdge(FabricVertex *source, FabricVertex *destination) const;
+    size_t getRootFabricVertexIndex(FabricVertex *vertex) const;
+    void invalidateFabricRoutes();
+    void registerBatchedSubmissionCmdList(CommandList *cmdList);
+    void unregisterBatchedSubmissionCmdList(CommandList *cmdList);
+    ze_result_t flushBatchedSubmissions(bool onlyExpired);
     uint32_t getEventMaxPacketCount(uint32_t numDevices, ze_device_handle_t *deviceHandles) const override;
     uint32_t getEventMaxKernelCount(uint32_t numDevices, ze_device_handle_t *deviceHandles) const override;
 
@@ -98,6 +109,12 @@ struct DriverHandleImp : public DriverHandle {
     std::vector<Device *> devices;
     std::vector<FabricVertex *> fabricVertices;
     std::vector<FabricEdge *> fabricEdges;
+    std::mutex fabricVerticesMutex;
+    std::map<std::pair<FabricVertex *, FabricVertex *>, FabricRoute> fabricRoutes;
+    std::mutex fabricRoutesMutex;
+    std::unordered_set<CommandList *> batchedSubmissionCmdLists;
+    std::atomic<size_t> batchedSubmissionCmdListsCount{0};
+    std::mutex batchedSubmissionCmdListsMutex;
     // Spec extensions
     const std::vector<std::pair<std::string, uint32_t>> extensionsSupported = {
         {ZE_FLOAT_ATOMICS_EXT_NAME, ZE_FLOAT_ATOMICS_EXT_VERSION_CURRENT},
@@ -11,6 +11,7 @@
 #include "shared/source/helpers/constants.h"
 #include "shared/source/memory_manager/allocation_properties.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/memory_manager/host_ptr_manager.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/multi_graphics_allocation.h"
 
@@ -133,6 +134,8 @@ bool HostPointerManager::freeHostPointerAllocation(void *ptr) {
     for (auto gpuAllocation : graphicsAllocations) {
         memoryManager->freeGraphicsMemory(gpuAllocation);
     }
+    // imported memory may be unmapped by the application once released, fragments cached over it cannot be reused
+    memoryManager->getHostPtrManager()->releaseCachedFragments(*memoryManager, hostPtrData->basePtr, hostPtrData->size);
     hostPointerAllocations.remove(hostPtrData->basePtr);
     return true;
 }
@@ -359,6 +359,15 @@ void Event::setGpuEndTimestamp() {
     }
 }
 
+ze_result_t Event::flushBatchedSubmissions() {
+    // work deferred by immediate command lists has to be submitted before host observes or signals the event
+    auto driverHandle = this->device ? static_cast<DriverHandleImp *>(this->device->getDriverHandle()) : nullptr;
+    if (driverHandle == nullptr) {
+        return ZE_RESULT_SUCCESS;
+    }
+    return driverHandle->flushBatchedSubmissions(false);
+}
+
 void *Event::getCompletionFieldHostAddress() const {
     return ptrOffset(getHostAddress(), getCompletionFieldOffset());
 }
@@ -202,6 +202,8 @@ struct Event : _ze_event_handle_t {
   protected:
     Event(EventPool *eventPool, int index, Device *device) : device(device), eventPool(eventPool), index(index) {}
 
+    ze_result_t flushBatchedSubmissions();
+
     uint64_t globalStartTS = 1;
     uint64_t globalEndTS = 1;
     uint64_t contextStartTS = 1;
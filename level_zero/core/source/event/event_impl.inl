@@ -187,6 +187,10 @@ ze_result_t EventImp<TagSizeT>::queryStatus() {
     if (!this->isFromIpcPool && isAlreadyCompleted()) {
         return ZE_RESULT_SUCCESS;
     } else {
+        auto ret = this->flushBatchedSubmissions();
+        if (ret != ZE_RESULT_SUCCESS) {
+            return ret;
+        }
         return queryStatusEventPackets();
     }
 }
@@ -278,7 +282,11 @@ ze_result_t EventImp<TagSizeT>::hostEventSetValue(TagSizeT eventVal) {
 
 template <typename TagSizeT>
 ze_result_t EventImp<TagSizeT>::hostSignal() {
-    auto status = hostEventSetValue(Event::STATE_SIGNALED);
+    auto status = this->flushBatchedSubmissions();
+    if (status != ZE_RESULT_SUCCESS) {
+        return status;
+    }
+    status = hostEventSetValue(Event::STATE_SIGNALED);
     if (status == ZE_RESULT_SUCCESS) {
         this->setIsCompleted();
     }
@@ -67,4 +67,10 @@ struct FabricEdge : _ze_fabric_edge_handle_t {
     FabricVertex *vertexB = nullptr;
 };
 
+struct FabricRoute {
+    std::vector<FabricVertex *> path; // root vertices from source to destination, empty when not connected
+    uint64_t latency = 0;
+    uint32_t bandwidth = 0; // bottleneck bandwidth along the path
+};
+
 } // namespace L0
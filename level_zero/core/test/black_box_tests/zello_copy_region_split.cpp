@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "zello_common.h"
+
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+// Run with NEOReadDebugKeys=1 SplitBcsCopy=1 to split region copies across copy engines,
+// compare against SplitBcsCopy=0 to see the effect of the split dimension choice
+void measureCopyRegion(ze_context_handle_t &context, ze_device_handle_t &device, uint32_t width, uint32_t height, uint32_t depth,
+                       uint32_t iterations, bool &outputValidationSuccessful) {
+    ze_command_list_handle_t cmdList;
+    ze_command_queue_desc_t cmdQueueDesc = {ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC};
+    cmdQueueDesc.ordinal = getCopyOnlyCommandQueueOrdinal(device);
+    if (cmdQueueDesc.ordinal == std::numeric_limits<uint32_t>::max()) {
+        std::cout << "No Copy queue group found. Using compute queue group\n";
+        cmdQueueDesc.ordinal = getCommandQueueOrdinal(device);
+    }
+    cmdQueueDesc.index = 0;
+    selectQueueMode(cmdQueueDesc, true);
+    SUCCESS_OR_TERMINATE(zeCommandListCreateImmediate(context, device, &cmdQueueDesc, &cmdList));
+
+    const size_t rowPitch = width;
+    const size_t slicePitch = rowPitch * height;
+    const size_t totalSize = slicePitch * depth;
+
+    ze_device_mem_alloc_desc_t deviceDesc = {ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC};
+    void *deviceBuffer = nullptr;
+    SUCCESS_OR_TERMINATE(zeMemAllocDevice(context, &deviceDesc, totalSize, 1, device, &deviceBuffer));
+
+    ze_host_mem_alloc_desc_t hostDesc = {ZE_STRUCTURE_TYPE_HOST_MEM_ALLOC_DESC};
+    void *srcBuffer = nullptr;
+    void *dstBuffer = nullptr;
+    SUCCESS_OR_TERMINATE(zeMemAllocHost(context, &hostDesc, totalSize, 1, &srcBuffer));
+    SUCCESS_OR_TERMINATE(zeMemAllocHost(context, &hostDesc, totalSize, 1, &dstBuffer));
+
+    auto srcBytes = static_cast<uint8_t *>(srcBuffer);
+    for (size_t i = 0; i < totalSize; i++) {
+        srcBytes[i] = static_cast<uint8_t>(i % 251);
+    }
+
+    std::cout << std::setw(24) << "Region [W x H x D]" << std::setw(16) << "H2D [us]" << std::setw(16) << "D2H [us]" << std::setw(16) << "H2D [GB/s]" << "\n";
+
+    outputValidationSuccessful = true;
+    for (uint32_t regionDepth = 1; regionDepth <= depth && outputValidationSuccessful; regionDepth *= 2) {
+        ze_copy_region_t region = {0, 0, 0, width, height, regionDepth};
+        size_t regionSize = slicePitch * regionDepth;
+        memset(dstBuffer, 0, regionSize);
+
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < iterations; i++) {
+            SUCCESS_OR_TERMINATE(zeCommandListAppendMemoryCopyRegion(cmdList, deviceBuffer, &region, static_cast<uint32_t>(rowPitch), static_cast<uint32_t>(slicePitch),
+                                                                     srcBuffer, &region, static_cast<uint32_t>(rowPitch), static_cast<uint32_t>(slicePitch),
+                                                                     nullptr, 0, nullptr));
+        }
+        auto h2dTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < iterations; i++) {
+            SUCCESS_OR_TERMINATE(zeCommandListAppendMemoryCopyRegion(cmdList, dstBuffer, &region, static_cast<uint32_t>(rowPitch), static_cast<uint32_t>(slicePitch),
+                                                                     deviceBuffer, &region, static_cast<uint32_t>(rowPitch), static_cast<uint32_t>(slicePitch),
+                                                                     nullptr, 0, nullptr));
+        }
+        auto d2hTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::string regionName = std::to_string(width) + " x " + std::to_string(height) + " x " + std::to_string(regionDepth);
+        std::cout << std::setw(24) << regionName
+                  << std::setw(16) << std::fixed << std::setprecision(2) << h2dTime * 1e6 / iterations
+                  << std::setw(16) << std::fixed << std::setprecision(2) << d2hTime * 1e6 / iterations
+                  << std::setw(16) << std::fixed << std::setprecision(2) << static_cast<double>(regionSize) * iterations / h2dTime / 1e9 << "\n";
+
+        if (memcmp(dstBuffer, srcBuffer, regionSize) != 0) {
+            std::cout << "Data mismatch for region " << regionName << "\n";
+            outputValidationSuccessful = false;
+        }
+    }
+
+    SUCCESS_OR_TERMINATE(zeMemFree(context, dstBuffer));
+    SUCCESS_OR_TERMINATE(zeMemFree(context, srcBuffer));
+    SUCCESS_OR_TERMINATE(zeMemFree(context, deviceBuffer));
+    SUCCESS_OR_TERMINATE(zeCommandListDestroy(cmdList));
+}
+
+int main(int argc, char *argv[]) {
+    const std::string blackBoxName = "Zello Copy Region Split";
+    verbose = isVerbose(argc, argv);
+    bool aubMode = isAubMode(argc, argv);
+    uint32_t width = static_cast<uint32_t>(getParamValue(argc, argv, "-w", "--width", 4096));
+    uint32_t height = static_cast<uint32_t>(getParamValue(argc, argv, "-h", "--height", 256));
+    uint32_t depth = static_cast<uint32_t>(getParamValue(argc, argv, "-d", "--depth", 16));
+    uint32_t iterations = static_cast<uint32_t>(getParamValue(argc, argv, "-i", "--iterations", 10));
+    if (aubMode) {
+        width = 256;
+        height = 16;
+        depth = 2;
+        iterations = 1;
+    }
+    if (width == 0 || height == 0 || depth == 0 || iterations == 0) {
+        std::cout << "Region extents and iteration count have to be non-zero\n";
+        return 1;
+    }
+
+    ze_context_handle_t context = nullptr;
+    auto devices = zelloInitContextAndGetDevices(context);
+    auto device = devices[0];
+
+    ze_device_properties_t deviceProperties = {ZE_STRUCTURE_TYPE_DEVICE_PROPERTIES};
+    SUCCESS_OR_TERMINATE(zeDeviceGetProperties(device, &deviceProperties));
+    printDeviceProperties(deviceProperties);
+
+    bool outputValidationSuccessful = false;
+    measureCopyRegion(context, device, width, height, depth, iterations, outputValidationSuccessful);
+
+    SUCCESS_OR_TERMINATE(zeContextDestroy(context));
+
+    printResult(aubMode, outputValidationSuccessful, blackBoxName);
+    outputValidationSuccessful = aubMode ? true : outputValidationSuccessful;
+    return outputValidationSuccessful ? 0 : 1;
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "zello_common.h"
+
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+// Run with NEOReadDebugKeys=1 ExperimentalForceCopyThroughLock=1 to measure CPU copies into locked device memory,
+// ExperimentalCpuCopyStreaming and CpuCopyThreadCount select the copy variant
+void measureCopyBandwidth(ze_context_handle_t &context, ze_device_handle_t &device, size_t maxSize, uint32_t iterations, bool &outputValidationSuccessful) {
+    ze_command_list_handle_t cmdList;
+    ze_command_queue_desc_t cmdQueueDesc = {ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC};
+    cmdQueueDesc.ordinal = getCommandQueueOrdinal(device);
+    cmdQueueDesc.index = 0;
+    selectQueueMode(cmdQueueDesc, true);
+    SUCCESS_OR_TERMINATE(zeCommandListCreateImmediate(context, device, &cmdQueueDesc, &cmdList));
+
+    ze_device_mem_alloc_desc_t deviceDesc = {ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC};
+    void *deviceBuffer = nullptr;
+    SUCCESS_OR_TERMINATE(zeMemAllocDevice(context, &deviceDesc, maxSize, 1, device, &deviceBuffer));
+
+    ze_host_mem_alloc_desc_t hostDesc = {ZE_STRUCTURE_TYPE_HOST_MEM_ALLOC_DESC};
+    void *srcBuffer = nullptr;
+    void *dstBuffer = nullptr;
+    SUCCESS_OR_TERMINATE(zeMemAllocHost(context, &hostDesc, maxSize, 1, &srcBuffer));
+    SUCCESS_OR_TERMINATE(zeMemAllocHost(context, &hostDesc, maxSize, 1, &dstBuffer));
+
+    auto srcBytes = static_cast<uint8_t *>(srcBuffer);
+    for (size_t i = 0; i < maxSize; i++) {
+        srcBytes[i] = static_cast<uint8_t>(i % 251);
+    }
+
+    std::cout << std::setw(12) << "Size [B]" << std::setw(16) << "H2D [GB/s]" << std::setw(16) << "D2H [GB/s]" << "\n";
+
+    outputValidationSuccessful = true;
+    for (size_t size = 4 * 1024; size <= maxSize && outputValidationSuccessful; size *= 4) {
+        memset(dstBuffer, 0, size);
+
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < iterations; i++) {
+            SUCCESS_OR_TERMINATE(zeCommandListAppendMemoryCopy(cmdList, deviceBuffer, srcBuffer, size, nullptr, 0, nullptr));
+        }
+        auto h2dTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < iterations; i++) {
+            SUCCESS_OR_TERMINATE(zeCommandListAppendMemoryCopy(cmdList, dstBuffer, deviceBuffer, size, nullptr, 0, nullptr));
+        }
+        auto d2hTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        auto totalBytes = static_cast<double>(size) * iterations;
+        std::cout << std::setw(12) << size
+                  << std::setw(16) << std::fixed << std::setprecision(2) << totalBytes / h2dTime / 1e9
+                  << std::setw(16) << std::fixed << std::setprecision(2) << totalBytes / d2hTime / 1e9 << "\n";
+
+        if (memcmp(dstBuffer, srcBuffer, size) != 0) {
+            std::cout << "Data mismatch for size " << size << "\n";
+            outputValidationSuccessful = false;
+        }
+    }
+
+    SUCCESS_OR_TERMINATE(zeMemFree(context, dstBuffer));
+    SUCCESS_OR_TERMINATE(zeMemFree(context, srcBuffer));
+    SUCCESS_OR_TERMINATE(zeMemFree(context, deviceBuffer));
+    SUCCESS_OR_TERMINATE(zeCommandListDestroy(cmdList));
+}
+
+int main(int argc, char *argv[]) {
+    const std::string blackBoxName = "Zello CPU Copy Bandwidth";
+    verbose = isVerbose(argc, argv);
+    bool aubMode = isAubMode(argc, argv);
+    size_t maxSize = static_cast<size_t>(getParamValue(argc, argv, "-s", "--size", 256)) * 1024 * 1024;
+    uint32_t iterations = static_cast<uint32_t>(getParamValue(argc, argv, "-i", "--iterations", 10));
+    if (aubMode) {
+        maxSize = 64 * 1024;
+        iterations = 1;
+    }
+    if (iterations == 0) {
+        iterations = 1;
+    }
+
+    ze_context_handle_t context = nullptr;
+    auto devices = zelloInitContextAndGetDevices(context);
+    auto device = devices[0];
+
+    ze_device_properties_t deviceProperties = {ZE_STRUCTURE_TYPE_DEVICE_PROPERTIES};
+    SUCCESS_OR_TERMINATE(zeDeviceGetProperties(device, &deviceProperties));
+    printDeviceProperties(deviceProperties);
+
+    bool outputValidationSuccessful = false;
+    measureCopyBandwidth(context, device, maxSize, iterations, outputValidationSuccessful);
+
+    SUCCESS_OR_TERMINATE(zeContextDestroy(context));
+
+    printResult(aubMode, outputValidationSuccessful, blackBoxName);
+    outputValidationSuccessful = aubMode ? true : outputValidationSuccessful;
+    return outputValidationSuccessful ? 0 : 1;
+}
@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "zello_common.h"
+#include "zello_compile.h"
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <limits>
+
+const char *smallKernelSrc = R"===(
+__kernel void increment(__global uint *dst){
+    uint gid = get_global_id(0);
+    atomic_inc(&dst[gid]);
+}
+)===";
+
+// Run with NEOReadDebugKeys=1 ExperimentalImmediateCmdListSubmissionBatching=1 to measure batched submission
+void executeSmallKernels(ze_context_handle_t &context, ze_device_handle_t &device, uint32_t numLaunches, bool &outputValidationSuccessful) {
+    ze_command_list_handle_t cmdList;
+    ze_command_queue_desc_t cmdQueueDesc = {ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC};
+    cmdQueueDesc.ordinal = getCommandQueueOrdinal(device);
+    cmdQueueDesc.index = 0;
+    selectQueueMode(cmdQueueDesc, false);
+    SUCCESS_OR_TERMINATE(zeCommandListCreateImmediate(context, device, &cmdQueueDesc, &cmdList));
+
+    constexpr uint32_t elements = 64;
+    constexpr size_t allocSize = elements * sizeof(uint32_t);
+    ze_device_mem_alloc_desc_t deviceDesc = {ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC};
+    ze_host_mem_alloc_desc_t hostDesc = {ZE_STRUCTURE_TYPE_HOST_MEM_ALLOC_DESC};
+    void *buffer = nullptr;
+    SUCCESS_OR_TERMINATE(zeMemAllocShared(context, &deviceDesc, &hostDesc, allocSize, 1, device, &buffer));
+    memset(buffer, 0, allocSize);
+
+    std::string buildLog;
+    auto spirV = compileToSpirV(smallKernelSrc, "", buildLog);
+    if (buildLog.size() > 0) {
+        std::cout << "Build log " << buildLog;
+    }
+    SUCCESS_OR_TERMINATE((0 == spirV.size()));
+
+    ze_module_handle_t module = nullptr;
+    ze_module_desc_t moduleDesc = {ZE_STRUCTURE_TYPE_MODULE_DESC};
+    moduleDesc.format = ZE_MODULE_FORMAT_IL_SPIRV;
+    moduleDesc.pInputModule = spirV.data();
+    moduleDesc.inputSize = spirV.size();
+    moduleDesc.pBuildFlags = "";
+    SUCCESS_OR_TERMINATE(zeModuleCreate(context, device, &moduleDesc, &module, nullptr));
+
+    ze_kernel_handle_t kernel = nullptr;
+    ze_kernel_desc_t kernelDesc = {ZE_STRUCTURE_TYPE_KERNEL_DESC};
+    kernelDesc.pKernelName = "increment";
+    SUCCESS_OR_TERMINATE(zeKernelCreate(module, &kernelDesc, &kernel));
+    SUCCESS_OR_TERMINATE(zeKernelSetGroupSize(kernel, elements, 1u, 1u));
+    SUCCESS_OR_TERMINATE(zeKernelSetArgumentValue(kernel, 0, sizeof(buffer), &buffer));
+
+    ze_event_pool_handle_t eventPool = nullptr;
+    ze_event_handle_t completionEvent = nullptr;
+    createEventPoolAndEvents(context, device, eventPool, ZE_EVENT_POOL_FLAG_HOST_VISIBLE, 1, &completionEvent, ZE_EVENT_SCOPE_FLAG_HOST, ZE_EVENT_SCOPE_FLAG_HOST);
+
+    ze_group_count_t dispatchTraits = {1u, 1u, 1u};
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < numLaunches - 1; i++) {
+        SUCCESS_OR_TERMINATE(zeCommandListAppendLaunchKernel(cmdList, kernel, &dispatchTraits, nullptr, 0, nullptr));
+    }
+    SUCCESS_OR_TERMINATE(zeCommandListAppendLaunchKernel(cmdList, kernel, &dispatchTraits, completionEvent, 0, nullptr));
+    auto submitEnd = std::chrono::steady_clock::now();
+    SUCCESS_OR_TERMINATE(zeEventHostSynchronize(completionEvent, std::numeric_limits<uint64_t>::max()));
+    auto end = std::chrono::steady_clock::now();
+
+    auto submitTime = std::chrono::duration_cast<std::chrono::microseconds>(submitEnd - start).count();
+    auto totalTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    std::cout << "Kernel launches: " << numLaunches << "\n"
+              << "Host append time: " << submitTime << " us (" << static_cast<double>(submitTime) / numLaunches << " us per launch)\n"
+              << "Total time: " << totalTime << " us (" << (totalTime > 0 ? numLaunches * 1000000.0 / totalTime : 0.0) << " launches/s)\n";
+
+    outputValidationSuccessful = true;
+    auto result = static_cast<uint32_t *>(buffer);
+    for (uint32_t i = 0; i < elements; i++) {
+        if (result[i] != numLaunches) {
+            std::cout << "buffer[" << i << "] = " << result[i] << " not equal to " << numLaunches << "\n";
+            outputValidationSuccessful = false;
+            break;
+        }
+    }
+
+    SUCCESS_OR_TERMINATE(zeEventDestroy(completionEvent));
+    SUCCESS_OR_TERMINATE(zeEventPoolDestroy(eventPool));
+    SUCCESS_OR_TERMINATE(zeKernelDestroy(kernel));
+    SUCCESS_OR_TERMINATE(zeModuleDestroy(module));
+    SUCCESS_OR_TERMINATE(zeMemFree(context, buffer));
+    SUCCESS_OR_TERMINATE(zeCommandListDestroy(cmdList));
+}
+
+int main(int argc, char *argv[]) {
+    const std::string blackBoxName = "Zello Immediate Batching";
+    verbose = isVerbose(argc, argv);
+    bool aubMode = isAubMode(argc, argv);
+    uint32_t numLaunches = static_cast<uint32_t>(getParamValue(argc, argv, "-n", "--launches", 10000));
+    if (numLaunches == 0) {
+        numLaunches = 1;
+    }
+
+    ze_context_handle_t context = nullptr;
+    auto devices = zelloInitContextAndGetDevices(context);
+    auto device = devices[0];
+
+    ze_device_properties_t deviceProperties = {ZE_STRUCTURE_TYPE_DEVICE_PROPERTIES};
+    SUCCESS_OR_TERMINATE(zeDeviceGetProperties(device, &deviceProperties));
+    printDeviceProperties(deviceProperties);
+
+    bool outputValidationSuccessful = false;
+    executeSmallKernels(context, device, numLaunches, outputValidationSuccessful);
+
+    SUCCESS_OR_TERMINATE(zeContextDestroy(context));
+
+    printResult(aubMode, outputValidationSuccessful, blackBoxName);
+    outputValidationSuccessful = aubMode ? true : outputValidationSuccessful;
+    return outputValidationSuccessful ? 0 : 1;
+}
@@ -921,6 +921,172 @@ HWTEST2_F(CommandListAppendLaunchKernel, givenImmediateCommandListWhenAppendLaun
     EXPECT_EQ(ZE_RESULT_SUCCESS, returnValue);
 }
 
+struct CommandListSubmissionBatchingFixture : public ModuleFixture {
+    void setUp() {
+        NEO::DebugManager.flags.ExperimentalImmediateCmdListBatchingSizeThreshold.set(static_cast<int32_t>(MemoryConstants::megaByte));
+        NEO::DebugManager.flags.ExperimentalImmediateCmdListBatchingTimeThreshold.set(std::numeric_limits<int32_t>::max());
+        ModuleFixture::setUp();
+        batchedKernel.descriptor.kernelAttributes.flags.usesPrintf = false;
+    }
+
+    template <GFXCORE_FAMILY gfxCoreFamily>
+    void initializeBatchingCmdList(MockCommandListImmediateHw<gfxCoreFamily> &cmdList) {
+        cmdList.isFlushTaskSubmissionEnabled = true;
+        cmdList.isSubmissionBatchingEnabled = true;
+        cmdList.cmdListType = CommandList::CommandListType::TYPE_IMMEDIATE;
+        cmdList.csr = device->getNEODevice()->getDefaultEngine().commandStreamReceiver;
+        cmdList.initialize(device, NEO::EngineGroupType::RenderCompute, 0u);
+        cmdList.commandContainer.setImmediateCmdListCsr(device->getNEODevice()->getDefaultEngine().commandStreamReceiver);
+    }
+
+    std::unique_ptr<::L0::EventPool> createHostVisibleEventPool() {
+        ze_event_pool_desc_t eventPoolDesc = {};
+        eventPoolDesc.count = 1;
+        eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+
+        ze_result_t returnValue;
+        auto eventPool = std::unique_ptr<::L0::EventPool>(::L0::EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, returnValue));
+        EXPECT_EQ(ZE_RESULT_SUCCESS, returnValue);
+        return eventPool;
+    }
+
+    DebugManagerStateRestore restorer;
+    Mock<Kernel> batchedKernel;
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+};
+
+using CommandListSubmissionBatchingTest = Test<CommandListSubmissionBatchingFixture>;
+
+HWTEST2_F(CommandListSubmissionBatchingTest, givenImmediateCommandListWithSubmissionBatchingWhenAppendingKernelsWithoutSignalEventThenSubmissionIsDeferredUntilNonBatchedAppend, IsAtLeastSkl) {
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    initializeBatchingCmdList(cmdList);
+
+    for (uint32_t i = 0; i < 3; i++) {
+        EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernel(batchedKernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    }
+    EXPECT_EQ(0u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_TRUE(cmdList.batchedSubmissionPending);
+    EXPECT_EQ(1u, driverHandle->batchedSubmissionCmdLists.count(&cmdList));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendBarrier(nullptr, 0, nullptr));
+    EXPECT_EQ(2u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_FALSE(cmdList.batchedSubmissionPending);
+}
+
+HWTEST2_F(CommandListSubmissionBatchingTest, givenImmediateCommandListWithSubmissionBatchingWhenBatchSizeThresholdIsReachedThenBatchIsFlushed, IsAtLeastSkl) {
+    NEO::DebugManager.flags.ExperimentalImmediateCmdListBatchingSizeThreshold.set(0);
+
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    initializeBatchingCmdList(cmdList);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernel(batchedKernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernel(batchedKernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(2u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_FALSE(cmdList.batchedSubmissionPending);
+    EXPECT_EQ(0u, driverHandle->batchedSubmissionCmdLists.size());
+}
+
+HWTEST2_F(CommandListSubmissionBatchingTest, givenSyncImmediateCommandListWithSubmissionBatchingWhenAppendingKernelThenSubmissionIsNotDeferred, IsAtLeastSkl) {
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    initializeBatchingCmdList(cmdList);
+    cmdList.isSyncModeQueue = true;
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernel(batchedKernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(1u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_FALSE(cmdList.batchedSubmissionPending);
+}
+
+HWTEST2_F(CommandListSubmissionBatchingTest, givenImmediateCommandListWithSubmissionBatchingWhenAppendingPrintfKernelAsFirstKernelThenSubmissionIsNotDeferred, IsAtLeastSkl) {
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    initializeBatchingCmdList(cmdList);
+    batchedKernel.descriptor.kernelAttributes.flags.usesPrintf = true;
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernel(batchedKernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(1u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_FALSE(cmdList.batchedSubmissionPending);
+    EXPECT_EQ(0u, driverHandle->batchedSubmissionCmdLists.size());
+}
+
+HWTEST2_F(CommandListSubmissionBatchingTest, givenImmediateCommandListWithPendingBatchedSubmissionWhenEventIsSignaledAndQueriedFromHostThenBatchIsFlushed, IsAtLeastSkl) {
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    initializeBatchingCmdList(cmdList);
+
+    auto eventPool = createHostVisibleEventPool();
+    ze_event_desc_t eventDesc = {};
+    auto event = std::unique_ptr<::L0::Event>(::L0::Event::create<typename FamilyType::TimestampPacketType>(eventPool.get(), &eventDesc, device));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernel(batchedKernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_TRUE(cmdList.batchedSubmissionPending);
+    EXPECT_EQ(1u, driverHandle->batchedSubmissionCmdLists.count(&cmdList));
+
+    EXPECT_EQ(ZE_RESULT_NOT_READY, event->queryStatus());
+    EXPECT_EQ(1u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_FALSE(cmdList.batchedSubmissionPending);
+    EXPECT_EQ(0u, driverHandle->batchedSubmissionCmdLists.size());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernel(batchedKernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_TRUE(cmdList.batchedSubmissionPending);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->hostSignal());
+    EXPECT_EQ(2u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_FALSE(cmdList.batchedSubmissionPending);
+    EXPECT_EQ(0u, driverHandle->batchedSubmissionCmdLists.size());
+}
+
+HWTEST2_F(CommandListSubmissionBatchingTest, givenPendingBatchedSubmissionWhenFlushFailsAtHostSynchronizationPointThenErrorIsReturned, IsAtLeastSkl) {
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    initializeBatchingCmdList(cmdList);
+
+    auto eventPool = createHostVisibleEventPool();
+    ze_event_desc_t eventDesc = {};
+    auto event = std::unique_ptr<::L0::Event>(::L0::Event::create<typename FamilyType::TimestampPacketType>(eventPool.get(), &eventDesc, device));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernel(batchedKernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    cmdList.executeCommandListImmediateWithFlushTaskReturnValue = ZE_RESULT_ERROR_DEVICE_LOST;
+    EXPECT_EQ(ZE_RESULT_ERROR_DEVICE_LOST, event->queryStatus());
+    EXPECT_FALSE(cmdList.batchedSubmissionPending);
+    EXPECT_EQ(0u, driverHandle->batchedSubmissionCmdLists.size());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernel(batchedKernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(ZE_RESULT_ERROR_DEVICE_LOST, cmdList.appendBarrier(nullptr, 0, nullptr));
+    EXPECT_FALSE(cmdList.batchedSubmissionPending);
+}
+
+HWTEST2_F(CommandListSubmissionBatchingTest, givenIdleCommandListWithExpiredBatchedSubmissionWhenOtherCommandListAppendsBatchedKernelThenExpiredBatchIsFlushed, IsAtLeastSkl) {
+    MockCommandListImmediateHw<gfxCoreFamily> idleCmdList;
+    initializeBatchingCmdList(idleCmdList);
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    initializeBatchingCmdList(cmdList);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, idleCmdList.appendLaunchKernel(batchedKernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernel(batchedKernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_TRUE(idleCmdList.batchedSubmissionPending);
+    EXPECT_TRUE(cmdList.batchedSubmissionPending);
+    EXPECT_EQ(2u, driverHandle->batchedSubmissionCmdLists.size());
+
+    NEO::DebugManager.flags.ExperimentalImmediateCmdListBatchingTimeThreshold.set(0);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernel(batchedKernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(1u, idleCmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_FALSE(idleCmdList.batchedSubmissionPending);
+    EXPECT_EQ(0u, driverHandle->batchedSubmissionCmdLists.count(&idleCmdList));
+}
+
+HWTEST2_F(CommandListSubmissionBatchingTest, givenImmediateCommandListWithSubmissionBatchingWhenAppendingKernelWithWaitEventsThenSubmissionIsNotDeferred, IsAtLeastSkl) {
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    initializeBatchingCmdList(cmdList);
+
+    auto eventPool = createHostVisibleEventPool();
+    ze_event_desc_t eventDesc = {};
+    auto event = std::unique_ptr<::L0::Event>(::L0::Event::create<typename FamilyType::TimestampPacketType>(eventPool.get(), &eventDesc, device));
+    auto waitEventHandle = event->toHandle();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernel(batchedKernel.toHandle(), &groupCount, nullptr, 1, &waitEventHandle, launchParams, false));
+    EXPECT_EQ(1u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_FALSE(cmdList.batchedSubmissionPending);
+    EXPECT_EQ(0u, driverHandle->batchedSubmissionCmdLists.size());
+}
+
 HWTEST2_F(CommandListAppendLaunchKernel, givenImmediateCommandListWhenAppendLaunchCooperativeKernelNotUsingFlushTaskThenExpectCorrectExecuteCall, IsAtLeastSkl) {
     createKernel();
     MockCommandListImmediateHw<gfxCoreFamily> cmdList;
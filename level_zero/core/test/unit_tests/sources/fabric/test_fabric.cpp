@@ -10,6 +10,7 @@
 #include "shared/test/common/mocks/mock_driver_model.h"
 #include "shared/test/common/test_macros/test.h"
 
+#include "level_zero/core/source/device/device_imp.h"
 #include "level_zero/core/source/fabric/fabric.h"
 #include "level_zero/core/source/fabric/fabric_device_interface.h"
 #include "level_zero/core/test/unit_tests/fixtures/device_fixture.h"
@@ -452,5 +453,132 @@ TEST_F(FabricEdgeFixture, GivenMdfiLinksAreAvailableWhenEdgesAreCreatedThenVerif
     EXPECT_FALSE(fabricDeviceMdfi->getEdgeProperty(driverHandle->fabricVertices[0]->subVertices[0], unusedProperty));
 }
 
+struct FabricRouteFixture : public Test<MultiDeviceFixture> {
+    void SetUp() override {
+        Test<MultiDeviceFixture>::SetUp();
+        uint32_t count = 0;
+        EXPECT_EQ(ZE_RESULT_SUCCESS, driverHandle->fabricVertexGetExp(&count, nullptr));
+        ASSERT_EQ(4u, driverHandle->fabricVertices.size());
+
+        for (auto edge : driverHandle->fabricEdges) {
+            delete edge;
+        }
+        driverHandle->fabricEdges.clear();
+        driverHandle->invalidateFabricRoutes();
+    }
+
+    void addEdge(FabricVertex *vertexA, FabricVertex *vertexB, uint32_t latency, uint32_t bandwidth) {
+        ze_fabric_edge_exp_properties_t properties = {};
+        properties.latency = latency;
+        properties.bandwidth = bandwidth;
+        driverHandle->fabricEdges.push_back(FabricEdge::create(vertexA, vertexB, properties));
+    }
+};
+
+TEST_F(FabricRouteFixture, GivenMultiHopPathWithLowerLatencyWhenGettingFabricRouteThenMultiHopPathIsReturned) {
+    auto &vertices = driverHandle->fabricVertices;
+    addEdge(vertices[0], vertices[1], 1, 10);
+    addEdge(vertices[1], vertices[2], 1, 20);
+    addEdge(vertices[0], vertices[2], 5, 50);
+
+    FabricRoute route;
+    EXPECT_TRUE(driverHandle->getFabricRoute(vertices[0], vertices[2], route));
+    ASSERT_EQ(3u, route.path.size());
+    EXPECT_EQ(vertices[0], route.path[0]);
+    EXPECT_EQ(vertices[1], route.path[1]);
+    EXPECT_EQ(vertices[2], route.path[2]);
+    EXPECT_EQ(2u, route.latency);
+    EXPECT_EQ(10u, route.bandwidth);
+
+    EXPECT_FALSE(driverHandle->getFabricRoute(vertices[0], vertices[3], route));
+    EXPECT_TRUE(route.path.empty());
+    EXPECT_EQ(2u, driverHandle->fabricRoutes.size());
+}
+
+TEST_F(FabricRouteFixture, GivenPathsWithEqualLatencyWhenGettingFabricRouteThenPathWithHigherBandwidthIsReturned) {
+    auto &vertices = driverHandle->fabricVertices;
+    addEdge(vertices[0], vertices[1], 1, 10);
+    addEdge(vertices[1], vertices[3], 1, 10);
+    addEdge(vertices[0], vertices[2], 1, 30);
+    addEdge(vertices[2], vertices[3], 1, 30);
+
+    FabricRoute route;
+    EXPECT_TRUE(driverHandle->getFabricRoute(vertices[0], vertices[3], route));
+    ASSERT_EQ(3u, route.path.size());
+    EXPECT_EQ(vertices[2], route.path[1]);
+    EXPECT_EQ(30u, route.bandwidth);
+}
+
+TEST_F(FabricRouteFixture, GivenEdgeBetweenSubVerticesWhenGettingFabricRouteThenRootVerticesAreConnected) {
+    auto &vertices = driverHandle->fabricVertices;
+    ASSERT_EQ(2u, vertices[0]->subVertices.size());
+    ASSERT_EQ(2u, vertices[1]->subVertices.size());
+    addEdge(vertices[0]->subVertices[0], vertices[0]->subVertices[1], 1, 10);
+    addEdge(vertices[0]->subVertices[1], vertices[1]->subVertices[0], 1, 10);
+
+    FabricRoute route;
+    EXPECT_TRUE(driverHandle->getFabricRoute(vertices[0], vertices[1], route));
+    ASSERT_EQ(2u, route.path.size());
+    EXPECT_EQ(vertices[0], route.path[0]);
+    EXPECT_EQ(vertices[1], route.path[1]);
+
+    EXPECT_FALSE(driverHandle->getFabricRoute(vertices[0], vertices[0], route));
+}
+
+TEST_F(FabricRouteFixture, GivenCachedRouteWhenFabricRoutesAreInvalidatedThenRouteIsRecomputedFromCurrentEdges) {
+    auto &vertices = driverHandle->fabricVertices;
+    FabricRoute route;
+    EXPECT_FALSE(driverHandle->getFabricRoute(vertices[0], vertices[1], route));
+
+    addEdge(vertices[0], vertices[1], 1, 10);
+    EXPECT_FALSE(driverHandle->getFabricRoute(vertices[0], vertices[1], route));
+
+    driverHandle->invalidateFabricRoutes();
+    EXPECT_TRUE(driverHandle->fabricRoutes.empty());
+    EXPECT_TRUE(driverHandle->getFabricRoute(vertices[0], vertices[1], route));
+    EXPECT_EQ(2u, route.path.size());
+}
+
+TEST_F(FabricRouteFixture, GivenDirectFabricEdgeBetweenDevicesWhenCallingCanAccessPeerThenAccessIsReported) {
+    auto &vertices = driverHandle->fabricVertices;
+    addEdge(vertices[0], vertices[1], 1, 10);
+
+    auto device0 = static_cast<DeviceImp *>(driverHandle->devices[0]);
+    auto device1 = static_cast<DeviceImp *>(driverHandle->devices[1]);
+    EXPECT_TRUE(device0->hasDirectFabricConnectionToPeer(device1));
+
+    ze_bool_t canAccess = false;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, device0->canAccessPeer(device1->toHandle(), &canAccess));
+    EXPECT_TRUE(canAccess);
+}
+
+TEST_F(FabricRouteFixture, GivenOnlyMultiHopFabricRouteBetweenDevicesWhenCheckingDirectFabricConnectionThenFalseIsReturned) {
+    auto &vertices = driverHandle->fabricVertices;
+    addEdge(vertices[0], vertices[1], 1, 10);
+    addEdge(vertices[1], vertices[2], 1, 10);
+
+    auto device0 = static_cast<DeviceImp *>(driverHandle->devices[0]);
+    auto device1 = static_cast<DeviceImp *>(driverHandle->devices[1]);
+    auto device2 = static_cast<DeviceImp *>(driverHandle->devices[2]);
+    EXPECT_TRUE(device0->hasDirectFabricConnectionToPeer(device1));
+    EXPECT_FALSE(device0->hasDirectFabricConnectionToPeer(device2));
+}
+
+TEST_F(FabricRouteFixture, GivenDirectFabricEdgeAndFasterMultiHopRouteWhenCheckingDirectFabricConnectionThenTrueIsReturned) {
+    auto &vertices = driverHandle->fabricVertices;
+    addEdge(vertices[0], vertices[1], 1, 10);
+    addEdge(vertices[1], vertices[2], 1, 10);
+    addEdge(vertices[0], vertices[2], 10, 5);
+
+    FabricRoute route;
+    EXPECT_TRUE(driverHandle->getFabricRoute(vertices[0], vertices[2], route));
+    EXPECT_EQ(3u, route.path.size());
+
+    auto device0 = static_cast<DeviceImp *>(driverHandle->devices[0]);
+    auto device2 = static_cast<DeviceImp *>(driverHandle->devices[2]);
+    EXPECT_TRUE(device0->hasDirectFabricConnectionToPeer(device2));
+    EXPECT_EQ(driverHandle->fabricEdges.back(), driverHandle->getDirectFabricEdge(vertices[2], vertices[0]));
+}
+
 } // namespace ult
 } // namespace L0
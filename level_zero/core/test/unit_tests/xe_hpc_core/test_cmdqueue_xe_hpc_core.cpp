@@ -1225,5 +1225,364 @@ HWTEST2_F(CommandQueueCommandsXeHpc, givenSplitBcsCopyAndImmediateCommandListWhe
     context->freeMem(dstPtr);
 }
 
+HWTEST2_F(CommandQueueCommandsXeHpc, givenSplitBcsMinChunkSizeWhenAppendingMemoryCopyThenEngineCountIsLimitedAndLeastLoadedEnginesAreSelected, IsXeHpcCore) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.SplitBcsCopy.set(1);
+    DebugManager.flags.SplitBcsMinChunkSize.set(4 * MemoryConstants::megaByte);
+    DebugManager.flags.EnableFlushTaskSubmission.set(0);
+
+    ze_result_t returnValue;
+    auto hwInfo = *NEO::defaultHwInfo;
+    hwInfo.featureTable.ftrBcsInfo = 0b111111111;
+    hwInfo.capabilityTable.blitterOperationsSupported = true;
+    auto testNeoDevice = NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(&hwInfo);
+    auto testL0Device = std::unique_ptr<L0::Device>(L0::Device::create(driverHandle.get(), testNeoDevice, false, &returnValue));
+
+    ze_command_queue_desc_t desc = {};
+    desc.ordinal = static_cast<uint32_t>(testNeoDevice->getEngineGroupIndexFromEngineGroupType(NEO::EngineGroupType::Copy));
+
+    std::unique_ptr<L0::CommandList> commandList0(CommandList::createImmediate(productFamily,
+                                                                               testL0Device.get(),
+                                                                               &desc,
+                                                                               false,
+                                                                               NEO::EngineGroupType::Copy,
+                                                                               returnValue));
+    ASSERT_NE(nullptr, commandList0);
+    auto &bcsSplit = static_cast<DeviceImp *>(testL0Device.get())->bcsSplit;
+    EXPECT_EQ(bcsSplit.cmdQs.size(), 4u);
+
+    constexpr size_t alignment = 4096u;
+    constexpr size_t size = 8 * MemoryConstants::megaByte;
+    void *srcPtr;
+    void *dstPtr;
+    ze_host_mem_alloc_desc_t hostDesc = {};
+    context->allocHostMem(&hostDesc, size, alignment, &srcPtr);
+    context->allocHostMem(&hostDesc, size, alignment, &dstPtr);
+
+    for (auto &cmdQ : bcsSplit.cmdQs) {
+        *static_cast<CommandQueueImp *>(cmdQ)->getCsr()->getTagAddress() = 0u;
+    }
+
+    auto result = commandList0->appendMemoryCopy(dstPtr, srcPtr, size, nullptr, 0, nullptr, false);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(static_cast<CommandQueueImp *>(bcsSplit.cmdQs[0])->getTaskCount(), 1u);
+    EXPECT_EQ(static_cast<CommandQueueImp *>(bcsSplit.cmdQs[1])->getTaskCount(), 1u);
+    EXPECT_EQ(static_cast<CommandQueueImp *>(bcsSplit.cmdQs[2])->getTaskCount(), 0u);
+    EXPECT_EQ(static_cast<CommandQueueImp *>(bcsSplit.cmdQs[3])->getTaskCount(), 0u);
+    EXPECT_EQ(bcsSplit.getSubmittedBytes(0u), 4 * MemoryConstants::megaByte);
+    EXPECT_EQ(bcsSplit.getSubmittedBytes(1u), 4 * MemoryConstants::megaByte);
+    EXPECT_EQ(bcsSplit.getOutstandingBytes(0u), 4 * MemoryConstants::megaByte);
+    EXPECT_EQ(bcsSplit.getOutstandingBytes(2u), 0u);
+
+    result = commandList0->appendMemoryCopy(dstPtr, srcPtr, size, nullptr, 0, nullptr, false);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(static_cast<CommandQueueImp *>(bcsSplit.cmdQs[0])->getTaskCount(), 1u);
+    EXPECT_EQ(static_cast<CommandQueueImp *>(bcsSplit.cmdQs[1])->getTaskCount(), 1u);
+    EXPECT_EQ(static_cast<CommandQueueImp *>(bcsSplit.cmdQs[2])->getTaskCount(), 1u);
+    EXPECT_EQ(static_cast<CommandQueueImp *>(bcsSplit.cmdQs[3])->getTaskCount(), 1u);
+
+    *static_cast<CommandQueueImp *>(bcsSplit.cmdQs[0])->getCsr()->getTagAddress() = 1u;
+    EXPECT_EQ(bcsSplit.getOutstandingBytes(0u), 0u);
+    EXPECT_EQ(bcsSplit.getSubmittedBytes(0u), 4 * MemoryConstants::megaByte);
+
+    context->freeMem(srcPtr);
+    context->freeMem(dstPtr);
+}
+
+HWTEST2_F(CommandQueueCommandsXeHpc, givenSplitBcsCopyWhenAppendingMemoryCopyWithUnalignedSizeThenSplitPointsArePageAligned, IsXeHpcCore) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.SplitBcsCopy.set(1);
+    DebugManager.flags.EnableFlushTaskSubmission.set(0);
+
+    ze_result_t returnValue;
+    auto hwInfo = *NEO::defaultHwInfo;
+    hwInfo.featureTable.ftrBcsInfo = 0b111111111;
+    hwInfo.capabilityTable.blitterOperationsSupported = true;
+    auto testNeoDevice = NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(&hwInfo);
+    auto testL0Device = std::unique_ptr<L0::Device>(L0::Device::create(driverHandle.get(), testNeoDevice, false, &returnValue));
+
+    ze_command_queue_desc_t desc = {};
+    desc.ordinal = static_cast<uint32_t>(testNeoDevice->getEngineGroupIndexFromEngineGroupType(NEO::EngineGroupType::Copy));
+
+    std::unique_ptr<L0::CommandList> commandList0(CommandList::createImmediate(productFamily,
+                                                                               testL0Device.get(),
+                                                                               &desc,
+                                                                               false,
+                                                                               NEO::EngineGroupType::Copy,
+                                                                               returnValue));
+    ASSERT_NE(nullptr, commandList0);
+    auto &bcsSplit = static_cast<DeviceImp *>(testL0Device.get())->bcsSplit;
+    EXPECT_EQ(bcsSplit.cmdQs.size(), 4u);
+
+    constexpr size_t alignment = 4096u;
+    constexpr size_t size = 8 * MemoryConstants::megaByte + 3;
+    void *srcPtr;
+    void *dstPtr;
+    ze_host_mem_alloc_desc_t hostDesc = {};
+    context->allocHostMem(&hostDesc, size, alignment, &srcPtr);
+    context->allocHostMem(&hostDesc, size, alignment, &dstPtr);
+
+    auto result = commandList0->appendMemoryCopy(dstPtr, srcPtr, size, nullptr, 0, nullptr, false);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(bcsSplit.getSubmittedBytes(0u), 2 * MemoryConstants::megaByte);
+    EXPECT_EQ(bcsSplit.getSubmittedBytes(1u), 2 * MemoryConstants::megaByte);
+    EXPECT_EQ(bcsSplit.getSubmittedBytes(2u), 2 * MemoryConstants::megaByte);
+    EXPECT_EQ(bcsSplit.getSubmittedBytes(3u), 2 * MemoryConstants::megaByte + 3);
+
+    context->freeMem(srcPtr);
+    context->freeMem(dstPtr);
+}
+
+HWTEST2_F(CommandQueueCommandsXeHpc, givenSplitBcsCopyWhenAppendingMemoryCopyToUnalignedDestinationThenSplitPointsArePageAlignedInAddressSpace, IsXeHpcCore) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.SplitBcsCopy.set(1);
+    DebugManager.flags.EnableFlushTaskSubmission.set(0);
+
+    ze_result_t returnValue;
+    auto hwInfo = *NEO::defaultHwInfo;
+    hwInfo.featureTable.ftrBcsInfo = 0b111111111;
+    hwInfo.capabilityTable.blitterOperationsSupported = true;
+    auto testNeoDevice = NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(&hwInfo);
+    auto testL0Device = std::unique_ptr<L0::Device>(L0::Device::create(driverHandle.get(), testNeoDevice, false, &returnValue));
+
+    ze_command_queue_desc_t desc = {};
+    desc.ordinal = static_cast<uint32_t>(testNeoDevice->getEngineGroupIndexFromEngineGroupType(NEO::EngineGroupType::Copy));
+
+    std::unique_ptr<L0::CommandList> commandList0(CommandList::createImmediate(productFamily,
+                                                                               testL0Device.get(),
+                                                                               &desc,
+                                                                               false,
+                                                                               NEO::EngineGroupType::Copy,
+                                                                               returnValue));
+    ASSERT_NE(nullptr, commandList0);
+    auto &bcsSplit = static_cast<DeviceImp *>(testL0Device.get())->bcsSplit;
+    EXPECT_EQ(bcsSplit.cmdQs.size(), 4u);
+
+    constexpr size_t alignment = 4096u;
+    constexpr size_t dstOffset = 256u;
+    constexpr size_t size = 8 * MemoryConstants::megaByte;
+    void *srcPtr;
+    void *dstPtr;
+    ze_host_mem_alloc_desc_t hostDesc = {};
+    context->allocHostMem(&hostDesc, size, alignment, &srcPtr);
+    context->allocHostMem(&hostDesc, size + dstOffset, alignment, &dstPtr);
+
+    auto result = commandList0->appendMemoryCopy(ptrOffset(dstPtr, dstOffset), srcPtr, size, nullptr, 0, nullptr, false);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(bcsSplit.getSubmittedBytes(0u), 2 * MemoryConstants::megaByte - dstOffset);
+    EXPECT_EQ(bcsSplit.getSubmittedBytes(1u), 2 * MemoryConstants::megaByte);
+    EXPECT_EQ(bcsSplit.getSubmittedBytes(2u), 2 * MemoryConstants::megaByte);
+    EXPECT_EQ(bcsSplit.getSubmittedBytes(3u), 2 * MemoryConstants::megaByte + dstOffset);
+
+    context->freeMem(srcPtr);
+    context->freeMem(dstPtr);
+}
+
+HWTEST2_F(CommandQueueCommandsXeHpc, givenSplitBcsCopyUsingAllEnginesWhenSubmissionsCompleteThenTheyAreRetiredOnNextSubmission, IsXeHpcCore) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.SplitBcsCopy.set(1);
+    DebugManager.flags.EnableFlushTaskSubmission.set(0);
+
+    ze_result_t returnValue;
+    auto hwInfo = *NEO::defaultHwInfo;
+    hwInfo.featureTable.ftrBcsInfo = 0b111111111;
+    hwInfo.capabilityTable.blitterOperationsSupported = true;
+    auto testNeoDevice = NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(&hwInfo);
+    auto testL0Device = std::unique_ptr<L0::Device>(L0::Device::create(driverHandle.get(), testNeoDevice, false, &returnValue));
+
+    ze_command_queue_desc_t desc = {};
+    desc.ordinal = static_cast<uint32_t>(testNeoDevice->getEngineGroupIndexFromEngineGroupType(NEO::EngineGroupType::Copy));
+
+    std::unique_ptr<L0::CommandList> commandList0(CommandList::createImmediate(productFamily,
+                                                                               testL0Device.get(),
+                                                                               &desc,
+                                                                               false,
+                                                                               NEO::EngineGroupType::Copy,
+                                                                               returnValue));
+    ASSERT_NE(nullptr, commandList0);
+    auto &bcsSplit = static_cast<DeviceImp *>(testL0Device.get())->bcsSplit;
+    EXPECT_EQ(bcsSplit.cmdQs.size(), 4u);
+
+    constexpr size_t alignment = 4096u;
+    constexpr size_t size = 8 * MemoryConstants::megaByte;
+    void *srcPtr;
+    void *dstPtr;
+    ze_host_mem_alloc_desc_t hostDesc = {};
+    context->allocHostMem(&hostDesc, size, alignment, &srcPtr);
+    context->allocHostMem(&hostDesc, size, alignment, &dstPtr);
+
+    for (uint32_t i = 0; i < 3; i++) {
+        for (auto &cmdQ : bcsSplit.cmdQs) {
+            auto csr = static_cast<CommandQueueImp *>(cmdQ)->getCsr();
+            *csr->getTagAddress() = csr->peekTaskCount();
+        }
+        auto result = commandList0->appendMemoryCopy(dstPtr, srcPtr, size, nullptr, 0, nullptr, false);
+        ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    }
+
+    for (auto &engineLoad : bcsSplit.engineLoads) {
+        EXPECT_EQ(1u, engineLoad.inFlight.size());
+        EXPECT_EQ(2 * MemoryConstants::megaByte, engineLoad.outstandingBytes);
+        EXPECT_EQ(6 * MemoryConstants::megaByte, engineLoad.submittedBytes);
+    }
+
+    context->freeMem(srcPtr);
+    context->freeMem(dstPtr);
+}
+
+HWTEST2_F(CommandQueueCommandsXeHpc, givenSplitBcsCopyAndImmediateCommandListWhenAppendingMemoryFillToDeviceMemoryThenFillIsSplitOnAllEngines, IsXeHpcCore) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.SplitBcsCopy.set(1);
+    DebugManager.flags.EnableFlushTaskSubmission.set(0);
+
+    ze_result_t returnValue;
+    auto hwInfo = *NEO::defaultHwInfo;
+    hwInfo.featureTable.ftrBcsInfo = 0b111111111;
+    hwInfo.capabilityTable.blitterOperationsSupported = true;
+    auto testNeoDevice = NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(&hwInfo);
+    auto testL0Device = std::unique_ptr<L0::Device>(L0::Device::create(driverHandle.get(), testNeoDevice, false, &returnValue));
+
+    ze_command_queue_desc_t desc = {};
+    desc.ordinal = static_cast<uint32_t>(testNeoDevice->getEngineGroupIndexFromEngineGroupType(NEO::EngineGroupType::Copy));
+
+    std::unique_ptr<L0::CommandList> commandList0(CommandList::createImmediate(productFamily,
+                                                                               testL0Device.get(),
+                                                                               &desc,
+                                                                               false,
+                                                                               NEO::EngineGroupType::Copy,
+                                                                               returnValue));
+    ASSERT_NE(nullptr, commandList0);
+    auto &bcsSplit = static_cast<DeviceImp *>(testL0Device.get())->bcsSplit;
+    EXPECT_EQ(bcsSplit.cmdQs.size(), 4u);
+
+    constexpr size_t alignment = 4096u;
+    constexpr size_t size = 8 * MemoryConstants::megaByte;
+    void *dstPtr;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    context->allocDeviceMem(device->toHandle(), &deviceDesc, size, alignment, &dstPtr);
+    uint32_t pattern = 0xABCDu;
+
+    auto result = commandList0->appendMemoryFill(dstPtr, &pattern, sizeof(pattern), size, nullptr, 0, nullptr, false);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    for (size_t i = 0; i < bcsSplit.cmdQs.size(); i++) {
+        EXPECT_EQ(static_cast<CommandQueueImp *>(bcsSplit.cmdQs[i])->getTaskCount(), 1u);
+        EXPECT_EQ(bcsSplit.getSubmittedBytes(i), 2 * MemoryConstants::megaByte);
+    }
+
+    context->freeMem(dstPtr);
+}
+
+HWTEST2_F(CommandQueueCommandsXeHpc, givenSplitBcsMinChunkSizeWhenGettingEngineCountForSplitThenCountIsLimitedByTransferSizeAndAvailableEngines, IsXeHpcCore) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.SplitBcsCopy.set(1);
+    DebugManager.flags.SplitBcsMinChunkSize.set(4 * MemoryConstants::megaByte);
+
+    ze_result_t returnValue;
+    auto hwInfo = *NEO::defaultHwInfo;
+    hwInfo.featureTable.ftrBcsInfo = 0b111111111;
+    hwInfo.capabilityTable.blitterOperationsSupported = true;
+    auto testNeoDevice = NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(&hwInfo);
+    auto testL0Device = std::unique_ptr<L0::Device>(L0::Device::create(driverHandle.get(), testNeoDevice, false, &returnValue));
+
+    ze_command_queue_desc_t desc = {};
+    desc.ordinal = static_cast<uint32_t>(testNeoDevice->getEngineGroupIndexFromEngineGroupType(NEO::EngineGroupType::Copy));
+
+    std::unique_ptr<L0::CommandList> commandList0(CommandList::createImmediate(productFamily,
+                                                                               testL0Device.get(),
+                                                                               &desc,
+                                                                               false,
+                                                                               NEO::EngineGroupType::Copy,
+                                                                               returnValue));
+    ASSERT_NE(nullptr, commandList0);
+    auto &bcsSplit = static_cast<DeviceImp *>(testL0Device.get())->bcsSplit;
+    EXPECT_EQ(bcsSplit.cmdQs.size(), 4u);
+
+    EXPECT_EQ(1u, bcsSplit.getEngineCountForSplit(NEO::TransferDirection::LocalToLocal, 1u));
+    EXPECT_EQ(2u, bcsSplit.getEngineCountForSplit(NEO::TransferDirection::LocalToLocal, 8 * MemoryConstants::megaByte));
+    EXPECT_EQ(4u, bcsSplit.getEngineCountForSplit(NEO::TransferDirection::LocalToLocal, 64 * MemoryConstants::megaByte));
+}
+
+HWTEST2_F(CommandQueueCommandsXeHpc, givenCopyRegionWhenGettingSplitDimensionThenOutermostDimensionWithEnoughExtentIsReturned, IsXeHpcCore) {
+    ze_result_t returnValue;
+    auto hwInfo = *NEO::defaultHwInfo;
+    hwInfo.featureTable.ftrBcsInfo = 0b111111111;
+    hwInfo.capabilityTable.blitterOperationsSupported = true;
+    auto testNeoDevice = NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(&hwInfo);
+    auto testL0Device = std::unique_ptr<L0::Device>(L0::Device::create(driverHandle.get(), testNeoDevice, false, &returnValue));
+
+    ze_command_queue_desc_t desc = {};
+    desc.ordinal = static_cast<uint32_t>(testNeoDevice->getEngineGroupIndexFromEngineGroupType(NEO::EngineGroupType::Copy));
+
+    std::unique_ptr<L0::CommandList> commandList0(CommandList::createImmediate(productFamily,
+                                                                               testL0Device.get(),
+                                                                               &desc,
+                                                                               false,
+                                                                               NEO::EngineGroupType::Copy,
+                                                                               returnValue));
+    ASSERT_NE(nullptr, commandList0);
+    auto immediateCmdList = static_cast<CommandListCoreFamilyImmediate<gfxCoreFamily> *>(commandList0.get());
+
+    ze_copy_region_t region3D = {0, 0, 0, 1024, 16, 4};
+    EXPECT_EQ(2u, immediateCmdList->getCopyRegionSplitDimension(&region3D, 4u));
+    EXPECT_EQ(1u, immediateCmdList->getCopyRegionSplitDimension(&region3D, 8u));
+
+    ze_copy_region_t region2D = {0, 0, 0, 1024, 2, 1};
+    EXPECT_EQ(1u, immediateCmdList->getCopyRegionSplitDimension(&region2D, 2u));
+    EXPECT_EQ(0u, immediateCmdList->getCopyRegionSplitDimension(&region2D, 4u));
+
+    ze_copy_region_t region1D = {0, 0, 0, 1, 1, 1};
+    EXPECT_EQ(0u, immediateCmdList->getCopyRegionSplitDimension(&region1D, 4u));
+}
+
+HWTEST2_F(CommandQueueCommandsXeHpc, givenSplitBcsCopyAndImmediateCommandListWhenAppendingMemoryCopyRegionWithDepthThenSlicesAreSplitBetweenEngines, IsXeHpcCore) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.SplitBcsCopy.set(1);
+    DebugManager.flags.EnableFlushTaskSubmission.set(0);
+
+    ze_result_t returnValue;
+    auto hwInfo = *NEO::defaultHwInfo;
+    hwInfo.featureTable.ftrBcsInfo = 0b111111111;
+    hwInfo.capabilityTable.blitterOperationsSupported = true;
+    auto testNeoDevice = NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(&hwInfo);
+    auto testL0Device = std::unique_ptr<L0::Device>(L0::Device::create(driverHandle.get(), testNeoDevice, false, &returnValue));
+
+    ze_command_queue_desc_t desc = {};
+    desc.ordinal = static_cast<uint32_t>(testNeoDevice->getEngineGroupIndexFromEngineGroupType(NEO::EngineGroupType::Copy));
+
+    std::unique_ptr<L0::CommandList> commandList0(CommandList::createImmediate(productFamily,
+                                                                               testL0Device.get(),
+                                                                               &desc,
+                                                                               false,
+                                                                               NEO::EngineGroupType::Copy,
+                                                                               returnValue));
+    ASSERT_NE(nullptr, commandList0);
+    auto &bcsSplit = static_cast<DeviceImp *>(testL0Device.get())->bcsSplit;
+    EXPECT_EQ(bcsSplit.cmdQs.size(), 4u);
+
+    constexpr size_t alignment = 4096u;
+    constexpr size_t size = 8 * MemoryConstants::megaByte;
+    void *srcPtr;
+    void *dstPtr;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    context->allocDeviceMem(device->toHandle(), &deviceDesc, size, alignment, &dstPtr);
+    ze_host_mem_alloc_desc_t hostDesc = {};
+    context->allocHostMem(&hostDesc, size, alignment, &srcPtr);
+    constexpr uint32_t width = 2 * MemoryConstants::kiloByte;
+    constexpr uint32_t height = 512;
+    ze_copy_region_t region = {0, 0, 0, width, height, 4};
+
+    auto result = commandList0->appendMemoryCopyRegion(dstPtr, &region, width, width * height, srcPtr, &region, width, width * height, nullptr, 0, nullptr, false);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(static_cast<CommandQueueImp *>(bcsSplit.cmdQs[0])->getTaskCount(), 0u);
+    EXPECT_EQ(static_cast<CommandQueueImp *>(bcsSplit.cmdQs[1])->getTaskCount(), 1u);
+    EXPECT_EQ(static_cast<CommandQueueImp *>(bcsSplit.cmdQs[2])->getTaskCount(), 0u);
+    EXPECT_EQ(static_cast<CommandQueueImp *>(bcsSplit.cmdQs[3])->getTaskCount(), 1u);
+    EXPECT_EQ(bcsSplit.getSubmittedBytes(1u), 2u * width * height);
+    EXPECT_EQ(bcsSplit.getSubmittedBytes(3u), 2u * width * height);
+
+    context->freeMem(srcPtr);
+    context->freeMem(dstPtr);
+}
+
 } // namespace ult
 } // namespace L0
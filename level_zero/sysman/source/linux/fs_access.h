@@ -15,17 +15,44 @@
 #include <fstream>
 #include <iostream>
 #include <list>
+#include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <sys/stat.h>
 #include <sys/sysmacros.h>
 #include <sys/types.h>
 #include <unistd.h>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace L0 {
 namespace Sysman {
 
+// Keeps frequently polled files open and rereads them from offset 0, values of immutable files are read once.
+// At most maxOpenFiles descriptors are kept, the least recently read one is closed first.
+class PersistentFileReader {
+  public:
+    ~PersistentFileReader();
+    ze_result_t read(const std::string &file, std::string &val);
+    void markImmutable(const std::string &file);
+
+    static constexpr size_t maxOpenFiles = 128;
+
+  protected:
+    using LruList = std::list<std::string>;
+
+    void closeFile(std::unordered_map<std::string, std::pair<int, LruList::iterator>>::iterator openFile);
+    void keepFileOpen(const std::string &file, int fd);
+
+    std::mutex mutex;
+    LruList lruFiles;
+    std::unordered_map<std::string, std::pair<int, LruList::iterator>> openFiles;
+    std::unordered_set<std::string> immutableFiles;
+    std::unordered_map<std::string, std::string> immutableValues;
+};
+
 class FsAccess {
   public:
     static FsAccess *create();
@@ -52,9 +79,11 @@ class FsAccess {
     std::string getDirName(const std::string path);
     virtual bool fileExists(const std::string file);
     virtual bool directoryExists(const std::string path);
+    void markImmutable(const std::string file);
 
   protected:
     FsAccess();
+    std::shared_ptr<PersistentFileReader> persistentFileReader;
     decltype(&NEO::SysCalls::access) accessSyscall = NEO::SysCalls::access;
     decltype(&stat) statSyscall = stat;
 };
@@ -114,6 +143,7 @@ class SysfsAccess : protected FsAccess {
     MOCKABLE_VIRTUAL bool isMyDeviceFile(const std::string dev);
     bool directoryExists(const std::string path) override;
     bool isRootUser() override;
+    void markImmutable(const std::string file);
 
   protected:
     std::vector<std::string> deviceNames;
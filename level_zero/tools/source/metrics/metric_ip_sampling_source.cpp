@@ -16,7 +16,9 @@
 #include "level_zero/tools/source/metrics/os_metric_ip_sampling.h"
 #include <level_zero/zet_api.h>
 
+#include <algorithm>
 #include <cstring>
+#include <thread>
 
 namespace L0 {
 constexpr uint32_t ipSamplinMetricCount = 10u;
@@ -336,14 +338,46 @@ ze_result_t IpSamplingMetricGroupImp::getCalculatedMetricValues(const zet_metric
 
     const uint32_t rawReportCount = static_cast<uint32_t>(rawDataSize) / rawReportSize;
 
-    for (const uint8_t *pRawIpData = pRawData; pRawIpData < pRawData + (rawReportCount * rawReportSize); pRawIpData += rawReportSize) {
-        dataOverflow |= stallIpDataMapUpdate(stallSumIpDataMap, pRawIpData);
+    auto aggregateReports = [this, pRawData, rawReportSize](StallSumIpDataMap_t &ipDataMap, uint32_t firstReport, uint32_t reportCount) {
+        bool overflow = false;
+        const uint8_t *pRawIpDataEnd = pRawData + (static_cast<size_t>(firstReport) + reportCount) * rawReportSize;
+        for (const uint8_t *pRawIpData = pRawData + static_cast<size_t>(firstReport) * rawReportSize; pRawIpData < pRawIpDataEnd; pRawIpData += rawReportSize) {
+            overflow |= stallIpDataMapUpdate(ipDataMap, pRawIpData);
+        }
+        return overflow;
+    };
+
+    const uint32_t aggregationThreadCount = std::min({std::max(std::thread::hardware_concurrency(), 1u),
+                                                      rawReportCount / minReportsPerAggregationThread,
+                                                      maxAggregationThreads});
+    if (aggregationThreadCount <= 1) {
+        dataOverflow = aggregateReports(stallSumIpDataMap, 0, rawReportCount);
+    } else {
+        // Large buffers are split into partitions aggregated in parallel and merged afterwards
+        std::vector<StallSumIpDataMap_t> partitionMaps(aggregationThreadCount);
+        std::vector<uint8_t> partitionOverflows(aggregationThreadCount, 0);
+        std::vector<std::thread> aggregationThreads;
+        const uint32_t reportsPerPartition = rawReportCount / aggregationThreadCount;
+        for (uint32_t partition = 0; partition < aggregationThreadCount; partition++) {
+            const uint32_t firstReport = partition * reportsPerPartition;
+            const uint32_t reportCount = (partition + 1 == aggregationThreadCount) ? rawReportCount - firstReport : reportsPerPartition;
+            aggregationThreads.emplace_back([&, partition, firstReport, reportCount]() {
+                partitionOverflows[partition] = aggregateReports(partitionMaps[partition], firstReport, reportCount);
+            });
+        }
+        for (uint32_t partition = 0; partition < aggregationThreadCount; partition++) {
+            aggregationThreads[partition].join();
+            stallSumIpDataMap.merge(partitionMaps[partition]);
+            dataOverflow |= (partitionOverflows[partition] != 0);
+        }
     }
 
     metricValueCount = std::min<uint32_t>(metricValueCount, static_cast<uint32_t>(stallSumIpDataMap.size()) * properties.metricCount);
+    std::vector<std::pair<uint64_t, StallSumIpData_t>> sortedIpData;
+    stallSumIpDataMap.getSortedEntries(sortedIpData);
     std::vector<zet_typed_value_t> ipDataValues;
     uint32_t i = 0;
-    for (auto it = stallSumIpDataMap.begin(); it != stallSumIpDataMap.end(); ++it) {
+    for (auto it = sortedIpData.begin(); it != sortedIpData.end(); ++it) {
         stallSumIpDataToTypedValues(it->first, it->second, ipDataValues);
         for (auto jt = ipDataValues.begin(); (jt != ipDataValues.end()) && (i < metricValueCount); jt++, i++) {
             *(pCalculatedData + i) = *jt;
@@ -376,43 +410,102 @@ ze_result_t IpSamplingMetricGroupImp::getCalculatedMetricValues(const zet_metric
  */
 bool IpSamplingMetricGroupImp::stallIpDataMapUpdate(StallSumIpDataMap_t &stallSumIpDataMap, const uint8_t *pRawIpData) {
 
-    const uint8_t *tempAddr = pRawIpData;
-    uint64_t ip = 0ULL;
-    memcpy_s(reinterpret_cast<uint8_t *>(&ip), sizeof(ip), tempAddr, sizeof(ip));
-    ip &= 0x1fffffff;
+    uint64_t rawLow = 0ULL;
+    uint64_t rawHigh = 0ULL;
+    memcpy_s(reinterpret_cast<uint8_t *>(&rawLow), sizeof(rawLow), pRawIpData, sizeof(rawLow));
+    memcpy_s(reinterpret_cast<uint8_t *>(&rawHigh), sizeof(rawHigh), pRawIpData + sizeof(rawLow), sizeof(rawHigh));
+    uint64_t ip = rawLow & 0x1fffffff;
     StallSumIpData_t &stallSumData = stallSumIpDataMap[ip];
-    tempAddr += 3;
-
-    auto getCount = [&tempAddr]() {
-        uint16_t tempCount = 0;
-        memcpy_s(reinterpret_cast<uint8_t *>(&tempCount), sizeof(tempCount), tempAddr, sizeof(tempCount));
-        tempCount = (tempCount >> 5) & 0xff;
-        tempAddr += 1;
-        return static_cast<uint8_t>(tempCount);
+
+    // The first eight counts are consecutive bytes once bits 29 to 92 are shifted into a single word
+    const uint64_t counts = (rawLow >> 29) | (rawHigh << 35);
+    auto getCount = [counts](uint32_t countIndex) {
+        return (counts >> (countIndex * 8)) & 0xff;
     };
 
-    stallSumData.activeCount += getCount();
-    stallSumData.otherCount += getCount();
-    stallSumData.controlCount += getCount();
-    stallSumData.pipeStallCount += getCount();
-    stallSumData.sendCount += getCount();
-    stallSumData.distAccCount += getCount();
-    stallSumData.sbidCount += getCount();
-    stallSumData.syncCount += getCount();
-    stallSumData.instFetchCount += getCount();
+    stallSumData.activeCount += getCount(0);
+    stallSumData.otherCount += getCount(1);
+    stallSumData.controlCount += getCount(2);
+    stallSumData.pipeStallCount += getCount(3);
+    stallSumData.sendCount += getCount(4);
+    stallSumData.distAccCount += getCount(5);
+    stallSumData.sbidCount += getCount(6);
+    stallSumData.syncCount += getCount(7);
+    stallSumData.instFetchCount += (rawHigh >> 29) & 0xff;
 
     struct stallCntrInfo {
         uint16_t subslice;
         uint16_t flags;
     } stallCntrInfo = {};
 
-    tempAddr = pRawIpData + 48;
+    const uint8_t *tempAddr = pRawIpData + 48;
     memcpy_s(reinterpret_cast<uint8_t *>(&stallCntrInfo), sizeof(stallCntrInfo), tempAddr, sizeof(stallCntrInfo));
 
     constexpr int overflowDropFlag = (1 << 8);
     return stallCntrInfo.flags & overflowDropFlag;
 }
 
+StallSumIpData_t &StallSumIpDataMap::operator[](uint64_t ip) {
+    if ((entryCount + 1) * 2 > entries.size()) {
+        grow();
+    }
+    const size_t mask = entries.size() - 1;
+    for (size_t slot = static_cast<size_t>(ip * 0x9e3779b97f4a7c15ULL >> 32) & mask;; slot = (slot + 1) & mask) {
+        auto &entry = entries[slot];
+        if (!entry.used) {
+            entry.used = true;
+            entry.ip = ip;
+            entry.data = {};
+            entryCount++;
+            return entry.data;
+        }
+        if (entry.ip == ip) {
+            return entry.data;
+        }
+    }
+}
+
+void StallSumIpDataMap::grow() {
+    std::vector<Entry> oldEntries(std::max(initialCapacity, entries.size() * 2));
+    oldEntries.swap(entries);
+    entryCount = 0;
+    for (const auto &oldEntry : oldEntries) {
+        if (oldEntry.used) {
+            (*this)[oldEntry.ip] = oldEntry.data;
+        }
+    }
+}
+
+void StallSumIpDataMap::merge(const StallSumIpDataMap &other) {
+    for (const auto &otherEntry : other.entries) {
+        if (!otherEntry.used) {
+            continue;
+        }
+        auto &stallSumData = (*this)[otherEntry.ip];
+        stallSumData.activeCount += otherEntry.data.activeCount;
+        stallSumData.otherCount += otherEntry.data.otherCount;
+        stallSumData.controlCount += otherEntry.data.controlCount;
+        stallSumData.pipeStallCount += otherEntry.data.pipeStallCount;
+        stallSumData.sendCount += otherEntry.data.sendCount;
+        stallSumData.distAccCount += otherEntry.data.distAccCount;
+        stallSumData.sbidCount += otherEntry.data.sbidCount;
+        stallSumData.syncCount += otherEntry.data.syncCount;
+        stallSumData.instFetchCount += otherEntry.data.instFetchCount;
+    }
+}
+
+void StallSumIpDataMap::getSortedEntries(std::vector<std::pair<uint64_t, StallSumIpData_t>> &sortedEntries) const {
+    // Results are reported in ascending IP order
+    sortedEntries.clear();
+    sortedEntries.reserve(entryCount);
+    for (const auto &entry : entries) {
+        if (entry.used) {
+            sortedEntries.emplace_back(entry.ip, entry.data);
+        }
+    }
+    std::sort(sortedEntries.begin(), sortedEntries.end(), [](const auto &lhs, const auto &rhs) { return lhs.first < rhs.first; });
+}
+
 // The order of push_back calls must match the order of metricPropertiesList.
 void IpSamplingMetricGroupImp::stallSumIpDataToTypedValues(uint64_t ip,
                                                            StallSumIpData_t &sumIpData,
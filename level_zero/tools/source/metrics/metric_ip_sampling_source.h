@@ -52,10 +52,34 @@ typedef struct StallSumIpData {
     uint64_t instFetchCount;
 } StallSumIpData_t;
 
-typedef std::map<uint64_t, StallSumIpData_t> StallSumIpDataMap_t;
+// Open addressing aggregation of stall samples keyed by IP
+class StallSumIpDataMap {
+  public:
+    StallSumIpData_t &operator[](uint64_t ip);
+    size_t size() const { return entryCount; }
+    void merge(const StallSumIpDataMap &other);
+    void getSortedEntries(std::vector<std::pair<uint64_t, StallSumIpData_t>> &sortedEntries) const;
+
+    static constexpr size_t initialCapacity = 256;
+
+  protected:
+    struct Entry {
+        uint64_t ip;
+        StallSumIpData_t data;
+        bool used;
+    };
+    void grow();
+
+    std::vector<Entry> entries;
+    size_t entryCount = 0;
+};
+
+typedef StallSumIpDataMap StallSumIpDataMap_t;
 
 struct IpSamplingMetricGroupBase : public MetricGroup {
     static constexpr uint32_t rawReportSize = 64u;
+    static constexpr uint32_t minReportsPerAggregationThread = 16384u;
+    static constexpr uint32_t maxAggregationThreads = 8u;
     bool activate() override { return true; }
     bool deactivate() override { return true; };
     ze_result_t metricQueryPoolCreate(
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2022 Intel Corporation
+ * Copyright (C) 2020-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,9 +7,14 @@
 
 #include "level_zero/tools/source/sysman/engine/engine_imp.h"
 
+#include "level_zero/tools/source/sysman/os_sysman.h"
+
 namespace L0 {
 
 ze_result_t EngineImp::engineGetActivity(zes_engine_stats_t *pStats) {
+    if ((nullptr != pActivitySamples) && pActivitySamples->getLatest(*pStats)) {
+        return ZE_RESULT_SUCCESS;
+    }
     return pOsEngine->getActivity(pStats);
 }
 
@@ -28,9 +33,19 @@ void EngineImp::init() {
 EngineImp::EngineImp(OsSysman *pOsSysman, zes_engine_group_t engineType, uint32_t engineInstance, uint32_t subDeviceId, ze_bool_t onSubdevice) {
     pOsEngine = OsEngine::create(pOsSysman, engineType, engineInstance, subDeviceId, onSubdevice);
     init();
+
+    pTelemetrySampler = pOsSysman->getTelemetrySampler();
+    if (this->initSuccess && (nullptr != pTelemetrySampler)) {
+        pActivitySamples = pTelemetrySampler->registerCounter<zes_engine_stats_t>(
+            [this](zes_engine_stats_t &stats) { return pOsEngine->getActivity(&stats); });
+    }
 }
 
 EngineImp::~EngineImp() {
+    if (nullptr != pActivitySamples) {
+        pTelemetrySampler->unregisterCounter(pActivitySamples);
+        pActivitySamples = nullptr;
+    }
     if (nullptr != pOsEngine) {
         delete pOsEngine;
         pOsEngine = nullptr;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2022 Intel Corporation
+ * Copyright (C) 2020-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,6 +11,7 @@
 
 #include "level_zero/tools/source/sysman/engine/engine.h"
 #include "level_zero/tools/source/sysman/engine/os_engine.h"
+#include "level_zero/tools/source/sysman/telemetry_sampler.h"
 #include <level_zero/zes_api.h>
 namespace L0 {
 
@@ -28,5 +29,7 @@ class EngineImp : public Engine, NEO::NonCopyableOrMovableClass {
 
   private:
     zes_engine_properties_t engineProperties = {};
+    TelemetrySampler *pTelemetrySampler = nullptr;
+    SampledCounter<zes_engine_stats_t> *pActivitySamples = nullptr;
 };
 } // namespace L0
@@ -50,10 +50,16 @@ ze_result_t FrequencyImp::frequencySetRange(const zes_freq_range_t *pLimits) {
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
 
-    return pOsFrequency->osFrequencySetRange(pLimits);
+    auto result = pOsFrequency->osFrequencySetRange(pLimits);
+    invalidateStateSamples();
+    return result;
 }
 
 ze_result_t FrequencyImp::frequencyGetState(zes_freq_state_t *pState) {
+    // Sampled states carry no extension structures
+    if ((nullptr != pStateSamples) && (nullptr == pState->pNext) && pStateSamples->getLatest(*pState)) {
+        return ZE_RESULT_SUCCESS;
+    }
     return pOsFrequency->osFrequencyGetState(pState);
 }
 
@@ -70,7 +76,9 @@ ze_result_t FrequencyImp::frequencyOcGetFrequencyTarget(double *pCurrentOcFreque
 }
 
 ze_result_t FrequencyImp::frequencyOcSetFrequencyTarget(double currentOcFrequency) {
-    return pOsFrequency->setOcFrequencyTarget(currentOcFrequency);
+    auto result = pOsFrequency->setOcFrequencyTarget(currentOcFrequency);
+    invalidateStateSamples();
+    return result;
 }
 
 ze_result_t FrequencyImp::frequencyOcGetVoltageTarget(double *pCurrentVoltageTarget, double *pCurrentVoltageOffset) {
@@ -78,7 +86,9 @@ ze_result_t FrequencyImp::frequencyOcGetVoltageTarget(double *pCurrentVoltageTar
 }
 
 ze_result_t FrequencyImp::frequencyOcSetVoltageTarget(double currentVoltageTarget, double currentVoltageOffset) {
-    return pOsFrequency->setOcVoltageTarget(currentVoltageTarget, currentVoltageOffset);
+    auto result = pOsFrequency->setOcVoltageTarget(currentVoltageTarget, currentVoltageOffset);
+    invalidateStateSamples();
+    return result;
 }
 
 ze_result_t FrequencyImp::frequencyOcGetMode(zes_oc_mode_t *pCurrentOcMode) {
@@ -86,7 +96,9 @@ ze_result_t FrequencyImp::frequencyOcGetMode(zes_oc_mode_t *pCurrentOcMode) {
 }
 
 ze_result_t FrequencyImp::frequencyOcSetMode(zes_oc_mode_t currentOcMode) {
-    return pOsFrequency->setOcMode(currentOcMode);
+    auto result = pOsFrequency->setOcMode(currentOcMode);
+    invalidateStateSamples();
+    return result;
 }
 
 ze_result_t FrequencyImp::frequencyOcGetIccMax(double *pOcIccMax) {
@@ -94,7 +106,9 @@ ze_result_t FrequencyImp::frequencyOcGetIccMax(double *pOcIccMax) {
 }
 
 ze_result_t FrequencyImp::frequencyOcSetIccMax(double ocIccMax) {
-    return pOsFrequency->setOcIccMax(ocIccMax);
+    auto result = pOsFrequency->setOcIccMax(ocIccMax);
+    invalidateStateSamples();
+    return result;
 }
 
 ze_result_t FrequencyImp::frequencyOcGeTjMax(double *pOcTjMax) {
@@ -102,7 +116,16 @@ ze_result_t FrequencyImp::frequencyOcGeTjMax(double *pOcTjMax) {
 }
 
 ze_result_t FrequencyImp::frequencyOcSetTjMax(double ocTjMax) {
-    return pOsFrequency->setOcTjMax(ocTjMax);
+    auto result = pOsFrequency->setOcTjMax(ocTjMax);
+    invalidateStateSamples();
+    return result;
+}
+
+// Called after a setting was applied, states sampled before or during the change describe the previous setting
+void FrequencyImp::invalidateStateSamples() {
+    if (nullptr != pStateSamples) {
+        pStateSamples->invalidate();
+    }
 }
 
 void FrequencyImp::init() {
@@ -123,9 +146,20 @@ FrequencyImp::FrequencyImp(OsSysman *pOsSysman, ze_device_handle_t handle, zes_f
     pOsFrequency = OsFrequency::create(pOsSysman, onSubdevice, subdeviceId, frequencyDomainNumber);
     UNRECOVERABLE_IF(nullptr == pOsFrequency);
     init();
+
+    pTelemetrySampler = pOsSysman->getTelemetrySampler();
+    if (nullptr != pTelemetrySampler) {
+        pStateSamples = pTelemetrySampler->registerCounter<zes_freq_state_t>([this](zes_freq_state_t &state) {
+            state.stype = ZES_STRUCTURE_TYPE_FREQ_STATE;
+            return pOsFrequency->osFrequencyGetState(&state);
+        });
+    }
 }
 
 FrequencyImp::~FrequencyImp() {
+    if (nullptr != pStateSamples) {
+        pTelemetrySampler->unregisterCounter(pStateSamples);
+    }
     delete pOsFrequency;
     delete[] pClocks;
 }
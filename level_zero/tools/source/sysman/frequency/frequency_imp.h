@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2021 Intel Corporation
+ * Copyright (C) 2020-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,6 +11,7 @@
 
 #include "level_zero/tools/source/sysman/frequency/frequency.h"
 #include "level_zero/tools/source/sysman/frequency/os_frequency.h"
+#include "level_zero/tools/source/sysman/telemetry_sampler.h"
 #include <level_zero/zes_api.h>
 
 namespace L0 {
@@ -44,10 +45,14 @@ class FrequencyImp : public Frequency, NEO::NonCopyableOrMovableClass {
     void init();
 
   private:
+    void invalidateStateSamples();
+
     zes_freq_properties_t zesFrequencyProperties = {};
     double *pClocks = nullptr;
     uint32_t numClocks = 0;
     ze_device_handle_t deviceHandle = nullptr;
+    TelemetrySampler *pTelemetrySampler = nullptr;
+    SampledCounter<zes_freq_state_t> *pStateSamples = nullptr;
 };
 
 } // namespace L0
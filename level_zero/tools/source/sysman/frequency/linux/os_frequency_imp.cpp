@@ -410,6 +410,10 @@ void LinuxFrequencyImp::init() {
         throttleReasonPL4File = "gt_throttle_reason_status_pl4";
         throttleReasonThermalFile = "gt_throttle_reason_status_thermal";
     }
+    // Fused frequency limits never change at runtime, so they are read once and cached
+    pSysfsAccess->markImmutable(maxValFreqFile);
+    pSysfsAccess->markImmutable(minValFreqFile);
+    pSysfsAccess->markImmutable(efficientFreqFile);
 }
 
 LinuxFrequencyImp::LinuxFrequencyImp(OsSysman *pOsSysman, ze_bool_t onSubdevice, uint32_t subdeviceId, zes_freq_domain_t frequencyDomainNumber) : isSubdevice(onSubdevice), subdeviceId(subdeviceId), frequencyDomainNumber(frequencyDomainNumber) {
@@ -195,9 +195,11 @@ ze_result_t LinuxGlobalOperationsImp::reset(ze_bool_t force) {
     if (ZE_RESULT_SUCCESS != result) {
         return result;
     }
-    for (auto &&pid : processes) {
-        std::vector<int> fds;
-        pLinuxSysmanImp->getPidFdsForOpenDevice(pProcfsAccess, pSysfsAccess, pid, fds);
+    std::vector<std::vector<int>> processFds;
+    pLinuxSysmanImp->scanProcessesForOpenDevice(pProcfsAccess, pSysfsAccess, processes, processFds);
+    for (size_t i = 0; i < processes.size(); i++) {
+        auto pid = processes[i];
+        auto &fds = processFds[i];
         if (pid == myPid) {
             // L0 is expected to have this file open.
             // Keep list of fds. Close before unbind.
@@ -254,10 +256,10 @@ ze_result_t LinuxGlobalOperationsImp::reset(ze_bool_t force) {
     }
     std::vector<::pid_t> deviceUsingPids;
     deviceUsingPids.clear();
-    for (auto &&pid : processes) {
-        std::vector<int> fds;
-        pLinuxSysmanImp->getPidFdsForOpenDevice(pProcfsAccess, pSysfsAccess, pid, fds);
-        if (!fds.empty()) {
+    pLinuxSysmanImp->scanProcessesForOpenDevice(pProcfsAccess, pSysfsAccess, processes, processFds);
+    for (size_t i = 0; i < processes.size(); i++) {
+        auto pid = processes[i];
+        if (!processFds[i].empty()) {
             // Kill all processes that have the device open.
             pProcfsAccess->kill(pid);
             deviceUsingPids.push_back(pid);
@@ -375,9 +377,23 @@ ze_result_t LinuxGlobalOperationsImp::scanProcessesState(std::vector<zes_process
                 return result;
             }
         }
+        // Engine types already seen for this pid through another of its clients
+        auto pidEntry = pidClientMap.find(pid);
+        const int64_t knownEngineType = (pidEntry != pidClientMap.end()) ? pidEntry->second.engineTypeField : 0;
         // Scan all engine files present in /sys/class/drm/card0/clients/<ClientId>/busy and check
         // whether that engine is used by process
         for (const auto &engineNum : engineNums) {
+            int i915EnginNumber = stoi(engineNum);
+            auto i915MapToL0EngineType = engineMap.find(i915EnginNumber);
+            zes_engine_type_flags_t val = ZES_ENGINE_TYPE_FLAG_OTHER;
+            if (i915MapToL0EngineType != engineMap.end()) {
+                // Found a valid map
+                val = i915MapToL0EngineType->second;
+            }
+            if (((engineType | knownEngineType) & val) == val) {
+                // The engine type is already reported for this process, its busy time does not change the result
+                continue;
+            }
             uint64_t timeSpent = 0;
             std::string engine = busyDirForEngines + "/" + engineNum;
             result = pSysfsAccess->read(engine, timeSpent);
@@ -389,13 +405,6 @@ ze_result_t LinuxGlobalOperationsImp::scanProcessesState(std::vector<zes_process
                 }
             }
             if (timeSpent > 0) {
-                int i915EnginNumber = stoi(engineNum);
-                auto i915MapToL0EngineType = engineMap.find(i915EnginNumber);
-                zes_engine_type_flags_t val = ZES_ENGINE_TYPE_FLAG_OTHER;
-                if (i915MapToL0EngineType != engineMap.end()) {
-                    // Found a valid map
-                    val = i915MapToL0EngineType->second;
-                }
                 // In this for loop we want to retrieve the overall engines used by process
                 engineType = engineType | val;
             }
@@ -9,12 +9,15 @@
 
 #include <climits>
 
+#include <algorithm>
 #include <array>
+#include <cctype>
 #include <cerrno>
 #include <csignal>
 #include <cstdio>
 #include <cstdlib>
 #include <dirent.h>
+#include <fcntl.h>
 #include <unistd.h>
 
 namespace L0 {
@@ -31,8 +34,96 @@ static ze_result_t getResult(int err) {
     }
 }
 
+PersistentFileReader::~PersistentFileReader() {
+    for (auto &openFile : openFiles) {
+        ::close(openFile.second.first);
+    }
+}
+
+void PersistentFileReader::closeFile(std::unordered_map<std::string, std::pair<int, LruList::iterator>>::iterator openFile) {
+    ::close(openFile->second.first);
+    lruFiles.erase(openFile->second.second);
+    openFiles.erase(openFile);
+}
+
+void PersistentFileReader::keepFileOpen(const std::string &file, int fd) {
+    if (openFiles.size() >= maxOpenFiles) {
+        closeFile(openFiles.find(lruFiles.back()));
+    }
+    lruFiles.push_front(file);
+    openFiles.insert({file, {fd, lruFiles.begin()}});
+}
+
+void PersistentFileReader::markImmutable(const std::string &file) {
+    std::lock_guard<std::mutex> lock(mutex);
+    immutableFiles.insert(file);
+}
+
+ze_result_t PersistentFileReader::read(const std::string &file, std::string &val) {
+    // Read the first whitespace separated token of the file
+    std::lock_guard<std::mutex> lock(mutex);
+    val.clear();
+
+    auto immutableValue = immutableValues.find(file);
+    if (immutableValue != immutableValues.end()) {
+        val = immutableValue->second;
+        return ZE_RESULT_SUCCESS;
+    }
+
+    // per client files come and go with the processes using the device, so they are never kept open
+    const bool keepOpen = (file.find("/clients/") == std::string::npos);
+
+    std::array<char, 4096> buffer;
+    ssize_t bytesRead = -1;
+    while (bytesRead < 0) {
+        // a kept descriptor becomes stale when the device is rebound, so reopen the file once before failing
+        auto openFile = openFiles.find(file);
+        const bool fileWasOpen = (openFile != openFiles.end());
+        int fd = fileWasOpen ? openFile->second.first : ::open(file.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            return getResult(errno);
+        }
+
+        bytesRead = ::pread(fd, buffer.data(), buffer.size(), 0);
+        auto readError = errno;
+        if (fileWasOpen) {
+            if (bytesRead >= 0) {
+                lruFiles.splice(lruFiles.begin(), lruFiles, openFile->second.second);
+                break;
+            }
+            closeFile(openFile);
+            continue;
+        }
+
+        if (bytesRead < 0) {
+            ::close(fd);
+            return getResult(readError);
+        }
+        if (keepOpen) {
+            keepFileOpen(file, fd);
+        } else {
+            ::close(fd);
+        }
+    }
+
+    auto begin = buffer.begin();
+    auto end = buffer.begin() + bytesRead;
+    auto isSpace = [](char c) { return std::isspace(static_cast<unsigned char>(c)) != 0; };
+    auto tokenBegin = std::find_if_not(begin, end, isSpace);
+    auto tokenEnd = std::find_if(tokenBegin, end, isSpace);
+    if (tokenBegin == tokenEnd) {
+        return ZE_RESULT_ERROR_UNKNOWN;
+    }
+    val.assign(tokenBegin, tokenEnd);
+
+    if (immutableFiles.find(file) != immutableFiles.end()) {
+        immutableValues[file] = val;
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
 // Generic Filesystem Access
-FsAccess::FsAccess() {
+FsAccess::FsAccess() : persistentFileReader(std::make_shared<PersistentFileReader>()) {
 }
 
 FsAccess *FsAccess::create() {
@@ -40,92 +131,67 @@ FsAccess *FsAccess::create() {
 }
 
 ze_result_t FsAccess::read(const std::string file, uint64_t &val) {
-    // Read a single line from text file without trailing newline
-    std::ifstream fs;
-
-    fs.open(file.c_str());
-    if (fs.fail()) {
-        return getResult(errno);
+    std::string str;
+    auto result = persistentFileReader->read(file, str);
+    if (ZE_RESULT_SUCCESS != result) {
+        return result;
     }
-    fs >> val;
-    if (fs.fail()) {
-        fs.close();
-        return getResult(errno);
+
+    std::istringstream stream(str);
+    stream >> val;
+    if (stream.fail()) {
+        return ZE_RESULT_ERROR_UNKNOWN;
     }
-    fs.close();
     return ZE_RESULT_SUCCESS;
 }
 
 ze_result_t FsAccess::read(const std::string file, double &val) {
-    // Read a single line from text file without trailing newline
-    std::ifstream fs;
-
-    fs.open(file.c_str());
-    if (fs.fail()) {
-        return getResult(errno);
+    std::string str;
+    auto result = persistentFileReader->read(file, str);
+    if (ZE_RESULT_SUCCESS != result) {
+        return result;
     }
-    fs >> val;
-    if (fs.fail()) {
-        fs.close();
-        return getResult(errno);
+
+    std::istringstream stream(str);
+    stream >> val;
+    if (stream.fail()) {
+        return ZE_RESULT_ERROR_UNKNOWN;
     }
-    fs.close();
     return ZE_RESULT_SUCCESS;
 }
 
 ze_result_t FsAccess::read(const std::string file, int32_t &val) {
-    // Read a single line from text file without trailing newline
-    std::ifstream fs;
-
-    fs.open(file.c_str());
-    if (fs.fail()) {
-        return getResult(errno);
+    std::string str;
+    auto result = persistentFileReader->read(file, str);
+    if (ZE_RESULT_SUCCESS != result) {
+        return result;
     }
-    fs >> val;
-    if (fs.fail()) {
-        fs.close();
-        return getResult(errno);
+
+    std::istringstream stream(str);
+    stream >> val;
+    if (stream.fail()) {
+        return ZE_RESULT_ERROR_UNKNOWN;
     }
-    fs.close();
     return ZE_RESULT_SUCCESS;
 }
 
 ze_result_t FsAccess::read(const std::string file, uint32_t &val) {
-    // Read a single line from text file without trailing newline
-    std::ifstream fs;
-
-    fs.open(file.c_str());
-    if (fs.fail()) {
-        return getResult(errno);
+    std::string str;
+    auto result = persistentFileReader->read(file, str);
+    if (ZE_RESULT_SUCCESS != result) {
+        return result;
     }
-    fs >> val;
-    if (fs.fail()) {
-        fs.close();
-        return getResult(errno);
+
+    std::istringstream stream(str);
+    stream >> val;
+    if (stream.fail()) {
+        return ZE_RESULT_ERROR_UNKNOWN;
     }
-    fs.close();
     return ZE_RESULT_SUCCESS;
 }
 ze_result_t FsAccess::read(const std::string file, std::string &val) {
     // Read a single line from text file without trailing newline
-    std::ifstream fs;
-    val.clear();
-
-    fs.open(file.c_str());
-    if (fs.fail()) {
-        return getResult(errno);
-    }
-    fs >> val;
-    if (fs.fail()) {
-        fs.close();
-        return getResult(errno);
-    }
-    fs.close();
-    // Strip trailing newline
-    if (val.back() == '\n') {
-        val.pop_back();
-    }
-    return ZE_RESULT_SUCCESS;
+    return persistentFileReader->read(file, val);
 }
 
 ze_result_t FsAccess::read(const std::string file, std::vector<std::string> &val) {
@@ -277,6 +343,10 @@ std::string FsAccess::getDirName(const std::string path) {
     return path.substr(0, pos);
 }
 
+void FsAccess::markImmutable(const std::string file) {
+    persistentFileReader->markImmutable(file);
+}
+
 bool FsAccess::isRootUser() {
     return (geteuid() == 0);
 }
@@ -362,6 +432,37 @@ ze_result_t ProcfsAccess::getFileName(const ::pid_t pid, const int fd, std::stri
     return FsAccess::readSymLink(fullFdPath(pid, fd), val);
 }
 
+ze_result_t ProcfsAccess::getDeviceFileDescriptors(const ::pid_t pid, const std::vector<::dev_t> &devices, std::vector<int> &list) {
+    // Returns the filedescriptors of a pid which refer to one of the given character devices.
+    // Links are resolved with fstatat relative to the fd directory, so no link names
+    // have to be read and compared.
+    list.clear();
+    ::DIR *fdDirectory = ::opendir(fdDirPath(pid).c_str());
+    if (!fdDirectory) {
+        return getResult(errno);
+    }
+    int fdDirectoryFd = ::dirfd(fdDirectory);
+    struct ::dirent *ent;
+    while (NULL != (ent = ::readdir(fdDirectory))) {
+        char *end = nullptr;
+        auto fd = std::strtol(ent->d_name, &end, 10);
+        if ((end == ent->d_name) || (*end != '\0')) {
+            // Non numeric filename, not a file descriptor
+            continue;
+        }
+        struct ::stat fileStat;
+        if (0 != ::fstatat(fdDirectoryFd, ent->d_name, &fileStat, 0)) {
+            // Process closed this file. Not an error. Just ignore.
+            continue;
+        }
+        if (S_ISCHR(fileStat.st_mode) && (std::find(devices.begin(), devices.end(), fileStat.st_rdev) != devices.end())) {
+            list.push_back(static_cast<int>(fd));
+        }
+    }
+    ::closedir(fdDirectory);
+    return ZE_RESULT_SUCCESS;
+}
+
 bool ProcfsAccess::isAlive(const ::pid_t pid) {
     return FsAccess::fileExists(fullPath(pid));
 }
@@ -399,6 +500,16 @@ SysfsAccess::SysfsAccess(const std::string dev) {
             break;
         }
     }
+    for (auto &&next : deviceNames) {
+        struct ::stat devNodeStat;
+        if ((0 == ::stat((drmDriverDevNodeDir + next).c_str(), &devNodeStat)) && S_ISCHR(devNodeStat.st_mode)) {
+            deviceNumbers.push_back(devNodeStat.st_rdev);
+        }
+    }
+    if (deviceNumbers.size() != deviceNames.size()) {
+        // Device numbers are only usable for matching open files if every node of this device resolved
+        deviceNumbers.clear();
+    }
 }
 
 SysfsAccess *SysfsAccess::create(const std::string dev) {
@@ -497,6 +608,10 @@ ze_result_t SysfsAccess::read(const std::string file, uint64_t &val) {
     return ZE_RESULT_SUCCESS;
 }
 
+void SysfsAccess::markImmutable(const std::string file) {
+    FsAccess::markImmutable(fullPath(file));
+}
+
 ze_result_t SysfsAccess::read(const std::string file, std::vector<std::string> &val) {
     // Prepend sysfs directory path and call the base read
     return FsAccess::read(fullPath(file), val);
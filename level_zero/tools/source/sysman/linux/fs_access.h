@@ -15,16 +15,43 @@
 #include <fstream>
 #include <iostream>
 #include <list>
+#include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <sys/stat.h>
 #include <sys/sysmacros.h>
 #include <sys/types.h>
 #include <unistd.h>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace L0 {
 
+// Keeps frequently polled files open and rereads them from offset 0, values of immutable files are read once.
+// At most maxOpenFiles descriptors are kept, the least recently read one is closed first.
+class PersistentFileReader {
+  public:
+    ~PersistentFileReader();
+    ze_result_t read(const std::string &file, std::string &val);
+    void markImmutable(const std::string &file);
+
+    static constexpr size_t maxOpenFiles = 128;
+
+  protected:
+    using LruList = std::list<std::string>;
+
+    void closeFile(std::unordered_map<std::string, std::pair<int, LruList::iterator>>::iterator openFile);
+    void keepFileOpen(const std::string &file, int fd);
+
+    std::mutex mutex;
+    LruList lruFiles;
+    std::unordered_map<std::string, std::pair<int, LruList::iterator>> openFiles;
+    std::unordered_set<std::string> immutableFiles;
+    std::unordered_map<std::string, std::string> immutableValues;
+};
+
 class FsAccess {
   public:
     static FsAccess *create();
@@ -51,9 +78,11 @@ class FsAccess {
     std::string getDirName(const std::string path);
     virtual bool fileExists(const std::string file);
     virtual bool directoryExists(const std::string path);
+    void markImmutable(const std::string file);
 
   protected:
     FsAccess();
+    std::shared_ptr<PersistentFileReader> persistentFileReader;
     decltype(&NEO::SysCalls::access) accessSyscall = NEO::SysCalls::access;
     decltype(&stat) statSyscall = stat;
 };
@@ -67,6 +96,7 @@ class ProcfsAccess : private FsAccess {
     MOCKABLE_VIRTUAL ::pid_t myProcessId();
     MOCKABLE_VIRTUAL ze_result_t getFileDescriptors(const ::pid_t pid, std::vector<int> &list);
     MOCKABLE_VIRTUAL ze_result_t getFileName(const ::pid_t pid, const int fd, std::string &val);
+    MOCKABLE_VIRTUAL ze_result_t getDeviceFileDescriptors(const ::pid_t pid, const std::vector<::dev_t> &devices, std::vector<int> &list);
     MOCKABLE_VIRTUAL bool isAlive(const ::pid_t pid);
     MOCKABLE_VIRTUAL void kill(const ::pid_t pid);
 
@@ -113,9 +143,12 @@ class SysfsAccess : protected FsAccess {
     MOCKABLE_VIRTUAL bool isMyDeviceFile(const std::string dev);
     bool directoryExists(const std::string path) override;
     bool isRootUser() override;
+    void markImmutable(const std::string file);
+    const std::vector<::dev_t> &getDeviceNumbers() const { return deviceNumbers; }
 
   protected:
     std::vector<std::string> deviceNames;
+    std::vector<::dev_t> deviceNumbers;
 
   private:
     SysfsAccess(const std::string file);
@@ -18,6 +18,9 @@
 #include "level_zero/tools/source/sysman/firmware_util/firmware_util.h"
 #include "level_zero/tools/source/sysman/linux/fs_access.h"
 
+#include <algorithm>
+#include <thread>
+
 namespace L0 {
 
 const std::string LinuxSysmanImp::deviceDir("device");
@@ -252,6 +255,42 @@ void LinuxSysmanImp::getPidFdsForOpenDevice(ProcfsAccess *pProcfsAccess, SysfsAc
     }
 }
 
+void LinuxSysmanImp::scanProcessesForOpenDevice(ProcfsAccess *pProcfsAccess, SysfsAccess *pSysfsAccess, const std::vector<::pid_t> &processes, std::vector<std::vector<int>> &processDeviceFds) {
+    // Return, for every process in the list, the file descriptors that point to this device
+    processDeviceFds.clear();
+    processDeviceFds.resize(processes.size());
+    const auto &deviceNumbers = pSysfsAccess->getDeviceNumbers();
+    if (deviceNumbers.empty()) {
+        // Device nodes could not be resolved, fall back to comparing link names
+        for (size_t i = 0; i < processes.size(); i++) {
+            getPidFdsForOpenDevice(pProcfsAccess, pSysfsAccess, processes[i], processDeviceFds[i]);
+        }
+        return;
+    }
+
+    auto scanProcesses = [&](size_t first, size_t stride) {
+        for (size_t i = first; i < processes.size(); i += stride) {
+            // Process exited. Not an error. Just ignore.
+            pProcfsAccess->getDeviceFileDescriptors(processes[i], deviceNumbers, processDeviceFds[i]);
+        }
+    };
+    size_t numThreads = std::min({static_cast<size_t>(std::thread::hardware_concurrency()),
+                                  processes.size() / minProcessesPerScanThread,
+                                  maxProcessScanThreads});
+    if (numThreads <= 1) {
+        scanProcesses(0, 1);
+        return;
+    }
+    std::vector<std::thread> scanThreads;
+    for (size_t threadIndex = 1; threadIndex < numThreads; threadIndex++) {
+        scanThreads.emplace_back(scanProcesses, threadIndex, numThreads);
+    }
+    scanProcesses(0, numThreads);
+    for (auto &scanThread : scanThreads) {
+        scanThread.join();
+    }
+}
+
 ze_result_t LinuxSysmanImp::gpuProcessCleanup() {
     ::pid_t myPid = pProcfsAccess->myProcessId();
     std::vector<::pid_t> processes;
@@ -263,9 +302,11 @@ ze_result_t LinuxSysmanImp::gpuProcessCleanup() {
         return result;
     }
 
-    for (auto &&pid : processes) {
-        std::vector<int> fds;
-        getPidFdsForOpenDevice(pProcfsAccess, pSysfsAccess, pid, fds);
+    std::vector<std::vector<int>> processFds;
+    scanProcessesForOpenDevice(pProcfsAccess, pSysfsAccess, processes, processFds);
+    for (size_t i = 0; i < processes.size(); i++) {
+        auto pid = processes[i];
+        auto &fds = processFds[i];
         if (pid == myPid) {
             // L0 is expected to have this file open.
             // Keep list of fds. Close before unbind.
@@ -290,6 +331,10 @@ ze_result_t LinuxSysmanImp::gpuProcessCleanup() {
 }
 
 void LinuxSysmanImp::releaseSysmanDeviceResources() {
+    if (nullptr != getTelemetrySampler()) {
+        // Counters must not be sampled while the device is unbound
+        getTelemetrySampler()->suspend();
+    }
     getSysmanDeviceImp()->pEngineHandleContext->releaseEngines();
     getSysmanDeviceImp()->pRasHandleContext->releaseRasHandles();
     if (!diagnosticsReset) {
@@ -339,6 +384,9 @@ void LinuxSysmanImp::reInitSysmanDeviceResources() {
     if (getSysmanDeviceImp()->pFirmwareHandleContext->isFirmwareInitDone()) {
         getSysmanDeviceImp()->pFirmwareHandleContext->init();
     }
+    if (nullptr != getTelemetrySampler()) {
+        getTelemetrySampler()->resume();
+    }
 }
 
 ze_result_t LinuxSysmanImp::initDevice() {
@@ -69,6 +69,7 @@ class LinuxSysmanImp : public OsSysman, NEO::NonCopyableOrMovableClass {
     MOCKABLE_VIRTUAL ze_result_t initDevice();
     void reInitSysmanDeviceResources();
     MOCKABLE_VIRTUAL void getPidFdsForOpenDevice(ProcfsAccess *, SysfsAccess *, const ::pid_t, std::vector<int> &);
+    void scanProcessesForOpenDevice(ProcfsAccess *, SysfsAccess *, const std::vector<::pid_t> &, std::vector<std::vector<int>> &);
     MOCKABLE_VIRTUAL ze_result_t osWarmReset();
     MOCKABLE_VIRTUAL ze_result_t osColdReset();
     ze_result_t gpuProcessCleanup();
@@ -99,6 +100,8 @@ class LinuxSysmanImp : public OsSysman, NEO::NonCopyableOrMovableClass {
     LinuxSysmanImp() = delete;
     SysmanDeviceImp *pParentSysmanDeviceImp = nullptr;
     static const std::string deviceDir;
+    static constexpr size_t minProcessesPerScanThread = 256;
+    static constexpr size_t maxProcessScanThreads = 8;
     void clearHPIE(int fd);
 };
 
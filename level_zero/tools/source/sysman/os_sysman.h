@@ -1,13 +1,16 @@
 /*
- * Copyright (C) 2020-2022 Intel Corporation
+ * Copyright (C) 2020-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #pragma once
+#include "level_zero/tools/source/sysman/telemetry_sampler.h"
 #include <level_zero/zes_api.h>
 
+#include <memory>
+#include <mutex>
 #include <vector>
 
 namespace L0 {
@@ -21,6 +24,15 @@ struct OsSysman {
     static OsSysman *create(SysmanDeviceImp *pSysmanImp);
     virtual std::vector<ze_device_handle_t> &getDeviceHandles() = 0;
     virtual ze_device_handle_t getCoreDeviceHandle() = 0;
+
+    TelemetrySampler *getTelemetrySampler() {
+        std::call_once(telemetrySamplerCreated, [this]() { pTelemetrySampler = TelemetrySampler::create(); });
+        return pTelemetrySampler.get();
+    }
+
+  protected:
+    std::once_flag telemetrySamplerCreated;
+    std::unique_ptr<TelemetrySampler> pTelemetrySampler;
 };
 
 } // namespace L0
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2022 Intel Corporation
+ * Copyright (C) 2020-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -32,6 +32,9 @@ ze_result_t PowerImp::powerGetProperties(zes_power_properties_t *pProperties) {
 }
 
 ze_result_t PowerImp::powerGetEnergyCounter(zes_power_energy_counter_t *pEnergy) {
+    if ((nullptr != pEnergyCounterSamples) && pEnergyCounterSamples->getLatest(*pEnergy)) {
+        return ZE_RESULT_SUCCESS;
+    }
     return pOsPower->getEnergyCounter(pEnergy);
 }
 
@@ -68,6 +71,12 @@ PowerImp::PowerImp(OsSysman *pOsSysman, ze_device_handle_t handle) : deviceHandl
     UNRECOVERABLE_IF(nullptr == pOsPower);
 
     init();
+
+    pTelemetrySampler = pOsSysman->getTelemetrySampler();
+    if (this->initSuccess && (nullptr != pTelemetrySampler)) {
+        pEnergyCounterSamples = pTelemetrySampler->registerCounter<zes_power_energy_counter_t>(
+            [this](zes_power_energy_counter_t &energy) { return pOsPower->getEnergyCounter(&energy); });
+    }
 }
 
 void PowerImp::init() {
@@ -79,6 +88,10 @@ void PowerImp::init() {
 }
 
 PowerImp::~PowerImp() {
+    if (nullptr != pEnergyCounterSamples) {
+        pTelemetrySampler->unregisterCounter(pEnergyCounterSamples);
+        pEnergyCounterSamples = nullptr;
+    }
     if (nullptr != pOsPower) {
         delete pOsPower;
         pOsPower = nullptr;
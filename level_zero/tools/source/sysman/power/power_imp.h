@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2022 Intel Corporation
+ * Copyright (C) 2020-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,6 +11,7 @@
 
 #include "level_zero/tools/source/sysman/power/os_power.h"
 #include "level_zero/tools/source/sysman/power/power.h"
+#include "level_zero/tools/source/sysman/telemetry_sampler.h"
 #include <level_zero/zet_api.h>
 namespace L0 {
 class PowerImp : public Power, NEO::NonCopyableOrMovableClass {
@@ -34,5 +35,7 @@ class PowerImp : public Power, NEO::NonCopyableOrMovableClass {
   private:
     ze_device_handle_t deviceHandle = {};
     zes_power_properties_t powerProperties = {};
+    TelemetrySampler *pTelemetrySampler = nullptr;
+    SampledCounter<zes_power_energy_counter_t> *pEnergyCounterSamples = nullptr;
 };
 } // namespace L0
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/tools/source/sysman/telemetry_sampler.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+
+namespace L0 {
+
+std::unique_ptr<TelemetrySampler> TelemetrySampler::create() {
+    auto samplingInterval = NEO::DebugManager.flags.ExperimentalSysmanTelemetrySamplingInterval.get();
+    if (samplingInterval <= 0) {
+        return nullptr;
+    }
+    size_t samplesPerCounter = defaultSamplesPerCounter;
+    if (NEO::DebugManager.flags.ExperimentalSysmanTelemetrySampleCount.get() > 0) {
+        samplesPerCounter = static_cast<size_t>(NEO::DebugManager.flags.ExperimentalSysmanTelemetrySampleCount.get());
+    }
+    auto sampler = std::make_unique<TelemetrySampler>(std::chrono::milliseconds(samplingInterval), samplesPerCounter);
+    sampler->startSampling();
+    return sampler;
+}
+
+TelemetrySampler::TelemetrySampler(std::chrono::milliseconds samplingInterval, size_t samplesPerCounter)
+    : samplingInterval(samplingInterval), samplesPerCounter(samplesPerCounter) {}
+
+TelemetrySampler::~TelemetrySampler() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopSampling = true;
+    }
+    stopCondition.notify_all();
+    if (samplingThread.joinable()) {
+        samplingThread.join();
+    }
+}
+
+void TelemetrySampler::startSampling() {
+    if (!samplingThread.joinable()) {
+        samplingThread = std::thread(&TelemetrySampler::samplingLoop, this);
+    }
+}
+
+void TelemetrySampler::unregisterCounter(SampledCounterBase *counter) {
+    // Taking the lock waits for a sampling pass which may still use the counter
+    std::lock_guard<std::mutex> lock(mutex);
+    counters.erase(std::remove_if(counters.begin(), counters.end(),
+                                  [counter](const auto &registeredCounter) { return registeredCounter.get() == counter; }),
+                   counters.end());
+}
+
+void TelemetrySampler::suspend() {
+    std::lock_guard<std::mutex> lock(mutex);
+    suspended = true;
+}
+
+void TelemetrySampler::resume() {
+    std::lock_guard<std::mutex> lock(mutex);
+    suspended = false;
+}
+
+void TelemetrySampler::sampleCounters() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (suspended) {
+        return;
+    }
+    for (auto &counter : counters) {
+        counter->sample();
+    }
+}
+
+void TelemetrySampler::samplingLoop() {
+    auto nextSampleTime = std::chrono::steady_clock::now();
+    while (true) {
+        sampleCounters();
+        nextSampleTime = std::max(nextSampleTime + samplingInterval, std::chrono::steady_clock::now());
+
+        std::unique_lock<std::mutex> lock(mutex);
+        if (stopCondition.wait_until(lock, nextSampleTime, [this]() { return stopSampling; })) {
+            return;
+        }
+    }
+}
+
+} // namespace L0
@@ -0,0 +1,201 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <level_zero/zes_api.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace L0 {
+
+// Single writer, multiple reader ring of samples. Every slot is guarded by a sequence number,
+// readers never block the writer and retry or skip a slot which was overwritten while copying.
+template <typename SampleT>
+class SampleRingBuffer : NEO::NonCopyableOrMovableClass {
+    static_assert(std::is_trivially_copyable<SampleT>::value, "Samples are copied word by word");
+
+  public:
+    explicit SampleRingBuffer(size_t capacity) : slots(new Slot[capacity]), capacity(capacity) {}
+
+    void push(const SampleT &sample) {
+        auto index = samplesWritten.load(std::memory_order_relaxed);
+        auto &slot = slots[index % capacity];
+        std::array<uint64_t, wordsPerSample> words = {};
+        memcpy(words.data(), &sample, sizeof(SampleT));
+
+        slot.sequence.store(2 * index + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (size_t i = 0; i < wordsPerSample; i++) {
+            slot.words[i].store(words[i], std::memory_order_relaxed);
+        }
+        slot.sequence.store(2 * index + 2, std::memory_order_release);
+        samplesWritten.store(index + 1, std::memory_order_release);
+    }
+
+    bool getLatest(SampleT &sample) const {
+        auto written = samplesWritten.load(std::memory_order_acquire);
+        while (written > 0) {
+            if (readSample(written - 1, sample)) {
+                return true;
+            }
+            written = samplesWritten.load(std::memory_order_acquire);
+        }
+        return false;
+    }
+
+    uint64_t getSamplesWritten() const { return samplesWritten.load(std::memory_order_acquire); }
+
+  protected:
+    static constexpr size_t wordsPerSample = (sizeof(SampleT) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    struct Slot {
+        std::atomic<uint64_t> sequence{0};
+        std::array<std::atomic<uint64_t>, wordsPerSample> words;
+    };
+
+    bool readSample(uint64_t index, SampleT &sample) const {
+        const auto &slot = slots[index % capacity];
+        const auto expectedSequence = 2 * index + 2;
+        if (slot.sequence.load(std::memory_order_acquire) != expectedSequence) {
+            return false;
+        }
+        std::array<uint64_t, wordsPerSample> words;
+        for (size_t i = 0; i < wordsPerSample; i++) {
+            words[i] = slot.words[i].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) != expectedSequence) {
+            return false;
+        }
+        memcpy(&sample, words.data(), sizeof(SampleT));
+        return true;
+    }
+
+    std::unique_ptr<Slot[]> slots;
+    const size_t capacity;
+    std::atomic<uint64_t> samplesWritten{0};
+};
+
+class SampledCounterBase {
+  public:
+    virtual ~SampledCounterBase() = default;
+    virtual void sample() = 0;
+};
+
+template <typename SampleT>
+class SampledCounter : public SampledCounterBase {
+  public:
+    using SampleFunction = std::function<ze_result_t(SampleT &)>;
+
+    SampledCounter(SampleFunction sampleFunction, size_t capacity, std::chrono::nanoseconds maxSampleAge)
+        : sampleFunction(std::move(sampleFunction)), samples(capacity), maxSampleAge(maxSampleAge.count()) {}
+
+    void sample() override {
+        TimedSample timedSample = {};
+        // time is taken before reading, so a read racing with invalidate() is never treated as fresh
+        timedSample.sampleTime = getCurrentTime();
+        if (ZE_RESULT_SUCCESS == sampleFunction(timedSample.value)) {
+            samples.push(timedSample);
+            lastSampleFailed.store(false, std::memory_order_release);
+        } else {
+            lastSampleFailed.store(true, std::memory_order_release);
+        }
+    }
+
+    // Fails when the last sampling attempt failed, the latest sample is older than the maximum sample age
+    // or it was taken before the counter was invalidated, callers read the counter directly then.
+    bool getLatest(SampleT &value) const {
+        if (lastSampleFailed.load(std::memory_order_acquire)) {
+            return false;
+        }
+        TimedSample timedSample;
+        if (!samples.getLatest(timedSample) ||
+            (timedSample.sampleTime <= invalidationTime.load(std::memory_order_acquire)) ||
+            (getCurrentTime() - timedSample.sampleTime > maxSampleAge)) {
+            return false;
+        }
+        value = timedSample.value;
+        return true;
+    }
+
+    // Called after the sampled state was changed, samples taken so far no longer describe it
+    void invalidate() {
+        invalidationTime.store(getCurrentTime(), std::memory_order_release);
+    }
+
+  protected:
+    struct TimedSample {
+        SampleT value;
+        int64_t sampleTime;
+    };
+
+    static int64_t getCurrentTime() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    SampleFunction sampleFunction;
+    SampleRingBuffer<TimedSample> samples;
+    const int64_t maxSampleAge;
+    std::atomic<int64_t> invalidationTime{0};
+    std::atomic<bool> lastSampleFailed{false};
+};
+
+// Polls registered counters at a fixed rate on a background thread, so queries from any number
+// of clients are served from the latest sample instead of reading PMU/PMT/sysfs each time.
+class TelemetrySampler : NEO::NonCopyableOrMovableClass {
+  public:
+    static std::unique_ptr<TelemetrySampler> create();
+
+    TelemetrySampler(std::chrono::milliseconds samplingInterval, size_t samplesPerCounter);
+    ~TelemetrySampler();
+
+    template <typename SampleT>
+    SampledCounter<SampleT> *registerCounter(typename SampledCounter<SampleT>::SampleFunction sampleFunction) {
+        auto counter = std::make_unique<SampledCounter<SampleT>>(std::move(sampleFunction), samplesPerCounter, samplingInterval * maxSampleAgeInIntervals);
+        auto pCounter = counter.get();
+        std::lock_guard<std::mutex> lock(mutex);
+        counters.push_back(std::move(counter));
+        return pCounter;
+    }
+    void unregisterCounter(SampledCounterBase *counter);
+
+    void startSampling();
+    void suspend();
+    void resume();
+    void sampleCounters();
+
+    static constexpr size_t defaultSamplesPerCounter = 64;
+    // samples stay valid for more than one interval, so sampling thread jitter does not push queries to direct reads
+    static constexpr int maxSampleAgeInIntervals = 3;
+
+  protected:
+    void samplingLoop();
+
+    std::mutex mutex;
+    std::condition_variable stopCondition;
+    std::vector<std::unique_ptr<SampledCounterBase>> counters;
+    std::thread samplingThread;
+    const std::chrono::milliseconds samplingInterval;
+    const size_t samplesPerCounter;
+    bool suspended = false;
+    bool stopSampling = false;
+};
+
+} // namespace L0
@@ -8,6 +8,7 @@
 #include <level_zero/zes_api.h>
 
 #include <algorithm>
+#include <cctype>
 #include <chrono>
 #include <cmath>
 #include <fstream>
@@ -116,6 +117,7 @@ void usage() {
                  "\n        [--setlimit --sustained/--peak/--instantaneous/--burst <deviceNo limit>]    optionally set required power limit for particular device"
                  "\n  -m,   --memory                                                                    selectively run memory black box test"
                  "\n  -g,   --global                                                                    selectively run device/global operations black box test"
+                 "\n  -G,   --processes [iterations]                                                    measure zesDeviceProcessesGetState latency, 100 iterations by default"
                  "\n  -R,   --ras                                                                       selectively run ras black box test"
                  "\n  -E,   --event                                                                     set and listen to events black box test"
                  "\n  -r,   --reset force|noforce                                                       selectively run device reset test on all devices"
@@ -1265,6 +1267,28 @@ void testSysmanGlobalOperations(ze_device_handle_t &device) {
     }
 }
 
+void testSysmanProcessesBenchmark(ze_device_handle_t &device, uint32_t iterations) {
+    std::cout << std::endl
+              << " ----  Processes state benchmark ---- " << std::endl;
+    uint32_t count = 0;
+    std::vector<zes_process_state_t> processes;
+    std::chrono::duration<double, std::milli> total(0);
+    std::chrono::duration<double, std::milli> slowest(0);
+    for (uint32_t i = 0; i < iterations; i++) {
+        auto start = std::chrono::steady_clock::now();
+        VALIDATECALL(zesDeviceProcessesGetState(device, &count, nullptr));
+        processes.resize(count);
+        VALIDATECALL(zesDeviceProcessesGetState(device, &count, processes.data()));
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        total += elapsed;
+        slowest = std::max(slowest, elapsed);
+    }
+    std::cout << "processes count = " << count << std::endl;
+    std::cout << "iterations = " << iterations << std::endl;
+    std::cout << "average time [ms] = " << total.count() / iterations << std::endl;
+    std::cout << "max time [ms] = " << slowest.count() << std::endl;
+}
+
 void testSysmanDiagnostics(ze_device_handle_t &device) {
     std::cout << std::endl
               << " ----  diagnostics tests ---- " << std::endl;
@@ -1502,6 +1526,20 @@ int main(int argc, char *argv[]) {
             testSysmanGlobalOperations(device);
         });
     }
+    if (isParamEnabled(argc, argv, "-G", "--processes", &optind)) {
+        uint32_t iterations = 100;
+        optind = optind + 1;
+        if (optind < argc && isdigit(argv[optind][0])) {
+            iterations = static_cast<uint32_t>(std::stoi(argv[optind]));
+        }
+        if (iterations == 0) {
+            usage();
+            exit(0);
+        }
+        std::for_each(devices.begin(), devices.end(), [&](auto device) {
+            testSysmanProcessesBenchmark(device, iterations);
+        });
+    }
     if (isParamEnabled(argc, argv, "-m", "--memory", &optind)) {
         std::for_each(devices.begin(), devices.end(), [&](auto device) {
             testSysmanMemory(device);
@@ -632,6 +632,43 @@ TEST_F(MetricIpSamplingCalculateMetricsTest, GivenEnumerationIsSuccessfulWhenCal
     }
 }
 
+TEST_F(MetricIpSamplingCalculateMetricsTest, GivenRawDataLargeEnoughForPartitionedAggregationWhenCalculateMetricValuesIsCalledThenSamplesOfAllPartitionsAreSummed) {
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, testDevices[0]->getMetricDeviceContext().enableMetricApi());
+
+    // Four reports per repetition give enough reports for up to four aggregation partitions
+    constexpr uint32_t repetitions = IpSamplingMetricGroupBase::minReportsPerAggregationThread;
+    std::vector<MockStallRawIpData> largeRawDataVector;
+    largeRawDataVector.reserve(repetitions * rawDataVector.size());
+    for (uint32_t i = 0; i < repetitions; i++) {
+        largeRawDataVector.insert(largeRawDataVector.end(), rawDataVector.begin(), rawDataVector.end());
+    }
+    size_t largeRawDataVectorSize = sizeof(largeRawDataVector[0]) * largeRawDataVector.size();
+    std::vector<zet_typed_value_t> metricValues(30);
+
+    for (auto device : testDevices) {
+
+        uint32_t metricGroupCount = 0;
+        zetMetricGroupGet(device->toHandle(), &metricGroupCount, nullptr);
+        std::vector<zet_metric_group_handle_t> metricGroups;
+        metricGroups.resize(metricGroupCount);
+        ASSERT_EQ(zetMetricGroupGet(device->toHandle(), &metricGroupCount, metricGroups.data()), ZE_RESULT_SUCCESS);
+        ASSERT_NE(metricGroups[0], nullptr);
+
+        uint32_t metricValueCount = 30;
+        EXPECT_EQ(zetMetricGroupCalculateMetricValues(metricGroups[0], ZET_METRIC_GROUP_CALCULATION_TYPE_METRIC_VALUES,
+                                                      largeRawDataVectorSize, reinterpret_cast<uint8_t *>(largeRawDataVector.data()), &metricValueCount, metricValues.data()),
+                  ZE_RESULT_SUCCESS);
+        EXPECT_EQ(20u, metricValueCount);
+        for (uint32_t i = 0; i < metricValueCount; i++) {
+            // The IP is reported once, all counts are summed over every repetition
+            auto expectedValue = (i % 10 == 0) ? expectedMetricValues[i].value.ui64 : expectedMetricValues[i].value.ui64 * repetitions;
+            EXPECT_EQ(expectedMetricValues[i].type, metricValues[i].type);
+            EXPECT_EQ(expectedValue, metricValues[i].value.ui64);
+        }
+    }
+}
+
 TEST_F(MetricIpSamplingCalculateMetricsTest, GivenEnumerationIsSuccessfulWhenCalculateMetricValuesIsCalledWithDataFromMultipleSubdevicesThenReturnError) {
 
     EXPECT_EQ(ZE_RESULT_SUCCESS, testDevices[0]->getMetricDeviceContext().enableMetricApi());
@@ -122,7 +122,9 @@ struct MockGlobalOperationsSysfsAccess : public SysfsAccess {
         return readResult;
     }
 
+    std::vector<std::string> readUnsignedLongFiles;
     ze_result_t read(const std::string file, uint64_t &val) override {
+        readUnsignedLongFiles.push_back(file);
         if (mockReadStatus == true) {
             if (mockCount == 0) {
                 mockCount++;
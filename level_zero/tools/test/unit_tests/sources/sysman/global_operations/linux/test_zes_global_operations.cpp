@@ -12,6 +12,8 @@
 
 #include "mock_global_operations.h"
 
+#include <algorithm>
+
 extern bool sysmanUltsEnable;
 
 namespace L0 {
@@ -637,6 +639,20 @@ TEST_F(SysmanGlobalOperationsFixture, GivenValidDeviceHandleWhileRetrievingInfor
     EXPECT_EQ(processes[4].sharedSize, sharedMemSize7);
 }
 
+TEST_F(SysmanGlobalOperationsFixture, GivenProcessWithMultipleClientsWhenRetrievingProcessStateThenBusyFilesOfAlreadyReportedEngineTypesAreNotRead) {
+    uint32_t count = 0;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, zesDeviceProcessesGetState(device, &count, nullptr));
+    auto &readFiles = pSysfsAccess->readUnsignedLongFiles;
+    auto wasRead = [&readFiles](const std::string &file) { return std::find(readFiles.begin(), readFiles.end(), file) != readFiles.end(); };
+
+    EXPECT_TRUE(wasRead("clients/4/busy/0"));
+    EXPECT_TRUE(wasRead("clients/4/busy/3"));
+    EXPECT_FALSE(wasRead("clients/5/busy/0"));
+    EXPECT_TRUE(wasRead("clients/5/busy/1"));
+    EXPECT_FALSE(wasRead("clients/5/busy/2"));
+    EXPECT_FALSE(wasRead("clients/5/busy/3"));
+}
+
 TEST_F(SysmanGlobalOperationsFixture, GivenValidDeviceHandleWhileRetrievingInformationAboutHostProcessesUsingDeviceThenSuccessIsReturnedEvenwithFaultyClient) {
     uint32_t count = 0;
     pSysfsAccess->mockGetScannedDir4EntriesStatus = true;
@@ -14,6 +14,9 @@
 #include "level_zero/tools/source/sysman/ras/ras_imp.h"
 #include "level_zero/tools/test/unit_tests/sources/sysman/linux/mock_sysman_fixture.h"
 
+#include <algorithm>
+#include <fcntl.h>
+
 namespace L0 {
 namespace ult {
 
@@ -259,6 +262,80 @@ TEST_F(SysmanDeviceFixture, GivenInvalidPathnameWhenCallingFsAccessExistsThenErr
     EXPECT_FALSE(fsAccess.fileExists(path));
 }
 
+TEST_F(SysmanDeviceFixture, GivenFileKeptOpenByFsAccessWhenFileContentsChangeThenUpdatedValueIsReadUnlessFileIsMarkedImmutable) {
+    auto fsAccess = pLinuxSysmanImp->getFsAccess();
+    std::string path = "/tmp/sysman_fs_access_test_" + std::to_string(getpid());
+    auto writeValue = [&path](uint64_t value) {
+        std::ofstream file(path, std::ios::trunc);
+        file << value << std::endl;
+    };
+
+    uint64_t value = 0;
+    writeValue(100);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, fsAccess.read(path, value));
+    EXPECT_EQ(100u, value);
+
+    writeValue(200);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, fsAccess.read(path, value));
+    EXPECT_EQ(200u, value);
+
+    fsAccess.markImmutable(path);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, fsAccess.read(path, value));
+    EXPECT_EQ(200u, value);
+    writeValue(300);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, fsAccess.read(path, value));
+    EXPECT_EQ(200u, value);
+
+    std::remove(path.c_str());
+}
+
+class PublicPersistentFileReader : public L0::PersistentFileReader {
+  public:
+    using L0::PersistentFileReader::lruFiles;
+    using L0::PersistentFileReader::openFiles;
+};
+
+TEST_F(SysmanDeviceFixture, GivenPersistentFileReaderWhenMoreFilesThanMaxOpenFilesAreReadThenLeastRecentlyUsedFileIsClosedAndClientFilesAreNotKeptOpen) {
+    std::string directory = "/tmp/sysman_persistent_reader_test_" + std::to_string(getpid());
+    std::string clientsDirectory = directory + "/clients";
+    ASSERT_EQ(0, mkdir(directory.c_str(), 0700));
+    ASSERT_EQ(0, mkdir(clientsDirectory.c_str(), 0700));
+
+    std::vector<std::string> files;
+    for (size_t i = 0; i <= PersistentFileReader::maxOpenFiles; i++) {
+        files.push_back(directory + "/file" + std::to_string(i));
+        std::ofstream(files.back()) << i << std::endl;
+    }
+    std::string clientFile = clientsDirectory + "/total";
+    std::ofstream(clientFile) << 7 << std::endl;
+
+    PublicPersistentFileReader reader;
+    std::string value;
+    for (size_t i = 0; i < PersistentFileReader::maxOpenFiles; i++) {
+        EXPECT_EQ(ZE_RESULT_SUCCESS, reader.read(files[i], value));
+    }
+    EXPECT_EQ(PersistentFileReader::maxOpenFiles, reader.openFiles.size());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, reader.read(files[0], value));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, reader.read(files[PersistentFileReader::maxOpenFiles], value));
+    EXPECT_EQ(std::to_string(PersistentFileReader::maxOpenFiles), value);
+    EXPECT_EQ(PersistentFileReader::maxOpenFiles, reader.openFiles.size());
+    EXPECT_EQ(PersistentFileReader::maxOpenFiles, reader.lruFiles.size());
+    EXPECT_NE(reader.openFiles.end(), reader.openFiles.find(files[0]));
+    EXPECT_EQ(reader.openFiles.end(), reader.openFiles.find(files[1]));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, reader.read(clientFile, value));
+    EXPECT_EQ("7", value);
+    EXPECT_EQ(reader.openFiles.end(), reader.openFiles.find(clientFile));
+
+    for (auto &file : files) {
+        std::remove(file.c_str());
+    }
+    std::remove(clientFile.c_str());
+    rmdir(clientsDirectory.c_str());
+    rmdir(directory.c_str());
+}
+
 TEST_F(SysmanDeviceFixture, GivenCreateSysfsAccessHandleWhenCallinggetSysfsAccessThenCreatedSysfsAccessHandleHandleWillBeRetrieved) {
     if (pLinuxSysmanImp->pSysfsAccess != nullptr) {
         // delete previously allocated pSysfsAccess
@@ -291,6 +368,24 @@ TEST_F(SysmanDeviceFixture, GivenInvalidPidWhenCallingProcfsAccessIsAliveThenErr
     EXPECT_FALSE(procfsAccess.isAlive(reinterpret_cast<::pid_t>(-1)));
 }
 
+TEST_F(SysmanDeviceFixture, GivenOpenCharacterDeviceWhenCallingProcfsAccessGetDeviceFileDescriptorsThenOnlyMatchingDeviceFdsAreReturned) {
+    std::unique_ptr<ProcfsAccess> procfsAccess(ProcfsAccess::create());
+    int deviceFd = ::open("/dev/null", O_RDONLY);
+    ASSERT_LE(0, deviceFd);
+    struct ::stat deviceStat;
+    ASSERT_EQ(0, ::fstat(deviceFd, &deviceStat));
+
+    std::vector<int> fds;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, procfsAccess->getDeviceFileDescriptors(::getpid(), {deviceStat.st_rdev}, fds));
+    EXPECT_NE(fds.end(), std::find(fds.begin(), fds.end(), deviceFd));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, procfsAccess->getDeviceFileDescriptors(::getpid(), {}, fds));
+    EXPECT_TRUE(fds.empty());
+
+    EXPECT_NE(ZE_RESULT_SUCCESS, procfsAccess->getDeviceFileDescriptors(reinterpret_cast<::pid_t>(-1), {deviceStat.st_rdev}, fds));
+    ::close(deviceFd);
+}
+
 TEST_F(SysmanDeviceFixture, GivenValidDeviceHandleThenSameHandleIsRetrievedFromOsSpecificCode) {
     EXPECT_EQ(pLinuxSysmanImp->getDeviceHandle(), device);
 }
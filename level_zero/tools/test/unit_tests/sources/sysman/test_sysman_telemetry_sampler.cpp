@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include "level_zero/tools/source/sysman/telemetry_sampler.h"
+
+namespace L0 {
+namespace ult {
+
+TEST(SysmanSampleRingBufferTest, GivenMoreSamplesThanCapacityWhenGettingLatestSampleThenMostRecentSampleIsReturned) {
+    SampleRingBuffer<zes_power_energy_counter_t> samples(4);
+    zes_power_energy_counter_t energy = {};
+    EXPECT_FALSE(samples.getLatest(energy));
+
+    for (uint64_t i = 0; i < 10; i++) {
+        samples.push({i * 100, i});
+    }
+    EXPECT_EQ(10u, samples.getSamplesWritten());
+    EXPECT_TRUE(samples.getLatest(energy));
+    EXPECT_EQ(900u, energy.energy);
+    EXPECT_EQ(9u, energy.timestamp);
+
+}
+
+TEST(SysmanTelemetrySamplerTest, GivenRegisteredCounterWhenSamplingThenOnlySuccessfulReadsAreReturnedAndSuspendStopsSampling) {
+    TelemetrySampler sampler(std::chrono::milliseconds(1000000), 8);
+    uint64_t reads = 0;
+    ze_result_t readResult = ZE_RESULT_SUCCESS;
+    auto counter = sampler.registerCounter<zes_engine_stats_t>([&](zes_engine_stats_t &stats) {
+        reads++;
+        stats.activeTime = reads;
+        return readResult;
+    });
+
+    sampler.sampleCounters();
+    zes_engine_stats_t stats = {};
+    EXPECT_TRUE(counter->getLatest(stats));
+    EXPECT_EQ(reads, stats.activeTime);
+
+    readResult = ZE_RESULT_ERROR_NOT_AVAILABLE;
+    sampler.sampleCounters();
+    EXPECT_FALSE(counter->getLatest(stats));
+
+    readResult = ZE_RESULT_SUCCESS;
+    sampler.sampleCounters();
+    EXPECT_TRUE(counter->getLatest(stats));
+    EXPECT_EQ(reads, stats.activeTime);
+
+    sampler.suspend();
+    auto readsBeforeSuspend = reads;
+    sampler.sampleCounters();
+    EXPECT_EQ(readsBeforeSuspend, reads);
+    sampler.resume();
+
+    sampler.unregisterCounter(counter);
+    sampler.sampleCounters();
+    EXPECT_EQ(readsBeforeSuspend, reads);
+}
+
+TEST(SysmanTelemetrySamplerTest, GivenSampleOlderThanMaxSampleAgeWhenGettingLatestSampleThenSampleIsNotReturned) {
+    TelemetrySampler sampler(std::chrono::milliseconds(1), 8);
+    auto counter = sampler.registerCounter<zes_engine_stats_t>([](zes_engine_stats_t &stats) {
+        stats.activeTime = 1;
+        return ZE_RESULT_SUCCESS;
+    });
+
+    sampler.sampleCounters();
+    std::this_thread::sleep_for(std::chrono::milliseconds(TelemetrySampler::maxSampleAgeInIntervals * 5));
+
+    zes_engine_stats_t stats = {};
+    EXPECT_FALSE(counter->getLatest(stats));
+}
+
+TEST(SysmanTelemetrySamplerTest, GivenInvalidatedCounterWhenGettingLatestSampleThenOnlySamplesTakenAfterInvalidationAreReturned) {
+    TelemetrySampler sampler(std::chrono::milliseconds(1000000), 8);
+    uint64_t reads = 0;
+    auto counter = sampler.registerCounter<zes_engine_stats_t>([&](zes_engine_stats_t &stats) {
+        stats.activeTime = ++reads;
+        return ZE_RESULT_SUCCESS;
+    });
+
+    sampler.sampleCounters();
+    zes_engine_stats_t stats = {};
+    EXPECT_TRUE(counter->getLatest(stats));
+
+    counter->invalidate();
+    EXPECT_FALSE(counter->getLatest(stats));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    sampler.sampleCounters();
+    EXPECT_TRUE(counter->getLatest(stats));
+    EXPECT_EQ(2u, stats.activeTime);
+}
+
+TEST(SysmanTelemetrySamplerTest, GivenSamplingIntervalDebugFlagWhenCreatingSamplerThenSamplerIsCreatedOnlyWhenEnabled) {
+    DebugManagerStateRestore restorer;
+    EXPECT_EQ(nullptr, TelemetrySampler::create());
+
+    DebugManager.flags.ExperimentalSysmanTelemetrySamplingInterval.set(10);
+    EXPECT_NE(nullptr, TelemetrySampler::create());
+}
+
+} // namespace ult
+} // namespace L0
@@ -24,6 +24,7 @@
 #include "opencl/source/api/api_enter.h"
 #include "opencl/source/built_ins/vme_builtin.h"
 #include "opencl/source/cl_device/cl_device.h"
+#include "opencl/source/command_queue/cl_command_buffer.h"
 #include "opencl/source/command_queue/command_queue.h"
 #include "opencl/source/context/context.h"
 #include "opencl/source/context/driver_diagnostics.h"
@@ -4414,6 +4415,312 @@ cl_int CL_API_CALL clGetKernelSuggestedLocalWorkSizeKHR(cl_command_queue command
                                                   suggestedLocalWorkSize);
 }
 
+cl_command_buffer_khr CL_API_CALL clCreateCommandBufferKHR(cl_uint numQueues,
+                                                           const cl_command_queue *queues,
+                                                           const cl_command_buffer_properties_khr *properties,
+                                                           cl_int *errcodeRet) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("numQueues", numQueues, "queues", queues, "properties", properties);
+
+    auto pCommandBuffer = ClCommandBuffer::create(numQueues, queues, properties, retVal);
+
+    if (errcodeRet) {
+        *errcodeRet = retVal;
+    }
+    return pCommandBuffer;
+}
+
+cl_int CL_API_CALL clFinalizeCommandBufferKHR(cl_command_buffer_khr commandBuffer) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandBuffer", commandBuffer);
+
+    auto pCommandBuffer = castToObject<ClCommandBuffer>(commandBuffer);
+    if (!pCommandBuffer) {
+        retVal = CL_INVALID_COMMAND_BUFFER_KHR;
+        return retVal;
+    }
+
+    retVal = pCommandBuffer->finalize();
+    return retVal;
+}
+
+cl_int CL_API_CALL clRetainCommandBufferKHR(cl_command_buffer_khr commandBuffer) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandBuffer", commandBuffer);
+
+    auto pCommandBuffer = castToObject<ClCommandBuffer>(commandBuffer);
+    if (!pCommandBuffer) {
+        retVal = CL_INVALID_COMMAND_BUFFER_KHR;
+        return retVal;
+    }
+
+    pCommandBuffer->retain();
+    return retVal;
+}
+
+cl_int CL_API_CALL clReleaseCommandBufferKHR(cl_command_buffer_khr commandBuffer) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandBuffer", commandBuffer);
+
+    auto pCommandBuffer = castToObject<ClCommandBuffer>(commandBuffer);
+    if (!pCommandBuffer) {
+        retVal = CL_INVALID_COMMAND_BUFFER_KHR;
+        return retVal;
+    }
+
+    pCommandBuffer->release();
+    return retVal;
+}
+
+cl_int CL_API_CALL clEnqueueCommandBufferKHR(cl_uint numQueues,
+                                             cl_command_queue *queues,
+                                             cl_command_buffer_khr commandBuffer,
+                                             cl_uint numEventsInWaitList,
+                                             const cl_event *eventWaitList,
+                                             cl_event *event) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("numQueues", numQueues, "queues", queues, "commandBuffer", commandBuffer,
+                   "numEventsInWaitList", numEventsInWaitList,
+                   "eventWaitList", getClFileLogger().getEvents(reinterpret_cast<const uintptr_t *>(eventWaitList), numEventsInWaitList),
+                   "event", getClFileLogger().getEvents(reinterpret_cast<const uintptr_t *>(event), 1));
+
+    auto pCommandBuffer = castToObject<ClCommandBuffer>(commandBuffer);
+    if (!pCommandBuffer) {
+        retVal = CL_INVALID_COMMAND_BUFFER_KHR;
+        return retVal;
+    }
+
+    retVal = validateObjects(EventWaitList(numEventsInWaitList, eventWaitList));
+    if (CL_SUCCESS == retVal) {
+        retVal = pCommandBuffer->enqueue(numQueues, queues, numEventsInWaitList, eventWaitList, event);
+    }
+
+    DBG_LOG_INPUTS("event", getClFileLogger().getEvents(reinterpret_cast<const uintptr_t *>(event), 1u));
+    return retVal;
+}
+
+cl_int CL_API_CALL clCommandBarrierWithWaitListKHR(cl_command_buffer_khr commandBuffer,
+                                                   cl_command_queue commandQueue,
+                                                   cl_uint numSyncPointsInWaitList,
+                                                   const cl_sync_point_khr *syncPointWaitList,
+                                                   cl_sync_point_khr *syncPoint,
+                                                   cl_mutable_command_khr *mutableHandle) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandBuffer", commandBuffer, "commandQueue", commandQueue,
+                   "numSyncPointsInWaitList", numSyncPointsInWaitList, "syncPointWaitList", syncPointWaitList);
+
+    auto pCommandBuffer = castToObject<ClCommandBuffer>(commandBuffer);
+    if (!pCommandBuffer) {
+        retVal = CL_INVALID_COMMAND_BUFFER_KHR;
+        return retVal;
+    }
+    if (commandQueue != nullptr) {
+        retVal = CL_INVALID_COMMAND_QUEUE;
+        return retVal;
+    }
+    if (mutableHandle != nullptr) {
+        retVal = CL_INVALID_VALUE;
+        return retVal;
+    }
+
+    retVal = pCommandBuffer->recordBarrier(numSyncPointsInWaitList, syncPointWaitList, syncPoint);
+    return retVal;
+}
+
+cl_int CL_API_CALL clCommandCopyBufferKHR(cl_command_buffer_khr commandBuffer,
+                                          cl_command_queue commandQueue,
+                                          cl_mem srcBuffer,
+                                          cl_mem dstBuffer,
+                                          size_t srcOffset,
+                                          size_t dstOffset,
+                                          size_t size,
+                                          cl_uint numSyncPointsInWaitList,
+                                          const cl_sync_point_khr *syncPointWaitList,
+                                          cl_sync_point_khr *syncPoint,
+                                          cl_mutable_command_khr *mutableHandle) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandBuffer", commandBuffer, "commandQueue", commandQueue, "srcBuffer", srcBuffer, "dstBuffer", dstBuffer,
+                   "srcOffset", srcOffset, "dstOffset", dstOffset, "size", size,
+                   "numSyncPointsInWaitList", numSyncPointsInWaitList, "syncPointWaitList", syncPointWaitList);
+
+    auto pCommandBuffer = castToObject<ClCommandBuffer>(commandBuffer);
+    if (!pCommandBuffer) {
+        retVal = CL_INVALID_COMMAND_BUFFER_KHR;
+        return retVal;
+    }
+    if (commandQueue != nullptr) {
+        retVal = CL_INVALID_COMMAND_QUEUE;
+        return retVal;
+    }
+    if (mutableHandle != nullptr) {
+        retVal = CL_INVALID_VALUE;
+        return retVal;
+    }
+
+    Buffer *pSrcBuffer = nullptr;
+    Buffer *pDstBuffer = nullptr;
+    retVal = validateObjects(
+        withCastToInternal(srcBuffer, &pSrcBuffer),
+        withCastToInternal(dstBuffer, &pDstBuffer));
+    if (CL_SUCCESS != retVal) {
+        return retVal;
+    }
+    if (srcOffset + size > pSrcBuffer->getSize() || dstOffset + size > pDstBuffer->getSize()) {
+        retVal = CL_INVALID_VALUE;
+        return retVal;
+    }
+
+    retVal = pCommandBuffer->recordCopyBuffer(pSrcBuffer, pDstBuffer, srcOffset, dstOffset, size,
+                                              numSyncPointsInWaitList, syncPointWaitList, syncPoint);
+    return retVal;
+}
+
+cl_int CL_API_CALL clCommandFillBufferKHR(cl_command_buffer_khr commandBuffer,
+                                          cl_command_queue commandQueue,
+                                          cl_mem buffer,
+                                          const void *pattern,
+                                          size_t patternSize,
+                                          size_t offset,
+                                          size_t size,
+                                          cl_uint numSyncPointsInWaitList,
+                                          const cl_sync_point_khr *syncPointWaitList,
+                                          cl_sync_point_khr *syncPoint,
+                                          cl_mutable_command_khr *mutableHandle) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandBuffer", commandBuffer, "commandQueue", commandQueue, "buffer", buffer,
+                   "pattern", NEO::fileLoggerInstance().infoPointerToString(pattern, patternSize), "patternSize", patternSize,
+                   "offset", offset, "size", size,
+                   "numSyncPointsInWaitList", numSyncPointsInWaitList, "syncPointWaitList", syncPointWaitList);
+
+    auto pCommandBuffer = castToObject<ClCommandBuffer>(commandBuffer);
+    if (!pCommandBuffer) {
+        retVal = CL_INVALID_COMMAND_BUFFER_KHR;
+        return retVal;
+    }
+    if (commandQueue != nullptr) {
+        retVal = CL_INVALID_COMMAND_QUEUE;
+        return retVal;
+    }
+    if (mutableHandle != nullptr) {
+        retVal = CL_INVALID_VALUE;
+        return retVal;
+    }
+
+    Buffer *pBuffer = nullptr;
+    retVal = validateObjects(
+        withCastToInternal(buffer, &pBuffer),
+        pattern,
+        (PatternSize)patternSize);
+    if (CL_SUCCESS != retVal) {
+        return retVal;
+    }
+    if (offset + size > pBuffer->getSize() || offset % patternSize != 0 || size % patternSize != 0) {
+        retVal = CL_INVALID_VALUE;
+        return retVal;
+    }
+
+    retVal = pCommandBuffer->recordFillBuffer(pBuffer, pattern, patternSize, offset, size,
+                                              numSyncPointsInWaitList, syncPointWaitList, syncPoint);
+    return retVal;
+}
+
+cl_int CL_API_CALL clCommandNDRangeKernelKHR(cl_command_buffer_khr commandBuffer,
+                                             cl_command_queue commandQueue,
+                                             const cl_ndrange_kernel_command_properties_khr *properties,
+                                             cl_kernel kernel,
+                                             cl_uint workDim,
+                                             const size_t *globalWorkOffset,
+                                             const size_t *globalWorkSize,
+                                             const size_t *localWorkSize,
+                                             cl_uint numSyncPointsInWaitList,
+                                             const cl_sync_point_khr *syncPointWaitList,
+                                             cl_sync_point_khr *syncPoint,
+                                             cl_mutable_command_khr *mutableHandle) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandBuffer", commandBuffer, "commandQueue", commandQueue, "properties", properties, "kernel", kernel,
+                   "globalWorkSize", NEO::fileLoggerInstance().getSizes(globalWorkSize, workDim, false),
+                   "localWorkSize", NEO::fileLoggerInstance().getSizes(localWorkSize, workDim, true),
+                   "numSyncPointsInWaitList", numSyncPointsInWaitList, "syncPointWaitList", syncPointWaitList);
+
+    auto pCommandBuffer = castToObject<ClCommandBuffer>(commandBuffer);
+    if (!pCommandBuffer) {
+        retVal = CL_INVALID_COMMAND_BUFFER_KHR;
+        return retVal;
+    }
+    if (commandQueue != nullptr) {
+        retVal = CL_INVALID_COMMAND_QUEUE;
+        return retVal;
+    }
+    if (mutableHandle != nullptr || (properties != nullptr && properties[0] != 0)) {
+        retVal = CL_INVALID_VALUE;
+        return retVal;
+    }
+
+    MultiDeviceKernel *pMultiDeviceKernel = nullptr;
+    retVal = validateObjects(withCastToInternal(kernel, &pMultiDeviceKernel));
+    if (CL_SUCCESS != retVal) {
+        return retVal;
+    }
+
+    auto pCommandQueue = pCommandBuffer->getCommandQueue();
+    if (&pMultiDeviceKernel->getProgram()->getContext() != &pCommandQueue->getContext()) {
+        retVal = CL_INVALID_CONTEXT;
+        return retVal;
+    }
+
+    Kernel *pKernel = pMultiDeviceKernel->getKernel(pCommandQueue->getDevice().getRootDeviceIndex());
+    if (!pKernel->isPatched()) {
+        retVal = CL_INVALID_KERNEL_ARGS;
+        return retVal;
+    }
+
+    auto localMemSize = static_cast<uint32_t>(pCommandQueue->getDevice().getDeviceInfo().localMemSize);
+    auto slmTotalSize = pKernel->getSlmTotalSize();
+    if (slmTotalSize > 0 && localMemSize < slmTotalSize) {
+        retVal = CL_OUT_OF_RESOURCES;
+        return retVal;
+    }
+
+    if ((pKernel->getExecutionType() != KernelExecutionType::Default) ||
+        pKernel->usesSyncBuffer()) {
+        retVal = CL_INVALID_KERNEL;
+        return retVal;
+    }
+
+    retVal = pCommandBuffer->recordNDRangeKernel(pMultiDeviceKernel, workDim, globalWorkOffset, globalWorkSize, localWorkSize,
+                                                 numSyncPointsInWaitList, syncPointWaitList, syncPoint);
+    return retVal;
+}
+
+cl_int CL_API_CALL clGetCommandBufferInfoKHR(cl_command_buffer_khr commandBuffer,
+                                             cl_command_buffer_info_khr paramName,
+                                             size_t paramValueSize,
+                                             void *paramValue,
+                                             size_t *paramValueSizeRet) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandBuffer", commandBuffer, "paramName", paramName, "paramValueSize", paramValueSize,
+                   "paramValue", paramValue, "paramValueSizeRet", paramValueSizeRet);
+
+    auto pCommandBuffer = castToObject<ClCommandBuffer>(commandBuffer);
+    if (!pCommandBuffer) {
+        retVal = CL_INVALID_COMMAND_BUFFER_KHR;
+        return retVal;
+    }
+
+    retVal = pCommandBuffer->getInfo(paramName, paramValueSize, paramValue, paramValueSizeRet);
+    return retVal;
+}
+
 #define RETURN_FUNC_PTR_IF_EXIST(name)                                  \
     {                                                                   \
         if (!strcmp(funcName, #name)) {                                 \
@@ -4442,6 +4749,17 @@ void *CL_API_CALL clGetExtensionFunctionAddress(const char *funcName) {
     RETURN_FUNC_PTR_IF_EXIST(clAddCommentINTEL);
     RETURN_FUNC_PTR_IF_EXIST(clEnqueueVerifyMemoryINTEL);
 
+    RETURN_FUNC_PTR_IF_EXIST(clCreateCommandBufferKHR);
+    RETURN_FUNC_PTR_IF_EXIST(clFinalizeCommandBufferKHR);
+    RETURN_FUNC_PTR_IF_EXIST(clRetainCommandBufferKHR);
+    RETURN_FUNC_PTR_IF_EXIST(clReleaseCommandBufferKHR);
+    RETURN_FUNC_PTR_IF_EXIST(clEnqueueCommandBufferKHR);
+    RETURN_FUNC_PTR_IF_EXIST(clCommandBarrierWithWaitListKHR);
+    RETURN_FUNC_PTR_IF_EXIST(clCommandCopyBufferKHR);
+    RETURN_FUNC_PTR_IF_EXIST(clCommandFillBufferKHR);
+    RETURN_FUNC_PTR_IF_EXIST(clCommandNDRangeKernelKHR);
+    RETURN_FUNC_PTR_IF_EXIST(clGetCommandBufferInfoKHR);
+
     RETURN_FUNC_PTR_IF_EXIST(clCreateTracingHandleINTEL);
     RETURN_FUNC_PTR_IF_EXIST(clSetTracingPointINTEL);
     RETURN_FUNC_PTR_IF_EXIST(clDestroyTracingHandleINTEL);
@@ -213,6 +213,10 @@ void ClDevice::initializeCaps() {
         deviceExtensions += "cl_khr_pci_bus_info ";
     }
 
+    if (DebugManager.flags.ExperimentalEnableClCommandBuffer.get() == 1) {
+        deviceExtensions += "cl_khr_command_buffer ";
+    }
+
     deviceInfo.deviceExtensions = deviceExtensions.c_str();
 
     std::vector<std::string> exposedBuiltinKernelsVector;
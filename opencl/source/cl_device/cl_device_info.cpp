@@ -298,6 +298,20 @@ cl_int ClDevice::getDeviceInfo(cl_device_info paramName,
         retSize = srcSize = sizeof(cl_device_feature_capabilities_intel);
         break;
     }
+    case CL_DEVICE_COMMAND_BUFFER_CAPABILITIES_KHR:
+        if (DebugManager.flags.ExperimentalEnableClCommandBuffer.get() == 1) {
+            param.bitfield = CL_COMMAND_BUFFER_CAPABILITY_SIMULTANEOUS_USE_KHR;
+            src = &param.bitfield;
+            retSize = srcSize = sizeof(cl_device_command_buffer_capabilities_khr);
+        }
+        break;
+    case CL_DEVICE_COMMAND_BUFFER_REQUIRED_QUEUE_PROPERTIES_KHR:
+        if (DebugManager.flags.ExperimentalEnableClCommandBuffer.get() == 1) {
+            param.bitfield = 0u;
+            src = &param.bitfield;
+            retSize = srcSize = sizeof(cl_command_queue_properties);
+        }
+        break;
     case CL_DEVICE_PCI_BUS_INFO_KHR:
         if (isPciBusInfoValid()) {
             src = &deviceInfo.pciBusInfo;
@@ -0,0 +1,404 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/command_queue/cl_command_buffer.h"
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/helpers/get_info.h"
+#include "shared/source/memory_manager/internal_allocation_storage.h"
+
+#include "opencl/source/cl_device/cl_device.h"
+#include "opencl/source/command_queue/command_queue.h"
+#include "opencl/source/event/event.h"
+#include "opencl/source/helpers/get_info_status_mapper.h"
+#include "opencl/source/helpers/task_information.h"
+#include "opencl/source/kernel/multi_device_kernel.h"
+#include "opencl/source/mem_obj/buffer.h"
+
+#include <array>
+
+namespace NEO {
+
+ClCommandBuffer *ClCommandBuffer::create(cl_uint numQueues, const cl_command_queue *queues,
+                                         const cl_command_buffer_properties_khr *properties, cl_int &errcodeRet) {
+    errcodeRet = CL_SUCCESS;
+    if (numQueues != 1u || queues == nullptr) {
+        errcodeRet = CL_INVALID_VALUE;
+        return nullptr;
+    }
+
+    auto commandQueue = castToObject<CommandQueue>(queues[0]);
+    if (commandQueue == nullptr) {
+        errcodeRet = CL_INVALID_COMMAND_QUEUE;
+        return nullptr;
+    }
+
+    // Replay relies on the queue executing recorded commands in order, so sync points need no translation
+    if (commandQueue->isOOQEnabled()) {
+        errcodeRet = CL_INCOMPATIBLE_COMMAND_QUEUE_KHR;
+        return nullptr;
+    }
+
+    cl_command_buffer_flags_khr flags = 0;
+    std::vector<cl_command_buffer_properties_khr> propertiesArray;
+    if (properties != nullptr) {
+        for (auto property = properties; *property != 0; property += 2) {
+            if (property[0] != CL_COMMAND_BUFFER_FLAGS_KHR ||
+                (property[1] & ~static_cast<cl_command_buffer_properties_khr>(CL_COMMAND_BUFFER_SIMULTANEOUS_USE_KHR)) != 0) {
+                errcodeRet = CL_INVALID_VALUE;
+                return nullptr;
+            }
+            flags |= property[1];
+            propertiesArray.push_back(property[0]);
+            propertiesArray.push_back(property[1]);
+        }
+        propertiesArray.push_back(0);
+    }
+
+    return new ClCommandBuffer(commandQueue, flags, std::move(propertiesArray));
+}
+
+ClCommandBuffer::ClCommandBuffer(CommandQueue *commandQueue, cl_command_buffer_flags_khr flags,
+                                 std::vector<cl_command_buffer_properties_khr> &&properties)
+    : commandQueue(commandQueue), flags(flags), properties(std::move(properties)) {
+    commandQueue->incRefInternal();
+}
+
+ClCommandBuffer::~ClCommandBuffer() {
+    if (lastSubmission) {
+        lastSubmission->decRefInternal();
+    }
+    releaseEncodedCommands();
+    commands.clear();
+    for (auto kernel : recordedKernels) {
+        kernel->release();
+    }
+    for (auto memObj : recordedMemObjs) {
+        memObj->decRefInternal();
+    }
+    commandQueue->decRefInternal();
+}
+
+cl_int ClCommandBuffer::validateSyncPoints(cl_uint numSyncPointsInWaitList, const cl_sync_point_khr *syncPointWaitList) const {
+    if ((numSyncPointsInWaitList > 0) != (syncPointWaitList != nullptr)) {
+        return CL_INVALID_SYNC_POINT_WAIT_LIST_KHR;
+    }
+    for (cl_uint i = 0; i < numSyncPointsInWaitList; i++) {
+        if (syncPointWaitList[i] == 0 || syncPointWaitList[i] > commands.size()) {
+            return CL_INVALID_SYNC_POINT_WAIT_LIST_KHR;
+        }
+    }
+    return CL_SUCCESS;
+}
+
+cl_int ClCommandBuffer::recordCommand(RecordedCommand &&command, cl_sync_point_khr *syncPoint) {
+    commands.push_back(std::move(command));
+    if (syncPoint) {
+        *syncPoint = static_cast<cl_sync_point_khr>(commands.size());
+    }
+    return CL_SUCCESS;
+}
+
+void ClCommandBuffer::retainMemObj(MemObj *memObj) {
+    memObj->incRefInternal();
+    recordedMemObjs.push_back(memObj);
+}
+
+cl_int ClCommandBuffer::recordNDRangeKernel(MultiDeviceKernel *multiDeviceKernel, cl_uint workDim, const size_t *globalWorkOffset,
+                                            const size_t *globalWorkSize, const size_t *localWorkSize,
+                                            cl_uint numSyncPointsInWaitList, const cl_sync_point_khr *syncPointWaitList, cl_sync_point_khr *syncPoint) {
+    if (finalized) {
+        return CL_INVALID_OPERATION;
+    }
+    auto retVal = validateSyncPoints(numSyncPointsInWaitList, syncPointWaitList);
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
+    if (workDim == 0 || workDim > 3) {
+        return CL_INVALID_WORK_DIMENSION;
+    }
+    if (globalWorkSize == nullptr) {
+        return CL_INVALID_GLOBAL_WORK_SIZE;
+    }
+
+    // Arguments are captured at record time, later clSetKernelArg calls must not affect the recorded command
+    auto recordedKernel = MultiDeviceKernel::create(multiDeviceKernel->getProgram(), multiDeviceKernel->getKernelInfos(), &retVal);
+    if (recordedKernel == nullptr) {
+        return retVal;
+    }
+    retVal = recordedKernel->cloneKernel(multiDeviceKernel);
+    if (retVal != CL_SUCCESS) {
+        recordedKernel->release();
+        return retVal;
+    }
+    recordedKernels.push_back(recordedKernel);
+
+    std::array<size_t, 3> offset = {};
+    std::array<size_t, 3> gws = {};
+    std::array<size_t, 3> lws = {};
+    for (cl_uint dim = 0; dim < workDim; dim++) {
+        offset[dim] = globalWorkOffset ? globalWorkOffset[dim] : 0;
+        gws[dim] = globalWorkSize[dim];
+        lws[dim] = localWorkSize ? localWorkSize[dim] : 0;
+    }
+    const bool hasLocalWorkSize = localWorkSize != nullptr;
+    auto kernel = recordedKernel->getKernel(commandQueue->getDevice().getRootDeviceIndex());
+
+    auto enqueue = [=](CommandQueue &queue) {
+        return queue.enqueueKernel(kernel, workDim, offset.data(), gws.data(), hasLocalWorkSize ? lws.data() : nullptr, 0, nullptr, nullptr);
+    };
+    RecordedCommand command = {enqueue, true};
+    return recordCommand(std::move(command), syncPoint);
+}
+
+cl_int ClCommandBuffer::recordBarrier(cl_uint numSyncPointsInWaitList, const cl_sync_point_khr *syncPointWaitList, cl_sync_point_khr *syncPoint) {
+    if (finalized) {
+        return CL_INVALID_OPERATION;
+    }
+    auto retVal = validateSyncPoints(numSyncPointsInWaitList, syncPointWaitList);
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
+
+    // the in-order queue already keeps recorded commands ordered, so encoded replay has nothing to submit for a barrier
+    auto enqueue = [](CommandQueue &queue) {
+        return queue.enqueueBarrierWithWaitList(0, nullptr, nullptr);
+    };
+    RecordedCommand command = {enqueue, false};
+    return recordCommand(std::move(command), syncPoint);
+}
+
+cl_int ClCommandBuffer::recordCopyBuffer(Buffer *srcBuffer, Buffer *dstBuffer, size_t srcOffset, size_t dstOffset, size_t size,
+                                         cl_uint numSyncPointsInWaitList, const cl_sync_point_khr *syncPointWaitList, cl_sync_point_khr *syncPoint) {
+    if (finalized) {
+        return CL_INVALID_OPERATION;
+    }
+    auto retVal = validateSyncPoints(numSyncPointsInWaitList, syncPointWaitList);
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
+    retainMemObj(srcBuffer);
+    retainMemObj(dstBuffer);
+
+    auto enqueue = [=](CommandQueue &queue) {
+        return queue.enqueueCopyBuffer(srcBuffer, dstBuffer, srcOffset, dstOffset, size, 0, nullptr, nullptr);
+    };
+    RecordedCommand command = {enqueue, true};
+    return recordCommand(std::move(command), syncPoint);
+}
+
+cl_int ClCommandBuffer::recordFillBuffer(Buffer *buffer, const void *pattern, size_t patternSize, size_t offset, size_t size,
+                                         cl_uint numSyncPointsInWaitList, const cl_sync_point_khr *syncPointWaitList, cl_sync_point_khr *syncPoint) {
+    if (finalized) {
+        return CL_INVALID_OPERATION;
+    }
+    auto retVal = validateSyncPoints(numSyncPointsInWaitList, syncPointWaitList);
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
+    retainMemObj(buffer);
+
+    auto patternBegin = static_cast<const uint8_t *>(pattern);
+    std::vector<uint8_t> recordedPattern(patternBegin, patternBegin + patternSize);
+
+    auto enqueue = [=](CommandQueue &queue) {
+        return queue.enqueueFillBuffer(buffer, recordedPattern.data(), recordedPattern.size(), offset, size, 0, nullptr, nullptr);
+    };
+    RecordedCommand command = {enqueue, true};
+    return recordCommand(std::move(command), syncPoint);
+}
+
+cl_int ClCommandBuffer::finalize() {
+    if (finalized) {
+        return CL_INVALID_OPERATION;
+    }
+    finalized = true;
+    encodeCommands();
+    return CL_SUCCESS;
+}
+
+void ClCommandBuffer::encodeCommands() {
+    auto &queue = *commandQueue;
+    TakeOwnershipWrapper<CommandQueue> queueOwnership(queue);
+
+    auto encoded = true;
+    queue.startCommandRecording(encodedCommands, encodedAllocations);
+    for (auto &command : commands) {
+        if (!command.dispatchesWork) {
+            continue;
+        }
+        auto numEncodedCommands = encodedCommands.size();
+        auto retVal = command.enqueue(queue);
+        if (retVal != CL_SUCCESS || encodedCommands.size() != numEncodedCommands + 1 || encodedCommands.back() == nullptr) {
+            encoded = false;
+            break;
+        }
+    }
+    queue.stopCommandRecording();
+
+    if (!encoded) {
+        releaseEncodedCommands();
+    }
+}
+
+void ClCommandBuffer::releaseEncodedCommands() {
+    encodedCommands.clear();
+
+    auto storageForAllocations = commandQueue->getGpgpuCommandStreamReceiver().getInternalAllocationStorage();
+    for (auto allocation : encodedAllocations) {
+        storageForAllocations->storeAllocation(std::unique_ptr<GraphicsAllocation>(allocation), REUSABLE_ALLOCATION);
+    }
+    encodedAllocations.clear();
+}
+
+cl_int ClCommandBuffer::submitEncodedCommands() {
+    auto &queue = *commandQueue;
+    for (auto &command : encodedCommands) {
+        auto &completionStamp = command->submit(queue.taskLevel + 1, false);
+        if (completionStamp.taskCount > CompletionStamp::notReady) {
+            return CommandQueue::getErrorCodeFromTaskCount(completionStamp.taskCount);
+        }
+        queue.updateFromCompletionStamp(completionStamp, nullptr);
+    }
+
+    auto lastNodes = encodedCommands.back()->peekTimestampPacketNodes();
+    if (lastNodes) {
+        queue.setTimestampPacketNodes(*lastNodes);
+    }
+    return CL_SUCCESS;
+}
+
+bool ClCommandBuffer::isSubmissionPending() {
+    if (lastSubmission == nullptr) {
+        return false;
+    }
+    if (!lastSubmission->isCompleted()) {
+        return true;
+    }
+    lastSubmission->decRefInternal();
+    lastSubmission = nullptr;
+    return false;
+}
+
+cl_command_buffer_state_khr ClCommandBuffer::getState() {
+    if (!finalized) {
+        return CL_COMMAND_BUFFER_STATE_RECORDING_KHR;
+    }
+    return isSubmissionPending() ? CL_COMMAND_BUFFER_STATE_PENDING_KHR : CL_COMMAND_BUFFER_STATE_EXECUTABLE_KHR;
+}
+
+cl_int ClCommandBuffer::enqueue(cl_uint numQueues, cl_command_queue *queues,
+                                cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event) {
+    if ((numQueues > 0) != (queues != nullptr) || numQueues > 1) {
+        return CL_INVALID_VALUE;
+    }
+    if (numQueues == 1 && castToObject<CommandQueue>(queues[0]) != commandQueue) {
+        return CL_INCOMPATIBLE_COMMAND_QUEUE_KHR;
+    }
+    if (!finalized) {
+        return CL_INVALID_OPERATION;
+    }
+    if (!(flags & CL_COMMAND_BUFFER_SIMULTANEOUS_USE_KHR) && isSubmissionPending()) {
+        return CL_INVALID_OPERATION;
+    }
+
+    auto &queue = *commandQueue;
+    TakeOwnershipWrapper<CommandQueue> queueOwnership(queue);
+
+    // encoded streams are reused as they are, so they are only submitted once their previous submission completed
+    const bool encodedReplay = !encodedCommands.empty() && !isSubmissionPending();
+
+    cl_int retVal = CL_SUCCESS;
+    if (encodedReplay) {
+        // the barrier orders the encoded streams after earlier work on the queue
+        retVal = queue.enqueueBarrierWithWaitList(numEventsInWaitList, eventWaitList, nullptr);
+    } else if (numEventsInWaitList > 0) {
+        retVal = queue.enqueueMarkerWithWaitList(numEventsInWaitList, eventWaitList, nullptr);
+    }
+
+    if (encodedReplay && retVal == CL_SUCCESS && !queue.isQueueBlocked()) {
+        retVal = submitEncodedCommands();
+    } else {
+        for (auto &command : commands) {
+            if (retVal != CL_SUCCESS) {
+                break;
+            }
+            retVal = command.enqueue(queue);
+        }
+    }
+
+    // commands replayed before a failure are already enqueued, so they are tracked and flushed as a submission as well
+    cl_event submission = nullptr;
+    auto markerRetVal = queue.enqueueMarkerWithWaitList(0, nullptr, &submission);
+
+    if (submission != nullptr) {
+        auto submissionEvent = castToObject<Event>(submission);
+        submissionEvent->setCmdType(CL_COMMAND_COMMAND_BUFFER_KHR);
+        if (lastSubmission) {
+            lastSubmission->decRefInternal();
+        }
+        submissionEvent->incRefInternal();
+        lastSubmission = submissionEvent;
+        if (event && retVal == CL_SUCCESS) {
+            *event = submission;
+        } else {
+            submissionEvent->release();
+        }
+    }
+
+    auto flushRetVal = queue.flush();
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
+    if (markerRetVal != CL_SUCCESS) {
+        return markerRetVal;
+    }
+    return flushRetVal;
+}
+
+cl_int ClCommandBuffer::getInfo(cl_command_buffer_info_khr paramName, size_t paramValueSize,
+                                void *paramValue, size_t *paramValueSizeRet) {
+    size_t srcSize = GetInfo::invalidSourceSize;
+    const void *src = nullptr;
+    cl_command_queue queue = commandQueue;
+    cl_uint numQueues = 1u;
+    cl_uint refCount = 0u;
+    cl_command_buffer_state_khr state = 0u;
+
+    switch (paramName) {
+    case CL_COMMAND_BUFFER_QUEUES_KHR:
+        src = &queue;
+        srcSize = sizeof(queue);
+        break;
+    case CL_COMMAND_BUFFER_NUM_QUEUES_KHR:
+        src = &numQueues;
+        srcSize = sizeof(numQueues);
+        break;
+    case CL_COMMAND_BUFFER_REFERENCE_COUNT_KHR:
+        refCount = static_cast<cl_uint>(getReference());
+        src = &refCount;
+        srcSize = sizeof(refCount);
+        break;
+    case CL_COMMAND_BUFFER_STATE_KHR:
+        state = getState();
+        src = &state;
+        srcSize = sizeof(state);
+        break;
+    case CL_COMMAND_BUFFER_PROPERTIES_ARRAY_KHR:
+        src = properties.data();
+        srcSize = properties.size() * sizeof(cl_command_buffer_properties_khr);
+        break;
+    default:
+        break;
+    }
+
+    auto getInfoStatus = GetInfo::getInfo(paramValue, paramValueSize, src, srcSize);
+    GetInfo::setParamValueReturnSize(paramValueSizeRet, srcSize, getInfoStatus);
+    return changeGetInfoStatusToCLResultType(getInfoStatus);
+}
+
+} // namespace NEO
@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "opencl/source/api/cl_types.h"
+#include "opencl/source/helpers/base_object.h"
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace NEO {
+
+class Buffer;
+class Command;
+class CommandQueue;
+class GraphicsAllocation;
+class Event;
+class MemObj;
+class MultiDeviceKernel;
+
+template <>
+struct OpenCLObjectMapper<_cl_command_buffer_khr> {
+    typedef class ClCommandBuffer DerivedType;
+};
+
+// Commands are recorded once and encoded into their own command streams at finalize. Every enqueue submits
+// the encoded streams as they are; the recorded enqueues are replayed instead when encoding was not possible
+// or when the encoded streams are still in use by a previous submission.
+class ClCommandBuffer : public BaseObject<_cl_command_buffer_khr> {
+  public:
+    static const cl_ulong objectMagic = 0x8C1A3F65D27B04E9ULL;
+
+    static ClCommandBuffer *create(cl_uint numQueues, const cl_command_queue *queues,
+                                   const cl_command_buffer_properties_khr *properties, cl_int &errcodeRet);
+
+    ~ClCommandBuffer() override;
+
+    cl_int recordNDRangeKernel(MultiDeviceKernel *multiDeviceKernel, cl_uint workDim, const size_t *globalWorkOffset,
+                               const size_t *globalWorkSize, const size_t *localWorkSize,
+                               cl_uint numSyncPointsInWaitList, const cl_sync_point_khr *syncPointWaitList, cl_sync_point_khr *syncPoint);
+
+    cl_int recordBarrier(cl_uint numSyncPointsInWaitList, const cl_sync_point_khr *syncPointWaitList, cl_sync_point_khr *syncPoint);
+
+    cl_int recordCopyBuffer(Buffer *srcBuffer, Buffer *dstBuffer, size_t srcOffset, size_t dstOffset, size_t size,
+                            cl_uint numSyncPointsInWaitList, const cl_sync_point_khr *syncPointWaitList, cl_sync_point_khr *syncPoint);
+
+    cl_int recordFillBuffer(Buffer *buffer, const void *pattern, size_t patternSize, size_t offset, size_t size,
+                            cl_uint numSyncPointsInWaitList, const cl_sync_point_khr *syncPointWaitList, cl_sync_point_khr *syncPoint);
+
+    cl_int finalize();
+
+    cl_int enqueue(cl_uint numQueues, cl_command_queue *queues,
+                   cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event);
+
+    cl_int getInfo(cl_command_buffer_info_khr paramName, size_t paramValueSize,
+                   void *paramValue, size_t *paramValueSizeRet);
+
+    CommandQueue *getCommandQueue() const { return commandQueue; }
+    size_t getNumCommands() const { return commands.size(); }
+    size_t getNumEncodedCommands() const { return encodedCommands.size(); }
+    cl_command_buffer_state_khr getState();
+
+  protected:
+    struct RecordedCommand {
+        std::function<cl_int(CommandQueue &)> enqueue;
+        bool dispatchesWork = true;
+    };
+
+    ClCommandBuffer(CommandQueue *commandQueue, cl_command_buffer_flags_khr flags,
+                    std::vector<cl_command_buffer_properties_khr> &&properties);
+
+    cl_int validateSyncPoints(cl_uint numSyncPointsInWaitList, const cl_sync_point_khr *syncPointWaitList) const;
+    cl_int recordCommand(RecordedCommand &&command, cl_sync_point_khr *syncPoint);
+    void retainMemObj(MemObj *memObj);
+    bool isSubmissionPending();
+    void encodeCommands();
+    void releaseEncodedCommands();
+    cl_int submitEncodedCommands();
+
+    CommandQueue *commandQueue = nullptr;
+    const cl_command_buffer_flags_khr flags = 0;
+    const std::vector<cl_command_buffer_properties_khr> properties;
+    std::vector<RecordedCommand> commands;
+    std::vector<std::unique_ptr<Command>> encodedCommands;
+    std::vector<GraphicsAllocation *> encodedAllocations;
+    std::vector<MultiDeviceKernel *> recordedKernels;
+    std::vector<MemObj *> recordedMemObjs;
+    Event *lastSubmission = nullptr;
+    bool finalized = false;
+};
+} // namespace NEO
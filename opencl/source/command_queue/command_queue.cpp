@@ -936,6 +936,47 @@ void CommandQueue::obtainNewTimestampPacketNodes(size_t numberOfNodes, Timestamp
     }
 }
 
+void CommandQueue::startCommandRecording(std::vector<std::unique_ptr<Command>> &commands, std::vector<GraphicsAllocation *> &allocations) {
+    UNRECOVERABLE_IF(recordedCommands != nullptr);
+    recordedCommands = &commands;
+    recordedAllocations = &allocations;
+    taskLevelBeforeRecording = taskLevel;
+    flushStampBeforeRecording = flushStamp->peekStamp();
+    if (timestampPacketContainer) {
+        // recorded commands are ordered against earlier work when they are submitted, not through these nodes
+        timestampPacketsBeforeRecording.swapNodes(*timestampPacketContainer);
+    }
+}
+
+void CommandQueue::stopCommandRecording() {
+    UNRECOVERABLE_IF(recordedCommands == nullptr);
+    recordedCommands = nullptr;
+    recordedAllocations = nullptr;
+    taskLevel = taskLevelBeforeRecording;
+    flushStamp->setStamp(flushStampBeforeRecording);
+    if (timestampPacketContainer) {
+        timestampPacketContainer->swapNodes(timestampPacketsBeforeRecording);
+        timestampPacketsBeforeRecording.moveNodesToNewContainer(*deferredTimestampPackets);
+    }
+}
+
+void CommandQueue::storeRecordedCommand(std::unique_ptr<Command> &&command) {
+    UNRECOVERABLE_IF(recordedCommands == nullptr);
+    recordedCommands->push_back(std::move(command));
+}
+
+void CommandQueue::storeRecordedAllocation(GraphicsAllocation *allocation) {
+    UNRECOVERABLE_IF(recordedAllocations == nullptr);
+    recordedAllocations->push_back(allocation);
+}
+
+void CommandQueue::setTimestampPacketNodes(const TimestampPacketContainer &nodes) {
+    if (timestampPacketContainer) {
+        timestampPacketContainer->moveNodesToNewContainer(*deferredTimestampPackets);
+        timestampPacketContainer->assignAndIncrementNodesRefCounts(nodes);
+    }
+}
+
 size_t CommandQueue::estimateTimestampPacketNodesCount(const MultiDispatchInfo &dispatchInfo) const {
     size_t nodesCount = dispatchInfo.size();
     auto mainKernel = dispatchInfo.peekMainKernel();
@@ -31,6 +31,7 @@ namespace NEO {
 class BarrierCommand;
 class Buffer;
 class ClDevice;
+class Command;
 class Context;
 class Event;
 class EventBuilder;
@@ -280,6 +281,8 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
         return !!(this->getCommandQueueProperties() & CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE);
     }
 
+    bool queueDependenciesClearRequired() const;
+
     bool isPerfCountersEnabled() const {
         return perfCountersEnabled;
     }
@@ -350,6 +353,14 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
     void setStallingCommandsOnNextFlush(bool isStallingCommandsOnNextFlushRequired) { stallingCommandsOnNextFlushRequired = isStallingCommandsOnNextFlushRequired; }
     bool isStallingCommandsOnNextFlushRequired() const { return stallingCommandsOnNextFlushRequired; }
 
+    // while recording, blocked commands are stored instead of being attached to events and the queue state is restored afterwards
+    void startCommandRecording(std::vector<std::unique_ptr<Command>> &commands, std::vector<GraphicsAllocation *> &allocations);
+    void stopCommandRecording();
+    bool isRecordingCommands() const { return recordedCommands != nullptr; }
+    void storeRecordedCommand(std::unique_ptr<Command> &&command);
+    void storeRecordedAllocation(GraphicsAllocation *allocation);
+    void setTimestampPacketNodes(const TimestampPacketContainer &nodes);
+
     // taskCount of last task
     TaskCountType taskCount = 0;
 
@@ -390,7 +401,6 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
     bool bufferCpuCopyAllowed(Buffer *buffer, cl_command_type commandType, cl_bool blocking, size_t size, void *ptr,
                               cl_uint numEventsInWaitList, const cl_event *eventWaitList);
     void providePerformanceHint(TransferProperties &transferProperties);
-    bool queueDependenciesClearRequired() const;
     bool blitEnqueueAllowed(const CsrSelectionArgs &args) const;
     MOCKABLE_VIRTUAL void migrateMultiGraphicsAllocationsIfRequired(const BuiltinOpParams &operationParams, CommandStreamReceiver &csr);
 
@@ -453,6 +463,12 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
     std::array<BcsTimestampPacketContainers, bcsInfoMaskSize> bcsTimestampPacketContainers;
     bool stallingCommandsOnNextFlushRequired = false;
     bool splitBarrierRequired = false;
+
+    std::vector<std::unique_ptr<Command>> *recordedCommands = nullptr;
+    std::vector<GraphicsAllocation *> *recordedAllocations = nullptr;
+    TimestampPacketContainer timestampPacketsBeforeRecording;
+    TaskCountType taskLevelBeforeRecording = 0;
+    FlushStamp flushStampBeforeRecording = 0;
 };
 
 template <typename PtrType>
@@ -7,8 +7,10 @@
 
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/device/device.h"
+#include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/helpers/flush_stamp.h"
 #include "shared/source/helpers/get_info.h"
+#include "shared/source/utilities/cpu_copy.h"
 #include "shared/source/utilities/logger.h"
 
 #include "opencl/source/command_queue/command_queue.h"
@@ -135,11 +137,12 @@ void *CommandQueue::cpuDataTransferHandler(TransferProperties &transferPropertie
             }
             break;
         case CL_COMMAND_READ_BUFFER:
-            memcpy_s(transferProperties.ptr, transferProperties.size[0], transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0]);
+            CpuCopy::copy(transferProperties.ptr, transferProperties.size[0], transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0], false, getDevice().getExecutionEnvironment()->cpuCopyThreadPool.get());
             eventCompleted = true;
             break;
         case CL_COMMAND_WRITE_BUFFER:
-            memcpy_s(transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0], transferProperties.ptr, transferProperties.size[0]);
+            CpuCopy::copy(transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0], transferProperties.ptr, transferProperties.size[0], transferProperties.lockedPtr != nullptr,
+                          getDevice().getExecutionEnvironment()->cpuCopyThreadPool.get());
             eventCompleted = true;
             modifySimulationFlags = true;
             break;
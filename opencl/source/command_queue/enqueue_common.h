@@ -679,9 +679,23 @@ void CommandQueueHw<GfxFamily>::processDispatchForMarkerWithTimestampPacket(Comm
 
 template <typename GfxFamily>
 void CommandQueueHw<GfxFamily>::obtainTaskLevelAndBlockedStatus(TaskCountType &taskLevel, cl_uint &numEventsInWaitList, const cl_event *&eventWaitList, bool &blockQueueStatus, unsigned int commandType) {
-    auto isQueueBlockedStatus = isQueueBlocked();
-    taskLevel = getTaskLevelFromWaitList(this->taskLevel, numEventsInWaitList, eventWaitList);
-    blockQueueStatus = (taskLevel == CompletionStamp::notReady) || isQueueBlockedStatus;
+    if (isRecordingCommands()) {
+        // recorded commands are encoded into their own command streams and only submitted on replay
+        taskLevel = this->taskLevel;
+        blockQueueStatus = true;
+        return;
+    }
+
+    // callers own the queue, so virtualEvent cannot change here; an in-order enqueue without dependencies is never blocked
+    auto dependencyFreeEnqueue = !isOOQEnabled() && numEventsInWaitList == 0 && this->virtualEvent == nullptr && this->taskLevel != CompletionStamp::notReady;
+    if (dependencyFreeEnqueue) {
+        taskLevel = this->taskLevel;
+        blockQueueStatus = false;
+    } else {
+        auto isQueueBlockedStatus = isQueueBlocked();
+        taskLevel = getTaskLevelFromWaitList(this->taskLevel, numEventsInWaitList, eventWaitList);
+        blockQueueStatus = (taskLevel == CompletionStamp::notReady) || isQueueBlockedStatus;
+    }
 
     auto taskLevelUpdateRequired = isTaskLevelUpdateRequired(taskLevel, eventWaitList, numEventsInWaitList, commandType);
     if (taskLevelUpdateRequired) {
@@ -951,29 +965,6 @@ void CommandQueueHw<GfxFamily>::enqueueBlocked(
 
     TakeOwnershipWrapper<CommandQueueHw<GfxFamily>> queueOwnership(*this);
 
-    // store previous virtual event as it will add dependecies to new virtual event
-    if (this->virtualEvent) {
-        DBG_LOG(EventsDebugEnable, "enqueueBlocked", "previousVirtualEvent", this->virtualEvent);
-    }
-
-    EventBuilder internalEventBuilder;
-    EventBuilder *eventBuilder;
-    // check if event will be exposed externally
-    if (externalEventBuilder.getEvent()) {
-        externalEventBuilder.getEvent()->incRefInternal();
-        eventBuilder = &externalEventBuilder;
-        DBG_LOG(EventsDebugEnable, "enqueueBlocked", "output event as virtualEvent", virtualEvent);
-    } else {
-        // it will be an internal event
-        internalEventBuilder.create<VirtualEvent>(this, context);
-        eventBuilder = &internalEventBuilder;
-        DBG_LOG(EventsDebugEnable, "enqueueBlocked", "new virtualEvent", eventBuilder->getEvent());
-    }
-    auto outEvent = eventBuilder->getEvent();
-
-    // update queue taskCount
-    taskCount = outEvent->getCompletionStamp();
-
     std::unique_ptr<Command> command;
     bool storeTimestampPackets = false;
 
@@ -987,6 +978,10 @@ void CommandQueueHw<GfxFamily>::enqueueBlocked(
         storeTimestampPackets = (timestampPacketContainer != nullptr);
     }
 
+    // only kernels without CPU work after submission can be submitted again as recorded
+    const bool resubmittable = enqueueProperties.operation == EnqueueProperties::Operation::GpuKernel && blockedCommandsData &&
+                               blockedCommandsData->blitPropertiesContainer.size() == 0 && printfHandler == nullptr && multiRootDeviceSyncNode == nullptr;
+
     if (enqueueProperties.operation != EnqueueProperties::Operation::GpuKernel) {
         command = std::make_unique<CommandWithoutKernel>(*this, blockedCommandsData);
     } else {
@@ -1028,6 +1023,39 @@ void CommandQueueHw<GfxFamily>::enqueueBlocked(
         command->setEventsRequest(eventsRequest);
     }
 
+    if (isRecordingCommands()) {
+        if (resubmittable) {
+            static_cast<CommandComputeKernel *>(command.get())->makeResubmittable();
+            storeRecordedCommand(std::move(command));
+        } else {
+            storeRecordedCommand(nullptr);
+        }
+        return;
+    }
+
+    // store previous virtual event as it will add dependecies to new virtual event
+    if (this->virtualEvent) {
+        DBG_LOG(EventsDebugEnable, "enqueueBlocked", "previousVirtualEvent", this->virtualEvent);
+    }
+
+    EventBuilder internalEventBuilder;
+    EventBuilder *eventBuilder;
+    // check if event will be exposed externally
+    if (externalEventBuilder.getEvent()) {
+        externalEventBuilder.getEvent()->incRefInternal();
+        eventBuilder = &externalEventBuilder;
+        DBG_LOG(EventsDebugEnable, "enqueueBlocked", "output event as virtualEvent", virtualEvent);
+    } else {
+        // it will be an internal event
+        internalEventBuilder.create<VirtualEvent>(this, context);
+        eventBuilder = &internalEventBuilder;
+        DBG_LOG(EventsDebugEnable, "enqueueBlocked", "new virtualEvent", eventBuilder->getEvent());
+    }
+    auto outEvent = eventBuilder->getEvent();
+
+    // update queue taskCount
+    taskCount = outEvent->getCompletionStamp();
+
     outEvent->setCommand(std::move(command));
 
     eventBuilder->addParentEvents(ArrayRef<const cl_event>(eventsRequest.eventWaitList, eventsRequest.numEventsInWaitList));
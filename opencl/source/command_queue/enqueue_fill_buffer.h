@@ -86,6 +86,12 @@ cl_int CommandQueueHw<GfxFamily>::enqueueFillBuffer(
         eventWaitList,
         event);
 
+    if (isRecordingCommands()) {
+        // the recorded command reads the pattern on every submission
+        storeRecordedAllocation(patternAllocation);
+        return enqueueResult;
+    }
+
     auto storageForAllocation = getGpgpuCommandStreamReceiver().getInternalAllocationStorage();
     storageForAllocation->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(patternAllocation), REUSABLE_ALLOCATION, taskCount);
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2022 Intel Corporation
+ * Copyright (C) 2018-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -100,6 +100,16 @@ cl_int CommandQueueHw<GfxFamily>::enqueueKernel(
         localWkgSizeToPass = reqdWorkgroupSize;
     }
 
+    if (!localWorkSizeIn && !haveRequiredWorkGroupSize && kernelInfo.builtinDispatchBuilder == nullptr) {
+        auto tunedLocalWorkSize = kernel.getTunedLocalWorkSize(workDim, Vec3<size_t>(region));
+        if (tunedLocalWorkSize.x != 0) {
+            workGroupSize[0] = tunedLocalWorkSize.x;
+            workGroupSize[1] = tunedLocalWorkSize.y;
+            workGroupSize[2] = tunedLocalWorkSize.z;
+            localWkgSizeToPass = workGroupSize;
+        }
+    }
+
     NullSurface s;
     Surface *surfaces[] = {&s};
 
@@ -15,6 +15,7 @@
 #include "shared/source/helpers/get_info.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/ptr_math.h"
+#include "shared/source/memory_manager/allocations_release_queue.h"
 #include "shared/source/memory_manager/deferred_deleter.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
@@ -74,6 +75,7 @@ Context::~Context() {
     if (driverDiagnostics) {
         delete driverDiagnostics;
     }
+    allocationsReleaseQueue.reset();
     if (memoryManager && memoryManager->isAsyncDeleterEnabled()) {
         memoryManager->getDeferredDeleter()->removeClient();
     }
@@ -264,6 +266,9 @@ bool Context::createImpl(const cl_context_properties *properties,
         if (memoryManager->isAsyncDeleterEnabled()) {
             memoryManager->getDeferredDeleter()->addClient();
         }
+        if (DebugManager.flags.ExperimentalMemObjReleaseQueueSize.get() > 0) {
+            allocationsReleaseQueue = std::make_unique<AllocationsReleaseQueue>(*memoryManager, static_cast<size_t>(DebugManager.flags.ExperimentalMemObjReleaseQueueSize.get()));
+        }
 
         bool anySvmSupport = false;
         for (auto &device : devices) {
@@ -504,29 +509,38 @@ bool Context::BufferPoolAllocator::isAggregatedSmallBuffersEnabled(Context *cont
            (isSupportedForSingleDeviceContexts && context->isSingleDeviceContext());
 }
 
-Context::BufferPoolAllocator::BufferPool::BufferPool(Context *context) : memoryManager(context->memoryManager) {
+Context::BufferPoolAllocator::BufferPool::BufferPool(Context *context, uint32_t sizeClass) : memoryManager(context->memoryManager),
+                                                                                           sizeClass(sizeClass) {
     static constexpr cl_mem_flags flags{};
     [[maybe_unused]] cl_int errcodeRet{};
     Buffer::AdditionalBufferCreateArgs bufferCreateArgs{};
     bufferCreateArgs.doNotProvidePerformanceHints = true;
     bufferCreateArgs.makeAllocationLockable = true;
+    bufferCreateArgs.doNotUseBufferPool = true;
     mainStorage.reset(Buffer::create(context,
                                      flags,
-                                     BufferPoolAllocator::aggregatedSmallBuffersPoolSize,
+                                     BufferPoolAllocator::sizeClasses[sizeClass].poolSize,
                                      nullptr,
                                      bufferCreateArgs,
                                      errcodeRet));
     if (mainStorage) {
-        chunkAllocator.reset(new HeapAllocator(BufferPoolAllocator::startingOffset,
-                                               BufferPoolAllocator::aggregatedSmallBuffersPoolSize,
-                                               BufferPoolAllocator::chunkAlignment));
+        resetChunkAllocator();
         context->decRefInternal();
     }
 }
 
 Context::BufferPoolAllocator::BufferPool::BufferPool(BufferPool &&bufferPool) : memoryManager(bufferPool.memoryManager),
                                                                                 mainStorage(std::move(bufferPool.mainStorage)),
-                                                                                chunkAllocator(std::move(bufferPool.chunkAllocator)) {}
+                                                                                chunkAllocator(std::move(bufferPool.chunkAllocator)),
+                                                                                sizeClass(bufferPool.sizeClass) {}
+
+void Context::BufferPoolAllocator::BufferPool::resetChunkAllocator() {
+    const auto &poolSizeClass = BufferPoolAllocator::sizeClasses[sizeClass];
+    // offset 0 is reserved by HeapAllocator for failed allocations, so chunks start one alignment unit in
+    chunkAllocator.reset(new HeapAllocator(poolSizeClass.chunkAlignment,
+                                           poolSizeClass.poolSize,
+                                           poolSizeClass.chunkAlignment));
+}
 
 Buffer *Context::BufferPoolAllocator::BufferPool::allocate(const MemoryProperties &memoryProperties,
                                                            cl_mem_flags flags,
@@ -540,7 +554,7 @@ Buffer *Context::BufferPoolAllocator::BufferPool::allocate(const MemoryPropertie
     if (bufferRegion.origin == 0) {
         return nullptr;
     }
-    bufferRegion.origin -= BufferPoolAllocator::startingOffset;
+    bufferRegion.origin -= BufferPoolAllocator::sizeClasses[sizeClass].chunkAlignment;
     bufferRegion.size = requestedSize;
     auto bufferFromPool = mainStorage->createSubBuffer(flags, flagsIntel, &bufferRegion, errcodeRet);
     bufferFromPool->createFunction = mainStorage->createFunction;
@@ -559,14 +573,12 @@ bool Context::BufferPoolAllocator::BufferPool::drain() {
         }
     }
 
-    chunkAllocator.reset(new HeapAllocator(BufferPoolAllocator::startingOffset,
-                                           BufferPoolAllocator::aggregatedSmallBuffersPoolSize,
-                                           BufferPoolAllocator::chunkAlignment));
+    resetChunkAllocator();
     return true;
 }
 
-void Context::BufferPoolAllocator::addNewBufferPool() {
-    Context::BufferPoolAllocator::BufferPool bufferPool(context);
+void Context::BufferPoolAllocator::addNewBufferPool(uint32_t sizeClass) {
+    Context::BufferPoolAllocator::BufferPool bufferPool(context, sizeClass);
     if (bufferPool.mainStorage) {
         bufferPools.push_back(std::move(bufferPool));
     }
@@ -574,7 +586,10 @@ void Context::BufferPoolAllocator::addNewBufferPool() {
 
 void Context::BufferPoolAllocator::initAggregatedSmallBuffers(Context *context) {
     this->context = context;
-    addNewBufferPool();
+    if (DebugManager.flags.ExperimentalBufferPoolSizeClasses.get() != -1) {
+        enabledSizeClasses = static_cast<uint32_t>(std::clamp(DebugManager.flags.ExperimentalBufferPoolSizeClasses.get(), 1, static_cast<int32_t>(sizeClasses.size())));
+    }
+    addNewBufferPool(0u);
 }
 
 bool Context::BufferPoolAllocator::isPoolBuffer(const MemObj *buffer) const {
@@ -587,6 +602,15 @@ bool Context::BufferPoolAllocator::isPoolBuffer(const MemObj *buffer) const {
     return false;
 }
 
+uint32_t Context::BufferPoolAllocator::getSizeClass(size_t size) const {
+    for (uint32_t sizeClass = 0u; sizeClass < enabledSizeClasses; sizeClass++) {
+        if (size <= sizeClasses[sizeClass].bufferThreshold) {
+            return sizeClass;
+        }
+    }
+    return invalidSizeClass;
+}
+
 Buffer *Context::BufferPoolAllocator::allocateBufferFromPool(const MemoryProperties &memoryProperties,
                                                              cl_mem_flags flags,
                                                              cl_mem_flags_intel flagsIntel,
@@ -594,34 +618,42 @@ Buffer *Context::BufferPoolAllocator::allocateBufferFromPool(const MemoryPropert
                                                              void *hostPtr,
                                                              cl_int &errcodeRet) {
     errcodeRet = CL_MEM_OBJECT_ALLOCATION_FAILURE;
+    const auto sizeClass = getSizeClass(requestedSize);
     if (bufferPools.empty() ||
-        !isSizeWithinThreshold(requestedSize) ||
+        sizeClass == invalidSizeClass ||
         !flagsAllowBufferFromPool(flags, flagsIntel)) {
         return nullptr;
     }
 
     auto lock = std::unique_lock<std::mutex>(mutex);
-    auto bufferFromPool = allocateFromPools(memoryProperties, flags, flagsIntel, requestedSize, hostPtr, errcodeRet);
+    auto bufferFromPool = allocateFromPools(memoryProperties, flags, flagsIntel, requestedSize, hostPtr, sizeClass, errcodeRet);
     if (bufferFromPool != nullptr) {
         return bufferFromPool;
     }
 
-    drainOrAddNewBufferPool();
-    return allocateFromPools(memoryProperties, flags, flagsIntel, requestedSize, hostPtr, errcodeRet);
+    drainOrAddNewBufferPool(sizeClass);
+    return allocateFromPools(memoryProperties, flags, flagsIntel, requestedSize, hostPtr, sizeClass, errcodeRet);
 }
 
 void Context::BufferPoolAllocator::releaseSmallBufferPool() {
     bufferPools.clear();
 }
 
-void Context::BufferPoolAllocator::drainOrAddNewBufferPool() {
-    for (auto &bufferPool : bufferPools) {
-        if (bufferPool.drain()) {
+void Context::BufferPoolAllocator::drainOrAddNewBufferPool(uint32_t sizeClass) {
+    // Pools are recycled round robin starting after the last drained one. The pool reused longest ago
+    // is the most likely to have its task counts completed, while the one just drained is still being filled.
+    auto &drainCursor = drainCursors[sizeClass];
+    const auto poolCount = bufferPools.size();
+    for (size_t i = 0; i < poolCount; i++) {
+        const auto poolIndex = (drainCursor + i) % poolCount;
+        auto &bufferPool = bufferPools[poolIndex];
+        if (bufferPool.sizeClass == sizeClass && bufferPool.drain()) {
+            drainCursor = poolIndex + 1;
             return;
         }
     }
 
-    addNewBufferPool();
+    addNewBufferPool(sizeClass);
 }
 
 Buffer *Context::BufferPoolAllocator::allocateFromPools(const MemoryProperties &memoryProperties,
@@ -629,8 +661,12 @@ Buffer *Context::BufferPoolAllocator::allocateFromPools(const MemoryProperties &
                                                         cl_mem_flags_intel flagsIntel,
                                                         size_t requestedSize,
                                                         void *hostPtr,
+                                                        uint32_t sizeClass,
                                                         cl_int &errcodeRet) {
     for (auto &bufferPool : bufferPools) {
+        if (bufferPool.sizeClass != sizeClass) {
+            continue;
+        }
         auto bufferFromPool = bufferPool.allocate(memoryProperties, flags, flagsIntel, requestedSize, hostPtr, errcodeRet);
         if (bufferFromPool != nullptr) {
             return bufferFromPool;
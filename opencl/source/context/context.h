@@ -19,12 +19,15 @@
 #include "opencl/source/helpers/destructor_callbacks.h"
 #include "opencl/source/mem_obj/map_operations_handler.h"
 
+#include <array>
+#include <limits>
 #include <map>
 
 enum InternalMemoryType : uint32_t;
 
 namespace NEO {
 struct MemoryProperties;
+class AllocationsReleaseQueue;
 class HeapAllocator;
 
 class AsyncEventsHandler;
@@ -50,10 +53,21 @@ class Context : public BaseObject<_cl_context> {
         static constexpr auto aggregatedSmallBuffersPoolSize = 64 * KB;
         static constexpr auto smallBufferThreshold = 4 * KB;
         static constexpr auto chunkAlignment = 512u;
-        static constexpr auto startingOffset = chunkAlignment;
 
         static_assert(aggregatedSmallBuffersPoolSize > smallBufferThreshold, "Largest allowed buffer needs to fit in pool");
 
+        struct SizeClass {
+            size_t bufferThreshold;
+            size_t poolSize;
+            size_t chunkAlignment;
+        };
+
+        // Buffers are served from the smallest size class they fit in, larger classes are enabled with ExperimentalBufferPoolSizeClasses
+        static constexpr std::array<SizeClass, 3> sizeClasses = {{{smallBufferThreshold, aggregatedSmallBuffersPoolSize, chunkAlignment},
+                                                                  {64 * KB, 2 * MB, 4 * KB},
+                                                                  {1 * MB, 16 * MB, 64 * KB}}};
+        static constexpr uint32_t invalidSizeClass = std::numeric_limits<uint32_t>::max();
+
         Buffer *allocateBufferFromPool(const MemoryProperties &memoryProperties,
                                        cl_mem_flags flags,
                                        cl_mem_flags_intel flagsIntel,
@@ -73,17 +87,16 @@ class Context : public BaseObject<_cl_context> {
                                   cl_mem_flags_intel flagsIntel,
                                   size_t size,
                                   void *hostPtr,
+                                  uint32_t sizeClass,
                                   cl_int &errcodeRet);
 
-        inline bool isSizeWithinThreshold(size_t size) const {
-            return BufferPoolAllocator::smallBufferThreshold >= size;
-        }
+        uint32_t getSizeClass(size_t size) const;
 
-        void drainOrAddNewBufferPool();
-        void addNewBufferPool();
+        void drainOrAddNewBufferPool(uint32_t sizeClass);
+        void addNewBufferPool(uint32_t sizeClass);
 
         struct BufferPool {
-            BufferPool(Context *context);
+            BufferPool(Context *context, uint32_t sizeClass);
             BufferPool(BufferPool &&bufferPool);
             bool isPoolBuffer(const MemObj *buffer) const;
             Buffer *allocate(const MemoryProperties &memoryProperties,
@@ -93,13 +106,17 @@ class Context : public BaseObject<_cl_context> {
                              void *hostPtr,
                              cl_int &errcodeRet);
             bool drain();
+            void resetChunkAllocator();
             MemoryManager *memoryManager{nullptr};
             std::unique_ptr<Buffer> mainStorage;
             std::unique_ptr<HeapAllocator> chunkAllocator;
+            uint32_t sizeClass = 0u;
         };
         Context *context{nullptr};
         std::mutex mutex;
         std::vector<BufferPool> bufferPools;
+        std::array<size_t, sizeClasses.size()> drainCursors{};
+        uint32_t enabledSizeClasses = 1u;
     };
     static const cl_ulong objectMagic = 0xA4234321DC002130LL;
 
@@ -245,6 +262,9 @@ class Context : public BaseObject<_cl_context> {
     BufferPoolAllocator &getBufferPoolAllocator() {
         return smallBufferPoolAllocator;
     }
+    AllocationsReleaseQueue *getAllocationsReleaseQueue() const {
+        return allocationsReleaseQueue.get();
+    }
     TagAllocatorBase *getMultiRootDeviceTimestampPacketAllocator();
     std::unique_lock<std::mutex> obtainOwnershipForMultiRootDeviceAllocator();
     void setMultiRootDeviceTimestampPacketAllocator(std::unique_ptr<TagAllocatorBase> &allocator);
@@ -292,6 +312,7 @@ class Context : public BaseObject<_cl_context> {
     ContextType contextType = ContextType::CONTEXT_TYPE_DEFAULT;
     std::unique_ptr<TagAllocatorBase> multiRootDeviceTimestampPacketAllocator;
     std::mutex multiRootDeviceAllocatorMtx;
+    std::unique_ptr<AllocationsReleaseQueue> allocationsReleaseQueue;
 
     bool interopUserSync = false;
     bool resolvesRequiredInKernels = false;
@@ -8,6 +8,7 @@
 #include "opencl/source/helpers/properties_helper.h"
 
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/helpers/timestamp_packet.h"
 #include "shared/source/memory_manager/memory_manager.h"
@@ -20,6 +21,8 @@
 #include "opencl/source/mem_obj/image.h"
 #include "opencl/source/mem_obj/mem_obj.h"
 
+#include <algorithm>
+
 namespace NEO {
 
 void flushDependentCsr(CommandStreamReceiver &dependentCsr, CsrDependencies &csrDeps) {
@@ -28,6 +31,26 @@ void flushDependentCsr(CommandStreamReceiver &dependentCsr, CsrDependencies &csr
 }
 
 void EventsRequest::fillCsrDependenciesForTimestampPacketContainer(CsrDependencies &csrDeps, CommandStreamReceiver &currentCsr, CsrDependencies::DependenciesType depsType) const {
+    const bool groupDependencies = DebugManager.flags.ExperimentalGroupCsrDependencies.get() == 1;
+    StackVec<Event *, 8> latestInOrderEvents;
+
+    auto pushDependency = [&](Event &event, TimestampPacketContainer *timestampPacketContainer, CommandStreamReceiver &dependentCsr) {
+        if (groupDependencies && std::find(csrDeps.timestampPacketContainer.begin(), csrDeps.timestampPacketContainer.end(), timestampPacketContainer) != csrDeps.timestampPacketContainer.end()) {
+            return;
+        }
+        csrDeps.timestampPacketContainer.push_back(timestampPacketContainer);
+
+        if (&dependentCsr != &currentCsr) {
+            const auto &productHelper = event.getCommandQueue()->getDevice().getProductHelper();
+            if (productHelper.isDcFlushAllowed()) {
+                if (!dependentCsr.isLatestTaskCountFlushed()) {
+                    flushDependentCsr(dependentCsr, csrDeps);
+                    currentCsr.makeResident(*dependentCsr.getTagAllocation());
+                }
+            }
+        }
+    };
+
     for (cl_uint i = 0; i < this->numEventsInWaitList; i++) {
         auto event = castToObjectOrAbort<Event>(this->eventWaitList[i]);
         if (event->isUserEvent()) {
@@ -51,23 +74,33 @@ void EventsRequest::fillCsrDependenciesForTimestampPacketContainer(CsrDependenci
             dependentCsr = &event->getCommandQueue()->getGpgpuCommandStreamReceiver();
         }
         const auto sameCsr = (dependentCsr == &currentCsr);
-        const auto pushDependency = (CsrDependencies::DependenciesType::OnCsr == depsType && sameCsr) ||
-                                    (CsrDependencies::DependenciesType::OutOfCsr == depsType && !sameCsr) ||
-                                    (CsrDependencies::DependenciesType::All == depsType);
-
-        if (pushDependency) {
-            csrDeps.timestampPacketContainer.push_back(timestampPacketContainer);
-
-            if (!sameCsr) {
-                const auto &productHelper = event->getCommandQueue()->getDevice().getProductHelper();
-                if (productHelper.isDcFlushAllowed()) {
-                    if (!dependentCsr->isLatestTaskCountFlushed()) {
-                        flushDependentCsr(*dependentCsr, csrDeps);
-                        currentCsr.makeResident(*dependentCsr->getTagAllocation());
-                    }
-                }
+        const auto pushDependencyRequired = (CsrDependencies::DependenciesType::OnCsr == depsType && sameCsr) ||
+                                            (CsrDependencies::DependenciesType::OutOfCsr == depsType && !sameCsr) ||
+                                            (CsrDependencies::DependenciesType::All == depsType);
+        if (!pushDependencyRequired) {
+            continue;
+        }
+
+        // in-order queue chains its enqueues, so waiting for its latest event covers all earlier ones
+        const auto inOrderGpgpuEvent = !event->isBcsEvent() && !event->getCommandQueue()->queueDependenciesClearRequired() &&
+                                       event->peekTaskCount() != CompletionStamp::notReady;
+        if (groupDependencies && inOrderGpgpuEvent) {
+            auto latestEvent = std::find_if(latestInOrderEvents.begin(), latestInOrderEvents.end(), [&](Event *latestInOrderEvent) {
+                return latestInOrderEvent->getCommandQueue() == event->getCommandQueue();
+            });
+            if (latestEvent == latestInOrderEvents.end()) {
+                latestInOrderEvents.push_back(event);
+            } else if ((*latestEvent)->peekTaskCount() < event->peekTaskCount()) {
+                *latestEvent = event;
             }
+            continue;
         }
+
+        pushDependency(*event, timestampPacketContainer, *dependentCsr);
+    }
+
+    for (auto event : latestInOrderEvents) {
+        pushDependency(*event, event->getTimestampPacketNodes(), event->getCommandQueue()->getGpgpuCommandStreamReceiver());
     }
 }
 
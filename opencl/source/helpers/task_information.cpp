@@ -131,9 +131,32 @@ CommandComputeKernel::CommandComputeKernel(CommandQueue &commandQueue, std::uniq
 }
 
 CommandComputeKernel::~CommandComputeKernel() {
+    for (auto surface : surfaces) {
+        delete surface;
+    }
     kernel->decRefInternal();
 }
 
+void CommandComputeKernel::makeResubmittable() {
+    resubmittable = true;
+    recordedCommandStreamSize = kernelOperation->commandStream->getUsed();
+}
+
+void CommandComputeKernel::prepareResubmission() {
+    // flushTask appends its epilogue to the task stream, so every submission starts from the recorded commands only
+    auto &commandStream = *kernelOperation->commandStream;
+    commandStream.replaceBuffer(commandStream.getCpuBase(), commandStream.getMaxAvailableSpace());
+    commandStream.getSpace(recordedCommandStreamSize);
+
+    if (currentTimestampPacketNodes) {
+        for (auto &node : currentTimestampPacketNodes->peekNodes()) {
+            auto packetsUsed = node->getPacketsUsed();
+            node->initialize();
+            node->setPacketsUsed(packetsUsed);
+        }
+    }
+}
+
 CompletionStamp &CommandComputeKernel::submit(TaskCountType taskLevel, bool terminated) {
     if (terminated) {
         this->terminated = true;
@@ -148,6 +171,10 @@ CompletionStamp &CommandComputeKernel::submit(TaskCountType taskLevel, bool term
 
     auto commandStreamReceiverOwnership = commandStreamReceiver.obtainUniqueOwnership();
 
+    if (resubmittable) {
+        prepareResubmission();
+    }
+
     IndirectHeap *dsh = kernelOperation->dsh.get();
     IndirectHeap *ioh = kernelOperation->ioh.get();
     IndirectHeap *ssh = kernelOperation->ssh.get();
@@ -296,10 +323,12 @@ CompletionStamp &CommandComputeKernel::submit(TaskCountType taskLevel, bool term
         }
     }
 
-    for (auto surface : surfaces) {
-        delete surface;
+    if (!resubmittable) {
+        for (auto surface : surfaces) {
+            delete surface;
+        }
+        surfaces.clear();
     }
-    surfaces.clear();
 
     return completionStamp;
 }
@@ -96,6 +96,7 @@ class Command : public IFNode<Command> {
     void setTimestampPacketNode(TimestampPacketContainer &current, TimestampPacketDependencies &&dependencies);
     void setEventsRequest(EventsRequest &eventsRequest);
     void makeTimestampPacketsResident(CommandStreamReceiver &commandStreamReceiver);
+    TimestampPacketContainer *peekTimestampPacketNodes() const { return currentTimestampPacketNodes.get(); }
 
     TagNodeBase *timestamp = nullptr;
     CompletionStamp completionStamp = {};
@@ -139,7 +140,13 @@ class CommandComputeKernel : public Command {
     Kernel *peekKernel() const { return kernel; }
     PrintfHandler *peekPrintfHandler() const { return printfHandler.get(); }
 
+    // keeps the encoded stream and surfaces for repeated submissions; each one must start after the previous one completed
+    void makeResubmittable();
+    bool isResubmittable() const { return resubmittable; }
+
   protected:
+    void prepareResubmission();
+
     std::vector<Surface *> surfaces;
     bool flushDC;
     bool slmUsed;
@@ -149,6 +156,8 @@ class CommandComputeKernel : public Command {
     uint32_t kernelCount;
     PreemptionMode preemptionMode;
     TagNodeBase *multiRootDeviceSyncNode;
+    size_t recordedCommandStreamSize = 0;
+    bool resubmittable = false;
 };
 
 class CommandWithoutKernel : public Command {
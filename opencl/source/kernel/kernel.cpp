@@ -56,6 +56,7 @@
 #include "opencl/source/helpers/sampler_helpers.h"
 #include "opencl/source/kernel/image_transformer.h"
 #include "opencl/source/kernel/kernel_info_cl.h"
+#include "opencl/source/kernel/local_work_size_tuner.h"
 #include "opencl/source/mem_obj/buffer.h"
 #include "opencl/source/mem_obj/image.h"
 #include "opencl/source/mem_obj/pipe.h"
@@ -344,6 +345,10 @@ cl_int Kernel::initialize() {
         initializeLocalIdsCache();
     }
 
+    if (DebugManager.flags.ExperimentalLocalWorkSizeTuning.get() > 0 && kernelDescriptor.kernelAttributes.requiredWorkgroupSize[0] == 0) {
+        localWorkSizeTuner = std::make_unique<LocalWorkSizeTuner>(*this, clDevice, static_cast<uint32_t>(DebugManager.flags.ExperimentalLocalWorkSizeTuning.get()));
+    }
+
     return CL_SUCCESS;
 }
 
@@ -1009,6 +1014,7 @@ void Kernel::storeKernelArg(uint32_t argIndex, kernelArgType argType, void *argO
     kernelArguments[argIndex].size = argSize;
     kernelArguments[argIndex].svmAllocation = argSvmAlloc;
     kernelArguments[argIndex].svmFlags = argSvmFlags;
+    kernelArguments[argIndex].patchedMemObjId = 0u;
 }
 
 void Kernel::storeKernelArgAllocIdMemoryManagerCounter(uint32_t argIndex, uint32_t allocIdMemoryManagerCounter) {
@@ -1177,7 +1183,18 @@ inline void Kernel::makeArgsResident(CommandStreamReceiver &commandStreamReceive
     }
 }
 
+Vec3<size_t> Kernel::getTunedLocalWorkSize(uint32_t workDim, const Vec3<size_t> &gws) {
+    if (localWorkSizeTuner == nullptr) {
+        return {0, 0, 0};
+    }
+    return localWorkSizeTuner->getLocalWorkSize(workDim, gws);
+}
+
 void Kernel::performKernelTuning(CommandStreamReceiver &commandStreamReceiver, const Vec3<size_t> &lws, const Vec3<size_t> &gws, const Vec3<size_t> &offsets, TimestampPacketContainer *timestampContainer) {
+    if (localWorkSizeTuner && timestampContainer) {
+        localWorkSizeTuner->registerLaunch(gws, lws, *timestampContainer);
+    }
+
     auto performTunning = TunningType::DISABLED;
 
     if (DebugManager.flags.EnableKernelTunning.get() != -1) {
@@ -1459,6 +1476,24 @@ cl_int Kernel::setArgLocal(uint32_t argIndexIn,
     return CL_SUCCESS;
 }
 
+bool Kernel::isBufferArgPatchUpToDate(uint32_t argIndex, const Buffer &buffer) const {
+    const auto &argInfo = kernelArguments[argIndex];
+    if (!argInfo.isPatched || argInfo.patchedMemObjId != buffer.getMemObjId()) {
+        return false;
+    }
+
+    // shared objects are repatched after acquire, aux translation and patch info comments depend on more than the buffer itself
+    if (buffer.peekSharingHandler() ||
+        AuxTranslationDirection::None != auxTranslationDirection ||
+        DebugManager.flags.AddPatchInfoCommentsForAUBDump.get()) {
+        return false;
+    }
+
+    auto graphicsAllocation = buffer.getGraphicsAllocation(getDevice().getRootDeviceIndex());
+    return argInfo.patchedAllocation == graphicsAllocation &&
+           argInfo.patchedGpuAddress == graphicsAllocation->getGpuAddress();
+}
+
 cl_int Kernel::setArgBuffer(uint32_t argIndex,
                             size_t argSize,
                             const void *argVal) {
@@ -1478,9 +1513,14 @@ cl_int Kernel::setArgBuffer(uint32_t argIndex,
         auto clMemObj = *clMem;
         DBG_LOG_INPUTS("setArgBuffer cl_mem", clMemObj);
 
+        auto buffer = castToObject<Buffer>(clMemObj);
+        if (buffer && isBufferArgPatchUpToDate(argIndex, *buffer)) {
+            kernelArguments[argIndex].value = argVal;
+            return CL_SUCCESS;
+        }
+
         storeKernelArg(argIndex, BUFFER_OBJ, clMemObj, argVal, argSize);
 
-        auto buffer = castToObject<Buffer>(clMemObj);
         if (!buffer) {
             return CL_INVALID_MEM_OBJECT;
         }
@@ -1545,6 +1585,10 @@ cl_int Kernel::setArgBuffer(uint32_t argIndex,
         }
 
         addAllocationToCacheFlushVector(argIndex, allocationForCacheFlush);
+
+        kernelArguments[argIndex].patchedMemObjId = buffer->getMemObjId();
+        kernelArguments[argIndex].patchedAllocation = graphicsAllocation;
+        kernelArguments[argIndex].patchedGpuAddress = graphicsAllocation->getGpuAddress();
         return CL_SUCCESS;
     } else {
         storeKernelArg(argIndex, BUFFER_OBJ, nullptr, argVal, argSize);
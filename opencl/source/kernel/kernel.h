@@ -42,6 +42,7 @@ class Surface;
 class PrintfHandler;
 class MultiDeviceKernel;
 class LocalIdsCache;
+class LocalWorkSizeTuner;
 
 class Kernel : public ReferenceTrackedObject<Kernel> {
   public:
@@ -69,6 +70,9 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
         kernelArgType type;
         uint32_t allocId;
         uint32_t allocIdMemoryManagerCounter;
+        uint64_t patchedMemObjId = 0u;
+        GraphicsAllocation *patchedAllocation = nullptr;
+        uint64_t patchedGpuAddress = 0u;
         bool isPatched = false;
         bool isStatelessUncacheable = false;
         bool isSetToNullptr = false;
@@ -252,6 +256,8 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
                            size_t argSize,
                            const void *argVal);
 
+    bool isBufferArgPatchUpToDate(uint32_t argIndex, const Buffer &buffer) const;
+
     cl_int setArgBuffer(uint32_t argIndex,
                         size_t argSize,
                         const void *argVal);
@@ -296,6 +302,7 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
     bool requiresSystolicPipelineSelectMode() const { return systolicPipelineSelectMode; }
 
     void performKernelTuning(CommandStreamReceiver &commandStreamReceiver, const Vec3<size_t> &lws, const Vec3<size_t> &gws, const Vec3<size_t> &offsets, TimestampPacketContainer *timestampContainer);
+    Vec3<size_t> getTunedLocalWorkSize(uint32_t workDim, const Vec3<size_t> &gws);
     MOCKABLE_VIRTUAL bool isSingleSubdevicePreferred() const;
     void setInlineSamplers();
 
@@ -490,6 +497,7 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
 
     void initializeLocalIdsCache();
     std::unique_ptr<LocalIdsCache> localIdsCache;
+    std::unique_ptr<LocalWorkSizeTuner> localWorkSizeTuner;
 
     UnifiedMemoryControls unifiedMemoryControls{};
 
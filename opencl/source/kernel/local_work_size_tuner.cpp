@@ -0,0 +1,224 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/kernel/local_work_size_tuner.h"
+
+#include "shared/source/compiler_interface/compiler_cache.h"
+#include "shared/source/compiler_interface/default_cache_config.h"
+#include "shared/source/helpers/string.h"
+#include "shared/source/helpers/timestamp_packet.h"
+#include "shared/source/utilities/arrayref.h"
+
+#include "opencl/source/command_queue/cl_local_work_size.h"
+#include "opencl/source/event/event.h"
+#include "opencl/source/helpers/dispatch_info.h"
+#include "opencl/source/kernel/kernel.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+LocalWorkSizeTuner::LocalWorkSizeTuner(Kernel &kernel, ClDevice &clDevice, uint32_t launchesPerCandidate)
+    : kernel(kernel), clDevice(clDevice), launchesPerCandidate(launchesPerCandidate) {
+    auto cacheConfig = getDefaultCompilerCacheConfig();
+    if (cacheConfig.enabled && !cacheConfig.cacheDir.empty()) {
+        cacheConfig.cacheFileExtension = cacheFileExtension;
+        cache = std::make_unique<CompilerCache>(cacheConfig);
+    }
+}
+
+LocalWorkSizeTuner::~LocalWorkSizeTuner() = default;
+
+Vec3<size_t> LocalWorkSizeTuner::getLocalWorkSize(uint32_t workDim, const Vec3<size_t> &gws) {
+    if (gws.x * gws.y * gws.z == 0) {
+        return {0, 0, 0};
+    }
+
+    std::lock_guard<std::mutex> lock(mtx);
+    // finished launches of every geometry are retired here, so their timestamp nodes are not held until that geometry is enqueued again
+    for (auto &tuningState : tuningStates) {
+        if (!tuningState.second.pendingLaunches.empty()) {
+            collectMeasurements(tuningState.second);
+        }
+    }
+
+    auto state = getTuningState(workDim, gws);
+    if (state == nullptr) {
+        return {0, 0, 0};
+    }
+    if (state->bestLws.x != 0) {
+        return state->bestLws;
+    }
+
+    for (auto &candidate : state->candidates) {
+        if (candidate.launches < launchesPerCandidate) {
+            return candidate.lws;
+        }
+    }
+    return {0, 0, 0};
+}
+
+void LocalWorkSizeTuner::registerLaunch(const Vec3<size_t> &gws, const Vec3<size_t> &lws, const TimestampPacketContainer &timestampPackets) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto stateIt = tuningStates.find(getTuningKey(gws));
+    if (stateIt == tuningStates.end() || stateIt->second.bestLws.x != 0 || timestampPackets.peekNodes().empty()) {
+        return;
+    }
+
+    auto &state = stateIt->second;
+    for (auto candidateIndex = 0u; candidateIndex < state.candidates.size(); candidateIndex++) {
+        auto &candidate = state.candidates[candidateIndex];
+        if (candidate.lws == lws && candidate.launches < launchesPerCandidate) {
+            PendingLaunch pendingLaunch;
+            pendingLaunch.candidateIndex = candidateIndex;
+            pendingLaunch.timestampPackets = std::make_unique<TimestampPacketContainer>();
+            pendingLaunch.timestampPackets->assignAndIncrementNodesRefCounts(timestampPackets);
+            state.pendingLaunches.push_back(std::move(pendingLaunch));
+            candidate.launches++;
+            return;
+        }
+    }
+}
+
+LocalWorkSizeTuner::TuningKey LocalWorkSizeTuner::getTuningKey(const Vec3<size_t> &gws) {
+    // unused dimensions are 1 in the enqueued region and 0 may come from the dispatch info, both map to the same geometry
+    return TuningKey{std::max(gws.x, size_t{1}), std::max(gws.y, size_t{1}), std::max(gws.z, size_t{1})};
+}
+
+LocalWorkSizeTuner::TuningState *LocalWorkSizeTuner::getTuningState(uint32_t workDim, const Vec3<size_t> &gws) {
+    const auto tuningKey = getTuningKey(gws);
+    auto stateIt = tuningStates.find(tuningKey);
+    if (stateIt != tuningStates.end()) {
+        return &stateIt->second;
+    }
+    if (tuningStates.size() >= maxTuningStates) {
+        return nullptr;
+    }
+
+    auto &state = tuningStates[tuningKey];
+    state.cacheKey = getCacheKey(workDim, gws);
+    if (cache) {
+        size_t cachedSize = 0;
+        auto cachedLws = cache->loadCachedBinary(state.cacheKey, cachedSize);
+        if (cachedLws && cachedSize == 3 * sizeof(uint64_t)) {
+            uint64_t lws[3] = {};
+            memcpy_s(lws, sizeof(lws), cachedLws.get(), cachedSize);
+            state.bestLws = {static_cast<size_t>(lws[0]), static_cast<size_t>(lws[1]), static_cast<size_t>(lws[2])};
+            return &state;
+        }
+    }
+
+    generateCandidates(state, workDim, gws);
+    if (state.candidates.size() == 1) {
+        state.bestLws = state.candidates[0].lws;
+        state.candidates.clear();
+    }
+    return &state;
+}
+
+void LocalWorkSizeTuner::generateCandidates(TuningState &state, uint32_t workDim, const Vec3<size_t> &gws) {
+    auto addCandidate = [&state](const Vec3<size_t> &lws) {
+        auto isNew = std::none_of(state.candidates.begin(), state.candidates.end(), [&lws](const Candidate &candidate) { return candidate.lws == lws; });
+        if (isNew && state.candidates.size() < maxCandidates) {
+            Candidate candidate;
+            candidate.lws = lws;
+            state.candidates.push_back(candidate);
+        }
+    };
+
+    // driver heuristic is always measured first, so tuning never ends up worse than it
+    const DispatchInfo dispatchInfo{&clDevice, &kernel, workDim, gws, {0, 0, 0}, {0, 0, 0}};
+    addCandidate(computeWorkgroupSize(dispatchInfo));
+
+    const size_t maxWorkGroupSize = kernel.getMaxKernelWorkGroupSize();
+    const size_t simdSize = kernel.getKernelInfo().getMaxSimdSize();
+    for (auto groupSize = maxWorkGroupSize; groupSize >= simdSize && groupSize > 0; groupSize /= 2) {
+        for (auto x = groupSize; x > 0; x /= 2) {
+            auto y = groupSize / x;
+            if (x * y != groupSize || (workDim == 1 && y != 1)) {
+                continue;
+            }
+            if (gws.x % x == 0 && gws.y % y == 0) {
+                addCandidate({x, y, 1});
+            }
+        }
+    }
+}
+
+void LocalWorkSizeTuner::collectMeasurements(TuningState &state) {
+    auto hasRunFinished = [](const TimestampPacketContainer &timestampPackets) {
+        for (const auto &node : timestampPackets.peekNodes()) {
+            for (uint32_t i = 0; i < node->getPacketsUsed(); i++) {
+                if (node->getContextEndValue(i) == 1) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    };
+
+    for (auto pendingLaunch = state.pendingLaunches.begin(); pendingLaunch != state.pendingLaunches.end();) {
+        if (!hasRunFinished(*pendingLaunch->timestampPackets)) {
+            pendingLaunch++;
+            continue;
+        }
+
+        uint64_t globalStartTS = 0u;
+        uint64_t globalEndTS = 0u;
+        Event::getBoundaryTimestampValues(pendingLaunch->timestampPackets.get(), globalStartTS, globalEndTS);
+
+        auto &candidate = state.candidates[pendingLaunch->candidateIndex];
+        if (globalEndTS >= globalStartTS) {
+            candidate.totalTime += globalEndTS - globalStartTS;
+            candidate.measuredLaunches++;
+        } else {
+            // timestamp wrapped, launch has to be repeated
+            candidate.launches--;
+        }
+        pendingLaunch = state.pendingLaunches.erase(pendingLaunch);
+    }
+
+    auto allMeasured = std::all_of(state.candidates.begin(), state.candidates.end(), [this](const Candidate &candidate) {
+        return candidate.measuredLaunches >= launchesPerCandidate;
+    });
+    if (allMeasured) {
+        selectBestCandidate(state);
+    }
+}
+
+void LocalWorkSizeTuner::selectBestCandidate(TuningState &state) {
+    auto bestCandidate = std::min_element(state.candidates.begin(), state.candidates.end(), [](const Candidate &lhs, const Candidate &rhs) {
+        return lhs.totalTime < rhs.totalTime;
+    });
+    state.bestLws = bestCandidate->lws;
+    state.candidates.clear();
+    state.pendingLaunches.clear();
+
+    if (cache) {
+        uint64_t lws[3] = {state.bestLws.x, state.bestLws.y, state.bestLws.z};
+        cache->cacheBinary(state.cacheKey, reinterpret_cast<const char *>(lws), static_cast<uint32_t>(sizeof(lws)));
+    }
+}
+
+std::string LocalWorkSizeTuner::getCacheKey(uint32_t workDim, const Vec3<size_t> &gws) const {
+    if (cache == nullptr) {
+        return {};
+    }
+
+    const auto &kernelInfo = kernel.getKernelInfo();
+    std::string input(reinterpret_cast<const char *>(kernelInfo.heapInfo.pKernelHeap), kernelInfo.heapInfo.pKernelHeap ? kernelInfo.heapInfo.KernelHeapSize : 0u);
+    input += kernelInfo.kernelDescriptor.kernelMetadata.kernelName;
+    const std::string options = "-lws-tuning " + std::to_string(launchesPerCandidate);
+    const std::string geometry = std::to_string(workDim) + ":" + std::to_string(gws.x) + "x" + std::to_string(gws.y) + "x" + std::to_string(gws.z);
+
+    return cache->getCachedFileName(kernel.getHardwareInfo(),
+                                    ArrayRef<const char>(input.c_str(), input.size()),
+                                    ArrayRef<const char>(options.c_str(), options.size()),
+                                    ArrayRef<const char>(geometry.c_str(), geometry.size()));
+}
+
+} // namespace NEO
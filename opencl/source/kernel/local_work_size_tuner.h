@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/helpers/vec.h"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace NEO {
+class ClDevice;
+class CompilerCache;
+class Kernel;
+class TimestampPacketContainer;
+
+// Times a few local work size candidates on the first launches of a kernel enqueued without local work size
+// and uses the fastest one afterwards. Winners are persisted next to the compiler cache.
+// At most maxTuningStates geometries are tracked per kernel, further geometries use the default local work size.
+class LocalWorkSizeTuner : NonCopyableOrMovableClass {
+  public:
+    LocalWorkSizeTuner(Kernel &kernel, ClDevice &clDevice, uint32_t launchesPerCandidate);
+    virtual ~LocalWorkSizeTuner();
+
+    // returns {0, 0, 0} when default local work size should be used
+    Vec3<size_t> getLocalWorkSize(uint32_t workDim, const Vec3<size_t> &gws);
+    void registerLaunch(const Vec3<size_t> &gws, const Vec3<size_t> &lws, const TimestampPacketContainer &timestampPackets);
+
+    static constexpr size_t maxCandidates = 6;
+    static constexpr size_t maxTuningStates = 64;
+    static constexpr const char *cacheFileExtension = ".lws_cache";
+
+  protected:
+    struct Candidate {
+        Vec3<size_t> lws{0, 0, 0};
+        uint64_t totalTime = 0;
+        uint32_t launches = 0;
+        uint32_t measuredLaunches = 0;
+    };
+    struct PendingLaunch {
+        size_t candidateIndex = 0;
+        std::unique_ptr<TimestampPacketContainer> timestampPackets;
+    };
+    struct TuningState {
+        std::vector<Candidate> candidates;
+        std::vector<PendingLaunch> pendingLaunches;
+        Vec3<size_t> bestLws{0, 0, 0};
+        std::string cacheKey;
+    };
+    using TuningKey = std::tuple<size_t, size_t, size_t>;
+
+    static TuningKey getTuningKey(const Vec3<size_t> &gws);
+    TuningState *getTuningState(uint32_t workDim, const Vec3<size_t> &gws);
+    void generateCandidates(TuningState &state, uint32_t workDim, const Vec3<size_t> &gws);
+    void collectMeasurements(TuningState &state);
+    void selectBestCandidate(TuningState &state);
+    std::string getCacheKey(uint32_t workDim, const Vec3<size_t> &gws) const;
+
+    Kernel &kernel;
+    ClDevice &clDevice;
+    const uint32_t launchesPerCandidate;
+    std::unique_ptr<CompilerCache> cache;
+    std::map<TuningKey, TuningState> tuningStates;
+    std::mutex mtx;
+};
+} // namespace NEO
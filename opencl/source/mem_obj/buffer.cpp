@@ -24,6 +24,7 @@
 #include "shared/source/memory_manager/memory_operations_handler.h"
 #include "shared/source/memory_manager/migration_sync_data.h"
 #include "shared/source/os_interface/os_interface.h"
+#include "shared/source/utilities/cpu_copy.h"
 
 #include "opencl/source/cl_device/cl_device.h"
 #include "opencl/source/command_queue/command_queue.h"
@@ -270,7 +271,8 @@ Buffer *Buffer::create(Context *context,
     const bool copyHostPtr = memoryProperties.flags.copyHostPtr;
     if (implicitScalingEnabled == false &&
         useHostPtr == false &&
-        memoryProperties.flags.forceHostMemory == false) {
+        memoryProperties.flags.forceHostMemory == false &&
+        bufferCreateArgs.doNotUseBufferPool == false) {
         cl_int poolAllocRet = CL_SUCCESS;
         auto bufferFromPool = bufferPoolAllocator.allocateBufferFromPool(memoryProperties,
                                                                          flags,
@@ -719,7 +721,7 @@ void Buffer::transferData(void *dst, void *src, size_t copySize, size_t copyOffs
     DBG_LOG(LogMemoryObject, __FUNCTION__, " hostPtr: ", hostPtr, ", size: ", copySize, ", offset: ", copyOffset, ", memoryStorage: ", memoryStorage);
     auto dstPtr = ptrOffset(dst, copyOffset);
     auto srcPtr = ptrOffset(src, copyOffset);
-    memcpy_s(dstPtr, copySize, srcPtr, copySize);
+    CpuCopy::copy(dstPtr, copySize, srcPtr, copySize, false, executionEnvironment ? executionEnvironment->cpuCopyThreadPool.get() : nullptr);
 }
 
 void Buffer::transferDataToHostPtr(MemObjSizeArray &copySize, MemObjOffsetArray &copyOffset) {
@@ -58,6 +58,7 @@ class Buffer : public MemObj {
     struct AdditionalBufferCreateArgs {
         bool doNotProvidePerformanceHints;
         bool makeAllocationLockable;
+        bool doNotUseBufferPool;
     };
     constexpr static size_t maxBufferSizeForReadWriteOnCpu = 10 * MB;
     constexpr static size_t maxBufferSizeForCopyOnCpu = 64 * KB;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2022 Intel Corporation
+ * Copyright (C) 2018-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,8 +7,6 @@
 
 #include "opencl/source/mem_obj/map_operations_handler.h"
 
-#include "shared/source/helpers/ptr_math.h"
-
 using namespace NEO;
 
 size_t MapOperationsHandler::size() const {
@@ -26,23 +24,30 @@ bool MapOperationsHandler::add(void *ptr, size_t ptrLength, cl_map_flags &mapFla
         return false;
     }
 
-    mappedPointers.push_back(mapInfo);
+    mappedPointers.emplace(reinterpret_cast<uintptr_t>(ptr), mapInfo);
+    mappedLengths.insert(ptrLength);
     return true;
 }
 
+uintptr_t MapOperationsHandler::getSearchStart(uintptr_t ptr) const {
+    auto longestMappedLength = *mappedLengths.rbegin();
+    return ptr > longestMappedLength ? ptr - longestMappedLength : 0u;
+}
+
 bool MapOperationsHandler::isOverlapping(MapInfo &inputMapInfo) {
-    if (inputMapInfo.readOnly) {
+    if (inputMapInfo.readOnly || mappedPointers.empty()) {
         return false;
     }
-    auto inputStartPtr = inputMapInfo.ptr;
-    auto inputEndPtr = ptrOffset(inputStartPtr, inputMapInfo.ptrLength);
+    auto inputStartPtr = reinterpret_cast<uintptr_t>(inputMapInfo.ptr);
+    auto inputEndPtr = inputStartPtr + inputMapInfo.ptrLength;
 
-    for (auto &mapInfo : mappedPointers) {
-        auto mappedStartPtr = mapInfo.ptr;
-        auto mappedEndPtr = ptrOffset(mappedStartPtr, mapInfo.ptrLength);
+    // Candidates start before or at the end of requested range
+    auto endIter = mappedPointers.upper_bound(inputEndPtr);
+    for (auto it = mappedPointers.lower_bound(getSearchStart(inputStartPtr)); it != endIter; it++) {
+        auto mappedEndPtr = it->first + it->second.ptrLength;
 
         // Requested ptr starts before or inside existing ptr range and overlapping end
-        if (inputStartPtr < mappedEndPtr && inputEndPtr >= mappedStartPtr) {
+        if (inputStartPtr < mappedEndPtr) {
             return true;
         }
     }
@@ -52,11 +57,10 @@ bool MapOperationsHandler::isOverlapping(MapInfo &inputMapInfo) {
 bool MapOperationsHandler::find(void *mappedPtr, MapInfo &outMapInfo) {
     std::lock_guard<std::mutex> lock(mtx);
 
-    for (auto &mapInfo : mappedPointers) {
-        if (mapInfo.ptr == mappedPtr) {
-            outMapInfo = mapInfo;
-            return true;
-        }
+    auto it = mappedPointers.lower_bound(reinterpret_cast<uintptr_t>(mappedPtr));
+    if (it != mappedPointers.end() && it->second.ptr == mappedPtr) {
+        outMapInfo = it->second;
+        return true;
     }
     return false;
 }
@@ -64,12 +68,16 @@ bool MapOperationsHandler::find(void *mappedPtr, MapInfo &outMapInfo) {
 bool NEO::MapOperationsHandler::findInfoForHostPtr(const void *ptr, size_t size, MapInfo &outMapInfo) {
     std::lock_guard<std::mutex> lock(mtx);
 
-    for (auto &mapInfo : mappedPointers) {
-        void *ptrStart = mapInfo.ptr;
-        void *ptrEnd = ptrOffset(mapInfo.ptr, mapInfo.ptrLength);
+    if (mappedPointers.empty()) {
+        return false;
+    }
+    auto requestedStartPtr = reinterpret_cast<uintptr_t>(ptr);
+    auto requestedEndPtr = requestedStartPtr + size;
 
-        if (ptrStart <= ptr && ptrOffset(ptr, size) <= ptrEnd) {
-            outMapInfo = mapInfo;
+    auto endIter = mappedPointers.upper_bound(requestedStartPtr);
+    for (auto it = mappedPointers.lower_bound(getSearchStart(requestedStartPtr)); it != endIter; it++) {
+        if (requestedEndPtr <= it->first + it->second.ptrLength) {
+            outMapInfo = it->second;
             return true;
         }
     }
@@ -79,13 +87,10 @@ bool NEO::MapOperationsHandler::findInfoForHostPtr(const void *ptr, size_t size,
 void MapOperationsHandler::remove(void *mappedPtr) {
     std::lock_guard<std::mutex> lock(mtx);
 
-    auto endIter = mappedPointers.end();
-    for (auto it = mappedPointers.begin(); it != endIter; it++) {
-        if (it->ptr == mappedPtr) {
-            std::iter_swap(it, mappedPointers.end() - 1);
-            mappedPointers.pop_back();
-            break;
-        }
+    auto it = mappedPointers.lower_bound(reinterpret_cast<uintptr_t>(mappedPtr));
+    if (it != mappedPointers.end() && it->second.ptr == mappedPtr) {
+        mappedLengths.erase(mappedLengths.find(it->second.ptrLength));
+        mappedPointers.erase(it);
     }
 }
 
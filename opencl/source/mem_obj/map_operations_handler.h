@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,9 +8,10 @@
 #pragma once
 #include "opencl/source/helpers/properties_helper.h"
 
+#include <map>
 #include <mutex>
+#include <set>
 #include <unordered_map>
-#include <vector>
 
 namespace NEO {
 
@@ -25,8 +26,14 @@ class MapOperationsHandler {
     size_t size() const;
 
   protected:
+    // Mapped regions sorted by start address. Only regions starting at most the longest mapped length
+    // before a queried range can reach into it, so overlap and host ptr lookups scan just that window.
+    using MappedPointers = std::multimap<uintptr_t, MapInfo>;
+
     bool isOverlapping(MapInfo &inputMapInfo);
-    std::vector<MapInfo> mappedPointers;
+    uintptr_t getSearchStart(uintptr_t ptr) const;
+    MappedPointers mappedPointers;
+    std::multiset<size_t> mappedLengths;
     mutable std::mutex mtx;
 };
 
@@ -12,6 +12,7 @@
 #include "shared/source/helpers/bit_helpers.h"
 #include "shared/source/helpers/get_info.h"
 #include "shared/source/memory_manager/allocation_properties.h"
+#include "shared/source/memory_manager/allocations_release_queue.h"
 #include "shared/source/memory_manager/memory_manager.h"
 
 #include "opencl/source/cl_device/cl_device.h"
@@ -24,6 +25,8 @@
 
 namespace NEO {
 
+std::atomic<uint64_t> MemObj::memObjIdCounter{0u};
+
 MemObj::MemObj(Context *context,
                cl_mem_object_type memObjectType,
                const MemoryProperties &memoryProperties,
@@ -350,6 +353,10 @@ void MemObj::releaseMapAllocation(uint32_t rootDeviceIndex, bool asyncDestroy) {
 
 void MemObj::destroyGraphicsAllocation(GraphicsAllocation *allocation, bool asyncDestroy) {
     if (asyncDestroy) {
+        auto releaseQueue = context ? context->getAllocationsReleaseQueue() : nullptr;
+        if (releaseQueue && releaseQueue->deferRelease(*allocation)) {
+            return;
+        }
         memoryManager->checkGpuUsageAndDestroyGraphicsAllocations(allocation);
     } else {
         memoryManager->freeGraphicsMemory(allocation);
@@ -17,6 +17,7 @@
 
 #include "memory_properties_flags.h"
 
+#include <atomic>
 #include <cstdint>
 #include <vector>
 
@@ -83,6 +84,7 @@ class MemObj : public BaseObject<_cl_mem> {
     void *getCpuAddress() const;
     void *getHostPtr() const;
     bool getIsObjectRedescribed() const { return isObjectRedescribed; };
+    uint64_t getMemObjId() const { return memObjId; }
     size_t getSize() const;
 
     MapOperationsHandler &getMapOperationsHandler();
@@ -196,5 +198,9 @@ class MemObj : public BaseObject<_cl_mem> {
     std::vector<uint64_t> propertiesVector;
 
     MemObjDestructorCallbacks destructorCallbacks;
+
+    // Unique for the lifetime of the process, unlike cl_mem handles which may be reused after release
+    static std::atomic<uint64_t> memObjIdCounter;
+    const uint64_t memObjId = ++memObjIdCounter;
 };
 } // namespace NEO
@@ -14,6 +14,7 @@
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/helpers/addressing_mode_helper.h"
 #include "shared/source/helpers/compiler_options_parser.h"
+#include "shared/source/helpers/string.h"
 #include "shared/source/program/kernel_info.h"
 #include "shared/source/source_level_debugger/source_level_debugger.h"
 #include "shared/source/utilities/logger.h"
@@ -28,9 +29,41 @@
 #include <cstring>
 #include <iterator>
 #include <sstream>
+#include <thread>
 
 namespace NEO {
 
+namespace {
+// Compiler device context is created from these, so devices matching in all of them get the same compiler output
+bool isCompilerOutputShareable(const Device &lhs, const Device &rhs) {
+    if (lhs.getRootDeviceIndex() == rhs.getRootDeviceIndex()) {
+        return true;
+    }
+    const auto &lhsHwInfo = lhs.getHardwareInfo();
+    const auto &rhsHwInfo = rhs.getHardwareInfo();
+    return (0 == memcmp(&lhsHwInfo.platform, &rhsHwInfo.platform, sizeof(lhsHwInfo.platform))) &&
+           (0 == memcmp(&lhsHwInfo.gtSystemInfo, &rhsHwInfo.gtSystemInfo, sizeof(lhsHwInfo.gtSystemInfo))) &&
+           (lhsHwInfo.featureTable.packed == rhsHwInfo.featureTable.packed) &&
+           (lhsHwInfo.workaroundTable.packed == rhsHwInfo.workaroundTable.packed) &&
+           (lhsHwInfo.capabilityTable == rhsHwInfo.capabilityTable) &&
+           (lhsHwInfo.ipVersion.value == rhsHwInfo.ipVersion.value) &&
+           (lhs.getDeviceInfo().outProfilingTimerResolution == rhs.getDeviceInfo().outProfilingTimerResolution);
+}
+
+void copyCompilerOutput(const TranslationOutput &src, TranslationOutput &dst) {
+    auto copyMemAndSize = [](const TranslationOutput::MemAndSize &srcMem, TranslationOutput::MemAndSize &dstMem) {
+        dstMem.mem = makeCopy<char>(srcMem.mem.get(), srcMem.size);
+        dstMem.size = srcMem.size;
+    };
+    dst.intermediateCodeType = src.intermediateCodeType;
+    copyMemAndSize(src.intermediateRepresentation, dst.intermediateRepresentation);
+    copyMemAndSize(src.deviceBinary, dst.deviceBinary);
+    copyMemAndSize(src.debugData, dst.debugData);
+    dst.frontendCompilerLog = src.frontendCompilerLog;
+    dst.backendCompilerLog = src.backendCompilerLog;
+}
+} // namespace
+
 cl_int Program::build(
     const ClDeviceVector &deviceVector,
     const char *buildOptions,
@@ -133,11 +166,24 @@ cl_int Program::build(
             inputArgs.allowCaching = enableCaching;
             NEO::TranslationOutput compilerOuput = {};
 
-            for (const auto &clDevice : deviceVector) {
+            std::vector<TranslationOutput> parallelBuildOutputs;
+            std::vector<TranslationOutput::ErrorCode> parallelBuildErrors;
+            if (DebugManager.flags.ExperimentalParallelProgramBuild.get() == 1) {
+                buildInParallel(*pCompilerInterface, deviceVector, inputArgs, parallelBuildOutputs, parallelBuildErrors);
+            }
+
+            for (auto deviceId = 0u; deviceId < deviceVector.size(); deviceId++) {
+                const auto &clDevice = deviceVector[deviceId];
                 if (requiresRebuild && !shouldSuppressRebuildWarning) {
                     this->updateBuildLog(clDevice->getRootDeviceIndex(), CompilerWarnings::recompiledFromIr.data(), CompilerWarnings::recompiledFromIr.length());
                 }
-                auto compilerErr = pCompilerInterface->build(clDevice->getDevice(), inputArgs, compilerOuput);
+                TranslationOutput::ErrorCode compilerErr;
+                if (parallelBuildOutputs.empty()) {
+                    compilerErr = pCompilerInterface->build(clDevice->getDevice(), inputArgs, compilerOuput);
+                } else {
+                    compilerErr = parallelBuildErrors[deviceId];
+                    compilerOuput = std::move(parallelBuildOutputs[deviceId]);
+                }
                 this->updateBuildLog(clDevice->getRootDeviceIndex(), compilerOuput.frontendCompilerLog.c_str(), compilerOuput.frontendCompilerLog.size());
                 this->updateBuildLog(clDevice->getRootDeviceIndex(), compilerOuput.backendCompilerLog.c_str(), compilerOuput.backendCompilerLog.size());
                 retVal = asClError(compilerErr);
@@ -199,6 +245,45 @@ cl_int Program::build(
     return retVal;
 }
 
+void Program::buildInParallel(CompilerInterface &compilerInterface, const ClDeviceVector &deviceVector, const TranslationInput &inputArgs,
+                              std::vector<TranslationOutput> &outputs, std::vector<TranslationOutput::ErrorCode> &errors) {
+    outputs.resize(deviceVector.size());
+    errors.resize(deviceVector.size(), TranslationOutput::ErrorCode::Success);
+
+    std::vector<size_t> buildSources(deviceVector.size());
+    for (auto deviceId = 0u; deviceId < deviceVector.size(); deviceId++) {
+        buildSources[deviceId] = deviceId;
+        for (auto sourceId = 0u; sourceId < deviceId; sourceId++) {
+            if (buildSources[sourceId] == sourceId && isCompilerOutputShareable(deviceVector[sourceId]->getDevice(), deviceVector[deviceId]->getDevice())) {
+                buildSources[deviceId] = sourceId;
+                break;
+            }
+        }
+    }
+
+    auto buildForDevice = [&](size_t deviceId) {
+        errors[deviceId] = compilerInterface.build(deviceVector[deviceId]->getDevice(), inputArgs, outputs[deviceId]);
+    };
+    std::vector<std::thread> buildThreads;
+    for (auto deviceId = 1u; deviceId < deviceVector.size(); deviceId++) {
+        if (buildSources[deviceId] == deviceId) {
+            buildThreads.emplace_back(buildForDevice, deviceId);
+        }
+    }
+    buildForDevice(0u);
+    for (auto &buildThread : buildThreads) {
+        buildThread.join();
+    }
+
+    for (auto deviceId = 1u; deviceId < deviceVector.size(); deviceId++) {
+        auto sourceId = buildSources[deviceId];
+        if (sourceId != deviceId) {
+            copyCompilerOutput(outputs[sourceId], outputs[deviceId]);
+            errors[deviceId] = errors[sourceId];
+        }
+    }
+}
+
 bool Program::appendKernelDebugOptions(ClDevice &clDevice, std::string &internalOptions) {
     CompilerOptions::concatenateAppend(internalOptions, CompilerOptions::debugKernelEnable);
     CompilerOptions::concatenateAppend(options, CompilerOptions::generateDebugInfo);
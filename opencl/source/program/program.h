@@ -299,6 +299,8 @@ class Program : public BaseObject<_cl_program> {
     MOCKABLE_VIRTUAL bool isOptionValueValid(ConstStringRef option, ConstStringRef value);
 
     MOCKABLE_VIRTUAL bool appendKernelDebugOptions(ClDevice &clDevice, std::string &internalOptions);
+    void buildInParallel(CompilerInterface &compilerInterface, const ClDeviceVector &deviceVector, const TranslationInput &inputArgs,
+                         std::vector<TranslationOutput> &outputs, std::vector<TranslationOutput::ErrorCode> &errors);
     void notifyDebuggerWithSourceCode(ClDevice &clDevice, std::string &filename);
     void prependFilePathToOptions(const std::string &filename);
 
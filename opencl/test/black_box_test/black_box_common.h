@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "CL/cl.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#define CL_SUCCESS_OR_ABORT(call)                                              \
+    do {                                                                       \
+        cl_int status = (call);                                                \
+        if (status != CL_SUCCESS) {                                            \
+            std::cout << "Error " << status << " returned by " << #call        \
+                      << " at " << __FILE__ << ":" << __LINE__ << std::endl;   \
+            std::abort();                                                      \
+        }                                                                      \
+    } while (0)
+
+inline int getParamValue(int argc, char **argv, const char *shortName, const char *longName, int defaultValue) {
+    for (int i = 1; i < argc - 1; i++) {
+        if (strcmp(argv[i], shortName) == 0 || strcmp(argv[i], longName) == 0) {
+            return std::atoi(argv[i + 1]);
+        }
+    }
+    return defaultValue;
+}
+
+inline bool isParamEnabled(int argc, char **argv, const char *shortName, const char *longName) {
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], shortName) == 0 || strcmp(argv[i], longName) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+inline void createContextForFirstGpu(cl_device_id &device, cl_context &context) {
+    cl_uint platformsCount = 0;
+    CL_SUCCESS_OR_ABORT(clGetPlatformIDs(0, nullptr, &platformsCount));
+    if (platformsCount == 0) {
+        std::cout << "No OpenCL platforms found" << std::endl;
+        std::abort();
+    }
+
+    auto platforms = std::make_unique<cl_platform_id[]>(platformsCount);
+    CL_SUCCESS_OR_ABORT(clGetPlatformIDs(platformsCount, platforms.get(), nullptr));
+    CL_SUCCESS_OR_ABORT(clGetDeviceIDs(platforms[0], CL_DEVICE_TYPE_GPU, 1, &device, nullptr));
+
+    cl_int err = CL_SUCCESS;
+    context = clCreateContext(nullptr, 1, &device, nullptr, nullptr, &err);
+    CL_SUCCESS_OR_ABORT(err);
+}
+
+inline cl_command_queue createCommandQueue(cl_context context, cl_device_id device, cl_command_queue_properties properties) {
+    cl_queue_properties queueProperties[] = {CL_QUEUE_PROPERTIES, properties, 0};
+    cl_int err = CL_SUCCESS;
+    auto queue = clCreateCommandQueueWithProperties(context, device, properties ? queueProperties : nullptr, &err);
+    CL_SUCCESS_OR_ABORT(err);
+    return queue;
+}
+
+inline cl_kernel createKernel(cl_context context, cl_device_id device, const char *source, const char *kernelName, cl_program &program) {
+    cl_int err = CL_SUCCESS;
+    program = clCreateProgramWithSource(context, 1, &source, nullptr, &err);
+    CL_SUCCESS_OR_ABORT(err);
+
+    err = clBuildProgram(program, 1, &device, nullptr, nullptr, nullptr);
+    if (err != CL_SUCCESS) {
+        size_t logSize = 0;
+        if (clGetProgramBuildInfo(program, device, CL_PROGRAM_BUILD_LOG, 0, nullptr, &logSize) == CL_SUCCESS && logSize > 0) {
+            auto buildLog = std::make_unique<char[]>(logSize);
+            if (clGetProgramBuildInfo(program, device, CL_PROGRAM_BUILD_LOG, logSize, buildLog.get(), nullptr) == CL_SUCCESS) {
+                buildLog[logSize - 1] = '\0';
+                std::cout << "Build log:\n"
+                          << buildLog.get() << std::endl;
+            }
+        }
+        CL_SUCCESS_OR_ABORT(err);
+    }
+
+    auto kernel = clCreateKernel(program, kernelName, &err);
+    CL_SUCCESS_OR_ABORT(err);
+    return kernel;
+}
+
+inline double getElapsedMicroseconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "black_box_common.h"
+
+#include <iomanip>
+#include <vector>
+
+// Run with NEOReadDebugKeys=1 ExperimentalBufferPoolSizeClasses=1..3 to compare buffer pool size classes,
+// buffers up to 4KB, 64KB and 1MB are pooled with 1, 2 and 3 classes enabled
+int main(int argc, char **argv) {
+    const size_t maxSize = static_cast<size_t>(getParamValue(argc, argv, "-s", "--size", 1024)) * 1024;
+    const uint32_t buffersCount = static_cast<uint32_t>(getParamValue(argc, argv, "-n", "--buffers", 256));
+    const uint32_t iterations = static_cast<uint32_t>(getParamValue(argc, argv, "-i", "--iterations", 10));
+    if (maxSize == 0 || buffersCount == 0 || iterations == 0) {
+        std::cout << "Size, buffer count and iteration count have to be non-zero" << std::endl;
+        return 1;
+    }
+
+    cl_device_id device = nullptr;
+    cl_context context = nullptr;
+    createContextForFirstGpu(device, context);
+
+    std::cout << std::setw(12) << "Size [B]" << std::setw(20) << "clCreateBuffer [us]" << std::setw(24) << "clReleaseMemObject [us]" << std::endl;
+
+    std::vector<cl_mem> buffers(buffersCount);
+    for (size_t size = 1024; size <= maxSize; size *= 2) {
+        double createTime = 0;
+        double releaseTime = 0;
+        for (uint32_t iteration = 0; iteration < iterations; iteration++) {
+            auto start = std::chrono::steady_clock::now();
+            for (auto &buffer : buffers) {
+                cl_int err = CL_SUCCESS;
+                buffer = clCreateBuffer(context, CL_MEM_READ_WRITE, size, nullptr, &err);
+                CL_SUCCESS_OR_ABORT(err);
+            }
+            createTime += getElapsedMicroseconds(start);
+
+            start = std::chrono::steady_clock::now();
+            for (auto &buffer : buffers) {
+                CL_SUCCESS_OR_ABORT(clReleaseMemObject(buffer));
+            }
+            releaseTime += getElapsedMicroseconds(start);
+        }
+
+        auto allocationsCount = static_cast<double>(buffersCount) * iterations;
+        std::cout << std::setw(12) << size
+                  << std::setw(20) << std::fixed << std::setprecision(2) << createTime / allocationsCount
+                  << std::setw(24) << std::fixed << std::setprecision(2) << releaseTime / allocationsCount << std::endl;
+    }
+
+    CL_SUCCESS_OR_ABORT(clReleaseContext(context));
+    return 0;
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "black_box_common.h"
+
+#include <iomanip>
+#include <vector>
+
+namespace {
+const char *source = R"===(
+    __kernel void empty() {
+    }
+)===";
+} // namespace
+
+// Measures empty kernel enqueue rate on an in-order queue without wait lists and output events,
+// compared with enqueues that return an event, wait on the previous one, or go to an out-of-order queue
+int main(int argc, char **argv) {
+    const uint32_t iterations = static_cast<uint32_t>(getParamValue(argc, argv, "-i", "--iterations", 10000));
+    if (iterations == 0) {
+        std::cout << "Iteration count has to be non-zero" << std::endl;
+        return 1;
+    }
+
+    cl_device_id device = nullptr;
+    cl_context context = nullptr;
+    createContextForFirstGpu(device, context);
+    auto inOrderQueue = createCommandQueue(context, device, 0);
+    auto outOfOrderQueue = createCommandQueue(context, device, CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE);
+    cl_program program = nullptr;
+    auto kernel = createKernel(context, device, source, "empty", program);
+
+    const size_t gws = 1;
+    std::vector<cl_event> events(iterations, nullptr);
+
+    auto measure = [&](const char *name, cl_command_queue queue, bool returnEvents, bool waitOnPreviousEvent) {
+        CL_SUCCESS_OR_ABORT(clEnqueueNDRangeKernel(queue, kernel, 1, nullptr, &gws, nullptr, 0, nullptr, nullptr));
+        CL_SUCCESS_OR_ABORT(clFinish(queue));
+
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < iterations; i++) {
+            auto waitEvent = (waitOnPreviousEvent && i > 0) ? &events[i - 1] : nullptr;
+            CL_SUCCESS_OR_ABORT(clEnqueueNDRangeKernel(queue, kernel, 1, nullptr, &gws, nullptr,
+                                                       waitEvent ? 1 : 0, waitEvent, returnEvents ? &events[i] : nullptr));
+        }
+        auto submitTime = getElapsedMicroseconds(start);
+        CL_SUCCESS_OR_ABORT(clFinish(queue));
+        auto totalTime = getElapsedMicroseconds(start);
+
+        if (returnEvents) {
+            for (auto &event : events) {
+                CL_SUCCESS_OR_ABORT(clReleaseEvent(event));
+                event = nullptr;
+            }
+        }
+
+        std::cout << std::setw(28) << name
+                  << std::setw(16) << std::fixed << std::setprecision(3) << submitTime / iterations
+                  << std::setw(16) << std::fixed << std::setprecision(0) << iterations / (submitTime / 1e6)
+                  << std::setw(16) << std::fixed << std::setprecision(0) << iterations / (totalTime / 1e6) << std::endl;
+    };
+
+    std::cout << std::setw(28) << "Mode" << std::setw(16) << "Enqueue [us]" << std::setw(16) << "Enqueues/s" << std::setw(16) << "Completed/s" << std::endl;
+    measure("in-order", inOrderQueue, false, false);
+    measure("in-order, output event", inOrderQueue, true, false);
+    measure("in-order, wait on previous", inOrderQueue, true, true);
+    measure("out-of-order", outOfOrderQueue, false, false);
+
+    CL_SUCCESS_OR_ABORT(clReleaseKernel(kernel));
+    CL_SUCCESS_OR_ABORT(clReleaseProgram(program));
+    CL_SUCCESS_OR_ABORT(clReleaseCommandQueue(outOfOrderQueue));
+    CL_SUCCESS_OR_ABORT(clReleaseCommandQueue(inOrderQueue));
+    CL_SUCCESS_OR_ABORT(clReleaseContext(context));
+    return 0;
+}
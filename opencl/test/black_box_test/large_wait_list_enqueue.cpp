@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "black_box_common.h"
+
+#include <iomanip>
+#include <vector>
+
+namespace {
+const char *source = R"===(
+    __kernel void increment(__global int *counter) {
+        atomic_inc(counter);
+    }
+)===";
+} // namespace
+
+// Measures the host time of one kernel enqueue waiting on a large wait list,
+// the waited events are produced by kernels distributed round-robin over several in-order queues
+int main(int argc, char **argv) {
+    const uint32_t queuesCount = static_cast<uint32_t>(getParamValue(argc, argv, "-q", "--queues", 4));
+    const uint32_t maxWaitListSize = static_cast<uint32_t>(getParamValue(argc, argv, "-w", "--wait-list", 256));
+    const uint32_t rounds = static_cast<uint32_t>(getParamValue(argc, argv, "-r", "--rounds", 100));
+    if (queuesCount == 0 || maxWaitListSize == 0 || rounds == 0) {
+        std::cout << "Queue count, wait list size and round count have to be non-zero" << std::endl;
+        return 1;
+    }
+
+    cl_device_id device = nullptr;
+    cl_context context = nullptr;
+    createContextForFirstGpu(device, context);
+    std::vector<cl_command_queue> queues(queuesCount);
+    for (auto &queue : queues) {
+        queue = createCommandQueue(context, device, 0);
+    }
+    auto consumerQueue = createCommandQueue(context, device, 0);
+    cl_program program = nullptr;
+    auto kernel = createKernel(context, device, source, "increment", program);
+
+    cl_int counter = 0;
+    cl_int err = CL_SUCCESS;
+    auto counterBuffer = clCreateBuffer(context, CL_MEM_READ_WRITE | CL_MEM_COPY_HOST_PTR, sizeof(cl_int), &counter, &err);
+    CL_SUCCESS_OR_ABORT(err);
+    CL_SUCCESS_OR_ABORT(clSetKernelArg(kernel, 0, sizeof(cl_mem), &counterBuffer));
+
+    const size_t gws = 1;
+    uint64_t expectedCounter = 0;
+    std::vector<cl_event> waitList;
+
+    std::cout << std::setw(16) << "Wait list size" << std::setw(12) << "Queues" << std::setw(16) << "Enqueue [us]" << std::endl;
+
+    for (uint32_t waitListSize = 1; waitListSize <= maxWaitListSize; waitListSize *= 4) {
+        waitList.resize(waitListSize);
+        double enqueueTime = 0;
+        for (uint32_t round = 0; round < rounds; round++) {
+            for (uint32_t i = 0; i < waitListSize; i++) {
+                CL_SUCCESS_OR_ABORT(clEnqueueNDRangeKernel(queues[i % queuesCount], kernel, 1, nullptr, &gws, nullptr, 0, nullptr, &waitList[i]));
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            CL_SUCCESS_OR_ABORT(clEnqueueNDRangeKernel(consumerQueue, kernel, 1, nullptr, &gws, nullptr, waitListSize, waitList.data(), nullptr));
+            enqueueTime += getElapsedMicroseconds(start);
+
+            for (auto &queue : queues) {
+                CL_SUCCESS_OR_ABORT(clFlush(queue));
+            }
+            CL_SUCCESS_OR_ABORT(clFinish(consumerQueue));
+            for (auto &event : waitList) {
+                CL_SUCCESS_OR_ABORT(clReleaseEvent(event));
+            }
+            expectedCounter += waitListSize + 1;
+        }
+
+        std::cout << std::setw(16) << waitListSize
+                  << std::setw(12) << queuesCount
+                  << std::setw(16) << std::fixed << std::setprecision(2) << enqueueTime / rounds << std::endl;
+    }
+
+    for (auto &queue : queues) {
+        CL_SUCCESS_OR_ABORT(clFinish(queue));
+    }
+    CL_SUCCESS_OR_ABORT(clEnqueueReadBuffer(consumerQueue, counterBuffer, CL_TRUE, 0, sizeof(cl_int), &counter, 0, nullptr, nullptr));
+    bool outputValidationSuccessful = static_cast<uint64_t>(counter) == expectedCounter;
+    if (!outputValidationSuccessful) {
+        std::cout << "Invalid counter value " << counter << ", expected " << expectedCounter << std::endl;
+    }
+
+    CL_SUCCESS_OR_ABORT(clReleaseMemObject(counterBuffer));
+    CL_SUCCESS_OR_ABORT(clReleaseKernel(kernel));
+    CL_SUCCESS_OR_ABORT(clReleaseProgram(program));
+    CL_SUCCESS_OR_ABORT(clReleaseCommandQueue(consumerQueue));
+    for (auto &queue : queues) {
+        CL_SUCCESS_OR_ABORT(clReleaseCommandQueue(queue));
+    }
+    CL_SUCCESS_OR_ABORT(clReleaseContext(context));
+    return outputValidationSuccessful ? 0 : 1;
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "black_box_common.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <vector>
+
+namespace {
+const char *source = R"===(
+    __kernel void blur(__global const float *src, __global float *dst) {
+        int x = get_global_id(0);
+        int y = get_global_id(1);
+        int width = get_global_size(0);
+        int height = get_global_size(1);
+        float sum = 0.0f;
+        for (int dy = -1; dy <= 1; dy++) {
+            for (int dx = -1; dx <= 1; dx++) {
+                int sx = clamp(x + dx, 0, width - 1);
+                int sy = clamp(y + dy, 0, height - 1);
+                sum += src[sy * width + sx];
+            }
+        }
+        dst[y * width + x] = sum / 9.0f;
+    }
+)===";
+} // namespace
+
+// Run with NEOReadDebugKeys=1 ExperimentalLocalWorkSizeTuning=<N> to time local work size candidates
+// during the first launches, kernel time of launches after tuning should not exceed the untuned heuristic
+int main(int argc, char **argv) {
+    const size_t width = static_cast<size_t>(getParamValue(argc, argv, "-w", "--width", 1024));
+    const size_t height = static_cast<size_t>(getParamValue(argc, argv, "-h", "--height", 1024));
+    const uint32_t launches = static_cast<uint32_t>(getParamValue(argc, argv, "-l", "--launches", 128));
+    const uint32_t window = static_cast<uint32_t>(getParamValue(argc, argv, "-b", "--window", 16));
+    if (width == 0 || height == 0 || launches == 0 || window == 0) {
+        std::cout << "Image size, launch count and window size have to be non-zero" << std::endl;
+        return 1;
+    }
+
+    cl_device_id device = nullptr;
+    cl_context context = nullptr;
+    createContextForFirstGpu(device, context);
+    auto queue = createCommandQueue(context, device, CL_QUEUE_PROFILING_ENABLE);
+    cl_program program = nullptr;
+    auto kernel = createKernel(context, device, source, "blur", program);
+
+    const size_t bufferSize = width * height * sizeof(cl_float);
+    std::vector<cl_float> input(width * height, 9.0f);
+    cl_int err = CL_SUCCESS;
+    auto srcBuffer = clCreateBuffer(context, CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, bufferSize, input.data(), &err);
+    CL_SUCCESS_OR_ABORT(err);
+    auto dstBuffer = clCreateBuffer(context, CL_MEM_WRITE_ONLY, bufferSize, nullptr, &err);
+    CL_SUCCESS_OR_ABORT(err);
+    CL_SUCCESS_OR_ABORT(clSetKernelArg(kernel, 0, sizeof(cl_mem), &srcBuffer));
+    CL_SUCCESS_OR_ABORT(clSetKernelArg(kernel, 1, sizeof(cl_mem), &dstBuffer));
+
+    const size_t gws[2] = {width, height};
+    std::vector<cl_event> events(launches, nullptr);
+    for (auto &event : events) {
+        CL_SUCCESS_OR_ABORT(clEnqueueNDRangeKernel(queue, kernel, 2, nullptr, gws, nullptr, 0, nullptr, &event));
+    }
+    CL_SUCCESS_OR_ABORT(clFinish(queue));
+
+    std::cout << std::setw(16) << "Launches" << std::setw(20) << "Avg kernel [us]" << std::setw(20) << "Min kernel [us]" << std::endl;
+    for (uint32_t first = 0; first < launches; first += window) {
+        auto last = std::min(first + window, launches);
+        double total = 0;
+        double fastest = 0;
+        for (uint32_t i = first; i < last; i++) {
+            cl_ulong start = 0;
+            cl_ulong end = 0;
+            CL_SUCCESS_OR_ABORT(clGetEventProfilingInfo(events[i], CL_PROFILING_COMMAND_START, sizeof(start), &start, nullptr));
+            CL_SUCCESS_OR_ABORT(clGetEventProfilingInfo(events[i], CL_PROFILING_COMMAND_END, sizeof(end), &end, nullptr));
+            auto kernelTime = static_cast<double>(end - start) / 1000.0;
+            total += kernelTime;
+            fastest = (i == first) ? kernelTime : std::min(fastest, kernelTime);
+        }
+        std::string range = std::to_string(first) + "-" + std::to_string(last - 1);
+        std::cout << std::setw(16) << range
+                  << std::setw(20) << std::fixed << std::setprecision(2) << total / (last - first)
+                  << std::setw(20) << std::fixed << std::setprecision(2) << fastest << std::endl;
+    }
+
+    for (auto &event : events) {
+        CL_SUCCESS_OR_ABORT(clReleaseEvent(event));
+    }
+
+    bool outputValidationSuccessful = true;
+    std::vector<cl_float> output(width * height, 0.0f);
+    CL_SUCCESS_OR_ABORT(clEnqueueReadBuffer(queue, dstBuffer, CL_TRUE, 0, bufferSize, output.data(), 0, nullptr, nullptr));
+    for (size_t i = 0; i < output.size(); i++) {
+        if (output[i] < 8.99f || output[i] > 9.01f) {
+            std::cout << "Invalid value in buffer at index " << i << std::endl;
+            outputValidationSuccessful = false;
+            break;
+        }
+    }
+
+    CL_SUCCESS_OR_ABORT(clReleaseMemObject(dstBuffer));
+    CL_SUCCESS_OR_ABORT(clReleaseMemObject(srcBuffer));
+    CL_SUCCESS_OR_ABORT(clReleaseKernel(kernel));
+    CL_SUCCESS_OR_ABORT(clReleaseProgram(program));
+    CL_SUCCESS_OR_ABORT(clReleaseCommandQueue(queue));
+    CL_SUCCESS_OR_ABORT(clReleaseContext(context));
+    return outputValidationSuccessful ? 0 : 1;
+}
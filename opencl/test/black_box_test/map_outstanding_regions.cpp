@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "black_box_common.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <random>
+#include <vector>
+
+// Keeps many disjoint sub-region maps of one buffer outstanding and measures map and unmap latency,
+// unmaps are issued in shuffled order so lookups do not always hit the most recent map
+int main(int argc, char **argv) {
+    const uint32_t maxMapsCount = static_cast<uint32_t>(getParamValue(argc, argv, "-n", "--maps", 4096));
+    const size_t regionSize = static_cast<size_t>(getParamValue(argc, argv, "-r", "--region", 256));
+    if (maxMapsCount == 0 || regionSize == 0) {
+        std::cout << "Map count and region size have to be non-zero" << std::endl;
+        return 1;
+    }
+
+    cl_device_id device = nullptr;
+    cl_context context = nullptr;
+    createContextForFirstGpu(device, context);
+    auto queue = createCommandQueue(context, device, 0);
+
+    const size_t bufferSize = regionSize * maxMapsCount;
+    cl_int err = CL_SUCCESS;
+    auto buffer = clCreateBuffer(context, CL_MEM_READ_WRITE, bufferSize, nullptr, &err);
+    CL_SUCCESS_OR_ABORT(err);
+
+    std::cout << std::setw(16) << "Outstanding maps" << std::setw(16) << "Map [us]" << std::setw(16) << "Unmap [us]" << std::endl;
+
+    bool outputValidationSuccessful = true;
+    std::mt19937 generator(0);
+    std::vector<void *> mappedPtrs;
+    std::vector<uint32_t> unmapOrder;
+    for (uint32_t mapsCount = 64; mapsCount <= maxMapsCount; mapsCount *= 4) {
+        mappedPtrs.resize(mapsCount);
+
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < mapsCount; i++) {
+            mappedPtrs[i] = clEnqueueMapBuffer(queue, buffer, CL_TRUE, CL_MAP_WRITE, i * regionSize, regionSize, 0, nullptr, nullptr, &err);
+            CL_SUCCESS_OR_ABORT(err);
+        }
+        auto mapTime = getElapsedMicroseconds(start);
+
+        for (uint32_t i = 0; i < mapsCount; i++) {
+            memset(mappedPtrs[i], static_cast<int>(i % 251), regionSize);
+        }
+
+        unmapOrder.resize(mapsCount);
+        for (uint32_t i = 0; i < mapsCount; i++) {
+            unmapOrder[i] = i;
+        }
+        std::shuffle(unmapOrder.begin(), unmapOrder.end(), generator);
+
+        start = std::chrono::steady_clock::now();
+        for (auto index : unmapOrder) {
+            CL_SUCCESS_OR_ABORT(clEnqueueUnmapMemObject(queue, buffer, mappedPtrs[index], 0, nullptr, nullptr));
+        }
+        CL_SUCCESS_OR_ABORT(clFinish(queue));
+        auto unmapTime = getElapsedMicroseconds(start);
+
+        std::cout << std::setw(16) << mapsCount
+                  << std::setw(16) << std::fixed << std::setprecision(2) << mapTime / mapsCount
+                  << std::setw(16) << std::fixed << std::setprecision(2) << unmapTime / mapsCount << std::endl;
+
+        auto readPtr = static_cast<uint8_t *>(clEnqueueMapBuffer(queue, buffer, CL_TRUE, CL_MAP_READ, 0, mapsCount * regionSize, 0, nullptr, nullptr, &err));
+        CL_SUCCESS_OR_ABORT(err);
+        for (uint32_t i = 0; i < mapsCount && outputValidationSuccessful; i++) {
+            if (readPtr[i * regionSize] != static_cast<uint8_t>(i % 251) || readPtr[(i + 1) * regionSize - 1] != static_cast<uint8_t>(i % 251)) {
+                std::cout << "Data mismatch in region " << i << std::endl;
+                outputValidationSuccessful = false;
+            }
+        }
+        CL_SUCCESS_OR_ABORT(clEnqueueUnmapMemObject(queue, buffer, readPtr, 0, nullptr, nullptr));
+        CL_SUCCESS_OR_ABORT(clFinish(queue));
+
+        if (!outputValidationSuccessful) {
+            break;
+        }
+    }
+
+    CL_SUCCESS_OR_ABORT(clReleaseMemObject(buffer));
+    CL_SUCCESS_OR_ABORT(clReleaseCommandQueue(queue));
+    CL_SUCCESS_OR_ABORT(clReleaseContext(context));
+    return outputValidationSuccessful ? 0 : 1;
+}
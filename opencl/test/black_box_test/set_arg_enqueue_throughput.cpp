@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "black_box_common.h"
+
+#include <iomanip>
+#include <vector>
+
+namespace {
+const char *source = R"===(
+    __kernel void add(__global int *dst, __global const int *srcA, __global const int *srcB, __global const int *srcC) {
+        size_t id = get_global_id(0);
+        dst[id] = srcA[id] + srcB[id] + srcC[id];
+    }
+)===";
+
+constexpr cl_uint argsCount = 4;
+} // namespace
+
+// Measures clSetKernelArg + clEnqueueNDRangeKernel throughput when every argument is set to the same buffer
+// as in the previous iteration, and when two sets of buffers alternate so every argument changes
+int main(int argc, char **argv) {
+    const uint32_t iterations = static_cast<uint32_t>(getParamValue(argc, argv, "-i", "--iterations", 10000));
+    const size_t gws = static_cast<size_t>(getParamValue(argc, argv, "-g", "--gws", 256));
+    if (iterations == 0 || gws == 0) {
+        std::cout << "Iteration count and global work size have to be non-zero" << std::endl;
+        return 1;
+    }
+
+    cl_device_id device = nullptr;
+    cl_context context = nullptr;
+    createContextForFirstGpu(device, context);
+    auto queue = createCommandQueue(context, device, 0);
+    cl_program program = nullptr;
+    auto kernel = createKernel(context, device, source, "add", program);
+
+    const size_t bufferSize = gws * sizeof(cl_int);
+    std::vector<int> initialData(gws, 1);
+    cl_mem buffers[2][argsCount] = {};
+    for (auto &bufferSet : buffers) {
+        for (auto &buffer : bufferSet) {
+            cl_int err = CL_SUCCESS;
+            buffer = clCreateBuffer(context, CL_MEM_READ_WRITE | CL_MEM_COPY_HOST_PTR, bufferSize, initialData.data(), &err);
+            CL_SUCCESS_OR_ABORT(err);
+        }
+    }
+
+    auto measure = [&](bool alternateBuffers) {
+        for (cl_uint argIndex = 0; argIndex < argsCount; argIndex++) {
+            CL_SUCCESS_OR_ABORT(clSetKernelArg(kernel, argIndex, sizeof(cl_mem), &buffers[0][argIndex]));
+        }
+        CL_SUCCESS_OR_ABORT(clEnqueueNDRangeKernel(queue, kernel, 1, nullptr, &gws, nullptr, 0, nullptr, nullptr));
+        CL_SUCCESS_OR_ABORT(clFinish(queue));
+
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < iterations; i++) {
+            auto &bufferSet = buffers[alternateBuffers ? (i % 2) : 0];
+            for (cl_uint argIndex = 0; argIndex < argsCount; argIndex++) {
+                CL_SUCCESS_OR_ABORT(clSetKernelArg(kernel, argIndex, sizeof(cl_mem), &bufferSet[argIndex]));
+            }
+            CL_SUCCESS_OR_ABORT(clEnqueueNDRangeKernel(queue, kernel, 1, nullptr, &gws, nullptr, 0, nullptr, nullptr));
+        }
+        auto submitTime = getElapsedMicroseconds(start);
+        CL_SUCCESS_OR_ABORT(clFinish(queue));
+        auto totalTime = getElapsedMicroseconds(start);
+
+        std::cout << std::setw(16) << (alternateBuffers ? "alternating" : "unchanged")
+                  << std::setw(20) << std::fixed << std::setprecision(3) << submitTime / iterations
+                  << std::setw(20) << std::fixed << std::setprecision(0) << iterations / (totalTime / 1e6) << std::endl;
+    };
+
+    std::cout << std::setw(16) << "Arguments" << std::setw(20) << "setArg+enqueue [us]" << std::setw(20) << "Enqueues/s" << std::endl;
+    measure(false);
+    measure(true);
+
+    bool outputValidationSuccessful = true;
+    cl_int err = CL_SUCCESS;
+    auto result = static_cast<int *>(clEnqueueMapBuffer(queue, buffers[0][0], CL_TRUE, CL_MAP_READ, 0, bufferSize, 0, nullptr, nullptr, &err));
+    CL_SUCCESS_OR_ABORT(err);
+    for (size_t i = 0; i < gws; i++) {
+        if (result[i] != 3) {
+            std::cout << "Invalid value in buffer at index " << i << std::endl;
+            outputValidationSuccessful = false;
+            break;
+        }
+    }
+    CL_SUCCESS_OR_ABORT(clEnqueueUnmapMemObject(queue, buffers[0][0], result, 0, nullptr, nullptr));
+    CL_SUCCESS_OR_ABORT(clFinish(queue));
+
+    for (auto &bufferSet : buffers) {
+        for (auto &buffer : bufferSet) {
+            CL_SUCCESS_OR_ABORT(clReleaseMemObject(buffer));
+        }
+    }
+    CL_SUCCESS_OR_ABORT(clReleaseKernel(kernel));
+    CL_SUCCESS_OR_ABORT(clReleaseProgram(program));
+    CL_SUCCESS_OR_ABORT(clReleaseCommandQueue(queue));
+    CL_SUCCESS_OR_ABORT(clReleaseContext(context));
+    return outputValidationSuccessful ? 0 : 1;
+}
@@ -0,0 +1,363 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/test/common/libult/ult_command_stream_receiver.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include "opencl/source/command_queue/cl_command_buffer.h"
+#include "opencl/source/event/user_event.h"
+#include "opencl/test/unit_test/mocks/mock_command_queue.h"
+
+#include "cl_api_tests.h"
+
+using namespace NEO;
+
+namespace ULT {
+
+struct CommandBufferReplayCommandQueue : public MockCommandQueue {
+    using MockCommandQueue::MockCommandQueue;
+
+    cl_int enqueueFillBuffer(Buffer *buffer, const void *pattern, size_t patternSize, size_t offset,
+                             size_t size, cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event) override {
+        if (isRecordingCommands()) {
+            return CL_SUCCESS;
+        }
+        lastFillPattern = *static_cast<const uint32_t *>(pattern);
+        enqueueFillBufferCalled++;
+        return CL_SUCCESS;
+    }
+
+    cl_int enqueueCopyBuffer(Buffer *srcBuffer, Buffer *dstBuffer, size_t srcOffset, size_t dstOffset,
+                             size_t size, cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event) override {
+        if (isRecordingCommands()) {
+            return CL_SUCCESS;
+        }
+        enqueueCopyBufferCalled++;
+        return enqueueCopyBufferRetVal;
+    }
+
+    cl_int enqueueBarrierWithWaitList(cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event) override {
+        enqueueBarrierCalled++;
+        return CL_SUCCESS;
+    }
+
+    cl_int enqueueMarkerWithWaitList(cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event) override {
+        enqueueMarkerCalled++;
+        if (event && createMarkerEvents) {
+            lastMarkerEvent = new UserEvent(context);
+            *event = lastMarkerEvent;
+        }
+        return CL_SUCCESS;
+    }
+
+    cl_int flush() override {
+        flushCalled++;
+        return CL_SUCCESS;
+    }
+
+    UserEvent *lastMarkerEvent = nullptr;
+    cl_int enqueueCopyBufferRetVal = CL_SUCCESS;
+    bool createMarkerEvents = false;
+    uint32_t lastFillPattern = 0u;
+    uint32_t enqueueFillBufferCalled = 0u;
+    uint32_t enqueueCopyBufferCalled = 0u;
+    uint32_t enqueueBarrierCalled = 0u;
+    uint32_t enqueueMarkerCalled = 0u;
+    uint32_t flushCalled = 0u;
+};
+
+struct clCommandBufferKHRTests : public api_tests {
+    void SetUp() override {
+        api_tests::SetUp();
+        commandQueue = pCommandQueue;
+        buffer = clCreateBuffer(pContext, CL_MEM_READ_WRITE, 64, nullptr, &retVal);
+        ASSERT_EQ(CL_SUCCESS, retVal);
+    }
+
+    void TearDown() override {
+        clReleaseMemObject(buffer);
+        api_tests::TearDown();
+    }
+
+    cl_command_queue commandQueue = nullptr;
+    cl_mem buffer = nullptr;
+};
+
+TEST_F(clCommandBufferKHRTests, GivenInvalidQueuesWhenCreatingCommandBufferThenErrorIsReturned) {
+    EXPECT_EQ(nullptr, clCreateCommandBufferKHR(0, &commandQueue, nullptr, &retVal));
+    EXPECT_EQ(CL_INVALID_VALUE, retVal);
+
+    EXPECT_EQ(nullptr, clCreateCommandBufferKHR(1, nullptr, nullptr, &retVal));
+    EXPECT_EQ(CL_INVALID_VALUE, retVal);
+
+    cl_command_queue invalidQueue = reinterpret_cast<cl_command_queue>(buffer);
+    EXPECT_EQ(nullptr, clCreateCommandBufferKHR(1, &invalidQueue, nullptr, &retVal));
+    EXPECT_EQ(CL_INVALID_COMMAND_QUEUE, retVal);
+
+    pCommandQueue->setOoqEnabled();
+    EXPECT_EQ(nullptr, clCreateCommandBufferKHR(1, &commandQueue, nullptr, &retVal));
+    EXPECT_EQ(CL_INCOMPATIBLE_COMMAND_QUEUE_KHR, retVal);
+}
+
+TEST_F(clCommandBufferKHRTests, GivenUnsupportedPropertyWhenCreatingCommandBufferThenInvalidValueIsReturned) {
+    cl_command_buffer_properties_khr properties[] = {CL_COMMAND_BUFFER_FLAGS_KHR, 0x10, 0};
+    EXPECT_EQ(nullptr, clCreateCommandBufferKHR(1, &commandQueue, properties, &retVal));
+    EXPECT_EQ(CL_INVALID_VALUE, retVal);
+}
+
+TEST_F(clCommandBufferKHRTests, GivenCommandBufferWhenQueryingInfoThenRecordedPropertiesAreReturned) {
+    cl_command_buffer_properties_khr properties[] = {CL_COMMAND_BUFFER_FLAGS_KHR, CL_COMMAND_BUFFER_SIMULTANEOUS_USE_KHR, 0};
+    auto commandBuffer = clCreateCommandBufferKHR(1, &commandQueue, properties, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    ASSERT_NE(nullptr, commandBuffer);
+
+    cl_command_queue queue = nullptr;
+    EXPECT_EQ(CL_SUCCESS, clGetCommandBufferInfoKHR(commandBuffer, CL_COMMAND_BUFFER_QUEUES_KHR, sizeof(queue), &queue, nullptr));
+    EXPECT_EQ(commandQueue, queue);
+
+    cl_uint value = 0u;
+    EXPECT_EQ(CL_SUCCESS, clGetCommandBufferInfoKHR(commandBuffer, CL_COMMAND_BUFFER_NUM_QUEUES_KHR, sizeof(value), &value, nullptr));
+    EXPECT_EQ(1u, value);
+
+    EXPECT_EQ(CL_SUCCESS, clRetainCommandBufferKHR(commandBuffer));
+    EXPECT_EQ(CL_SUCCESS, clGetCommandBufferInfoKHR(commandBuffer, CL_COMMAND_BUFFER_REFERENCE_COUNT_KHR, sizeof(value), &value, nullptr));
+    EXPECT_EQ(2u, value);
+    EXPECT_EQ(CL_SUCCESS, clReleaseCommandBufferKHR(commandBuffer));
+
+    cl_command_buffer_state_khr state = CL_COMMAND_BUFFER_STATE_INVALID_KHR;
+    EXPECT_EQ(CL_SUCCESS, clGetCommandBufferInfoKHR(commandBuffer, CL_COMMAND_BUFFER_STATE_KHR, sizeof(state), &state, nullptr));
+    EXPECT_EQ(static_cast<cl_command_buffer_state_khr>(CL_COMMAND_BUFFER_STATE_RECORDING_KHR), state);
+
+    size_t size = 0u;
+    cl_command_buffer_properties_khr returnedProperties[3] = {};
+    EXPECT_EQ(CL_SUCCESS, clGetCommandBufferInfoKHR(commandBuffer, CL_COMMAND_BUFFER_PROPERTIES_ARRAY_KHR, sizeof(returnedProperties), returnedProperties, &size));
+    EXPECT_EQ(sizeof(properties), size);
+    EXPECT_EQ(0, memcmp(properties, returnedProperties, sizeof(properties)));
+
+    EXPECT_EQ(CL_INVALID_VALUE, clGetCommandBufferInfoKHR(commandBuffer, CL_DEVICE_NAME, sizeof(value), &value, nullptr));
+    EXPECT_EQ(CL_SUCCESS, clReleaseCommandBufferKHR(commandBuffer));
+}
+
+TEST_F(clCommandBufferKHRTests, GivenInvalidCommandBufferWhenCallingCommandBufferFunctionsThenInvalidCommandBufferIsReturned) {
+    cl_command_buffer_khr invalidCommandBuffer = reinterpret_cast<cl_command_buffer_khr>(buffer);
+    EXPECT_EQ(CL_INVALID_COMMAND_BUFFER_KHR, clFinalizeCommandBufferKHR(nullptr));
+    EXPECT_EQ(CL_INVALID_COMMAND_BUFFER_KHR, clRetainCommandBufferKHR(invalidCommandBuffer));
+    EXPECT_EQ(CL_INVALID_COMMAND_BUFFER_KHR, clReleaseCommandBufferKHR(nullptr));
+    EXPECT_EQ(CL_INVALID_COMMAND_BUFFER_KHR, clEnqueueCommandBufferKHR(0, nullptr, invalidCommandBuffer, 0, nullptr, nullptr));
+    EXPECT_EQ(CL_INVALID_COMMAND_BUFFER_KHR, clCommandBarrierWithWaitListKHR(nullptr, nullptr, 0, nullptr, nullptr, nullptr));
+    EXPECT_EQ(CL_INVALID_COMMAND_BUFFER_KHR, clGetCommandBufferInfoKHR(invalidCommandBuffer, CL_COMMAND_BUFFER_STATE_KHR, 0, nullptr, nullptr));
+}
+
+TEST_F(clCommandBufferKHRTests, GivenInvalidRecordArgumentsWhenRecordingCommandsThenErrorIsReturned) {
+    auto commandBuffer = clCreateCommandBufferKHR(1, &commandQueue, nullptr, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    EXPECT_EQ(CL_INVALID_COMMAND_QUEUE, clCommandBarrierWithWaitListKHR(commandBuffer, commandQueue, 0, nullptr, nullptr, nullptr));
+
+    cl_mutable_command_khr mutableHandle = nullptr;
+    EXPECT_EQ(CL_INVALID_VALUE, clCommandBarrierWithWaitListKHR(commandBuffer, nullptr, 0, nullptr, nullptr, &mutableHandle));
+
+    cl_sync_point_khr syncPoint = 0u;
+    EXPECT_EQ(CL_INVALID_SYNC_POINT_WAIT_LIST_KHR, clCommandBarrierWithWaitListKHR(commandBuffer, nullptr, 1, nullptr, nullptr, nullptr));
+    syncPoint = 1u;
+    EXPECT_EQ(CL_INVALID_SYNC_POINT_WAIT_LIST_KHR, clCommandBarrierWithWaitListKHR(commandBuffer, nullptr, 1, &syncPoint, nullptr, nullptr));
+
+    EXPECT_EQ(CL_INVALID_MEM_OBJECT, clCommandCopyBufferKHR(commandBuffer, nullptr, nullptr, buffer, 0, 0, 4, 0, nullptr, nullptr, nullptr));
+    EXPECT_EQ(CL_INVALID_VALUE, clCommandCopyBufferKHR(commandBuffer, nullptr, buffer, buffer, 32, 0, 64, 0, nullptr, nullptr, nullptr));
+
+    uint32_t pattern = 0u;
+    EXPECT_EQ(CL_INVALID_VALUE, clCommandFillBufferKHR(commandBuffer, nullptr, buffer, &pattern, 3, 0, 12, 0, nullptr, nullptr, nullptr));
+    EXPECT_EQ(CL_INVALID_VALUE, clCommandFillBufferKHR(commandBuffer, nullptr, buffer, &pattern, sizeof(pattern), 2, 8, 0, nullptr, nullptr, nullptr));
+
+    size_t globalWorkSize[3] = {1, 1, 1};
+    EXPECT_EQ(CL_INVALID_KERNEL, clCommandNDRangeKernelKHR(commandBuffer, nullptr, nullptr, nullptr, 1, nullptr, globalWorkSize, nullptr, 0, nullptr, nullptr, nullptr));
+    EXPECT_EQ(CL_INVALID_WORK_DIMENSION, clCommandNDRangeKernelKHR(commandBuffer, nullptr, nullptr, pMultiDeviceKernel, 4, nullptr, globalWorkSize, nullptr, 0, nullptr, nullptr, nullptr));
+
+    EXPECT_EQ(0u, castToObject<ClCommandBuffer>(commandBuffer)->getNumCommands());
+    EXPECT_EQ(CL_SUCCESS, clReleaseCommandBufferKHR(commandBuffer));
+}
+
+TEST_F(clCommandBufferKHRTests, GivenFinalizedCommandBufferWhenRecordingOrFinalizingAgainThenInvalidOperationIsReturned) {
+    auto commandBuffer = clCreateCommandBufferKHR(1, &commandQueue, nullptr, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    EXPECT_EQ(CL_INVALID_OPERATION, clEnqueueCommandBufferKHR(0, nullptr, commandBuffer, 0, nullptr, nullptr));
+    EXPECT_EQ(CL_SUCCESS, clFinalizeCommandBufferKHR(commandBuffer));
+    EXPECT_EQ(CL_INVALID_OPERATION, clFinalizeCommandBufferKHR(commandBuffer));
+    EXPECT_EQ(CL_INVALID_OPERATION, clCommandBarrierWithWaitListKHR(commandBuffer, nullptr, 0, nullptr, nullptr, nullptr));
+
+    cl_command_buffer_state_khr state = CL_COMMAND_BUFFER_STATE_INVALID_KHR;
+    EXPECT_EQ(CL_SUCCESS, clGetCommandBufferInfoKHR(commandBuffer, CL_COMMAND_BUFFER_STATE_KHR, sizeof(state), &state, nullptr));
+    EXPECT_EQ(static_cast<cl_command_buffer_state_khr>(CL_COMMAND_BUFFER_STATE_EXECUTABLE_KHR), state);
+
+    EXPECT_EQ(CL_SUCCESS, clReleaseCommandBufferKHR(commandBuffer));
+}
+
+TEST_F(clCommandBufferKHRTests, GivenRecordedCommandsWhenEnqueueingCommandBufferThenEachCommandIsReplayedAndQueueIsFlushedOnce) {
+    auto replayQueue = new CommandBufferReplayCommandQueue(pContext, pDevice, nullptr, false);
+    cl_command_queue queue = replayQueue;
+    auto commandBuffer = clCreateCommandBufferKHR(1, &queue, nullptr, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    uint32_t pattern = 0xABCDu;
+    cl_sync_point_khr fillSyncPoint = 0u;
+    cl_sync_point_khr copySyncPoint = 0u;
+    EXPECT_EQ(CL_SUCCESS, clCommandFillBufferKHR(commandBuffer, nullptr, buffer, &pattern, sizeof(pattern), 0, 32, 0, nullptr, &fillSyncPoint, nullptr));
+    pattern = 0u;
+    EXPECT_EQ(CL_SUCCESS, clCommandCopyBufferKHR(commandBuffer, nullptr, buffer, buffer, 0, 32, 32, 1, &fillSyncPoint, &copySyncPoint, nullptr));
+    EXPECT_EQ(CL_SUCCESS, clCommandBarrierWithWaitListKHR(commandBuffer, nullptr, 1, &copySyncPoint, nullptr, nullptr));
+    EXPECT_EQ(1u, fillSyncPoint);
+    EXPECT_EQ(2u, copySyncPoint);
+    EXPECT_EQ(CL_SUCCESS, clFinalizeCommandBufferKHR(commandBuffer));
+
+    cl_command_queue otherQueue = commandQueue;
+    EXPECT_EQ(CL_INCOMPATIBLE_COMMAND_QUEUE_KHR, clEnqueueCommandBufferKHR(1, &otherQueue, commandBuffer, 0, nullptr, nullptr));
+
+    constexpr uint32_t numEnqueues = 3u;
+    for (uint32_t i = 0; i < numEnqueues; i++) {
+        EXPECT_EQ(CL_SUCCESS, clEnqueueCommandBufferKHR(0, nullptr, commandBuffer, 0, nullptr, nullptr));
+    }
+    EXPECT_EQ(CL_SUCCESS, clEnqueueCommandBufferKHR(1, &queue, commandBuffer, 0, nullptr, nullptr));
+
+    EXPECT_EQ(numEnqueues + 1, replayQueue->enqueueFillBufferCalled);
+    EXPECT_EQ(numEnqueues + 1, replayQueue->enqueueCopyBufferCalled);
+    EXPECT_EQ(numEnqueues + 1, replayQueue->enqueueBarrierCalled);
+    EXPECT_EQ(numEnqueues + 1, replayQueue->flushCalled);
+    EXPECT_EQ(0xABCDu, replayQueue->lastFillPattern);
+
+    EXPECT_EQ(CL_SUCCESS, clReleaseCommandBufferKHR(commandBuffer));
+    replayQueue->release();
+}
+
+TEST_F(clCommandBufferKHRTests, GivenReplayedCommandFailingWhenEnqueueingCommandBufferThenErrorIsReturnedAfterPartialSubmissionIsFlushedAndTracked) {
+    auto replayQueue = new CommandBufferReplayCommandQueue(pContext, pDevice, nullptr, false);
+    replayQueue->enqueueCopyBufferRetVal = CL_OUT_OF_RESOURCES;
+    replayQueue->createMarkerEvents = true;
+    cl_command_queue queue = replayQueue;
+    auto commandBuffer = clCreateCommandBufferKHR(1, &queue, nullptr, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    uint32_t pattern = 0xABCDu;
+    EXPECT_EQ(CL_SUCCESS, clCommandFillBufferKHR(commandBuffer, nullptr, buffer, &pattern, sizeof(pattern), 0, 32, 0, nullptr, nullptr, nullptr));
+    EXPECT_EQ(CL_SUCCESS, clCommandCopyBufferKHR(commandBuffer, nullptr, buffer, buffer, 0, 32, 32, 0, nullptr, nullptr, nullptr));
+    EXPECT_EQ(CL_SUCCESS, clCommandBarrierWithWaitListKHR(commandBuffer, nullptr, 0, nullptr, nullptr, nullptr));
+    EXPECT_EQ(CL_SUCCESS, clFinalizeCommandBufferKHR(commandBuffer));
+
+    cl_event event = nullptr;
+    EXPECT_EQ(CL_OUT_OF_RESOURCES, clEnqueueCommandBufferKHR(0, nullptr, commandBuffer, 0, nullptr, &event));
+    EXPECT_EQ(nullptr, event);
+    EXPECT_EQ(1u, replayQueue->enqueueFillBufferCalled);
+    EXPECT_EQ(1u, replayQueue->enqueueCopyBufferCalled);
+    EXPECT_EQ(0u, replayQueue->enqueueBarrierCalled);
+    EXPECT_EQ(1u, replayQueue->enqueueMarkerCalled);
+    EXPECT_EQ(1u, replayQueue->flushCalled);
+
+    cl_command_buffer_state_khr state = 0u;
+    EXPECT_EQ(CL_SUCCESS, clGetCommandBufferInfoKHR(commandBuffer, CL_COMMAND_BUFFER_STATE_KHR, sizeof(state), &state, nullptr));
+    EXPECT_EQ(static_cast<cl_command_buffer_state_khr>(CL_COMMAND_BUFFER_STATE_PENDING_KHR), state);
+    EXPECT_EQ(CL_INVALID_OPERATION, clEnqueueCommandBufferKHR(0, nullptr, commandBuffer, 0, nullptr, nullptr));
+
+    replayQueue->lastMarkerEvent->setStatus(CL_COMPLETE);
+    EXPECT_EQ(CL_SUCCESS, clReleaseCommandBufferKHR(commandBuffer));
+    replayQueue->release();
+}
+
+TEST_F(clCommandBufferKHRTests, GivenQueueNotProducingRecordedCommandsWhenFinalizingCommandBufferThenRecordedEnqueuesAreReplayed) {
+    auto replayQueue = new CommandBufferReplayCommandQueue(pContext, pDevice, nullptr, false);
+    cl_command_queue queue = replayQueue;
+    auto commandBuffer = clCreateCommandBufferKHR(1, &queue, nullptr, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    uint32_t pattern = 0xABCDu;
+    EXPECT_EQ(CL_SUCCESS, clCommandFillBufferKHR(commandBuffer, nullptr, buffer, &pattern, sizeof(pattern), 0, 32, 0, nullptr, nullptr, nullptr));
+    EXPECT_EQ(CL_SUCCESS, clFinalizeCommandBufferKHR(commandBuffer));
+
+    EXPECT_EQ(0u, castToObject<ClCommandBuffer>(commandBuffer)->getNumEncodedCommands());
+    EXPECT_FALSE(replayQueue->isRecordingCommands());
+    EXPECT_EQ(0u, replayQueue->enqueueFillBufferCalled);
+
+    EXPECT_EQ(CL_SUCCESS, clEnqueueCommandBufferKHR(0, nullptr, commandBuffer, 0, nullptr, nullptr));
+    EXPECT_EQ(1u, replayQueue->enqueueFillBufferCalled);
+
+    EXPECT_EQ(CL_SUCCESS, clReleaseCommandBufferKHR(commandBuffer));
+    replayQueue->release();
+}
+
+HWTEST_F(clCommandBufferKHRTests, GivenKernelCommandsRecordedOnHwQueueWhenEnqueueingCommandBufferThenEncodedStreamIsSubmittedOnEveryEnqueue) {
+    auto &ultCsr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    ultCsr.timestampPacketWriteEnabled = false;
+
+    auto hwQueue = new MockCommandQueueHw<FamilyType>(pContext, pDevice, nullptr);
+    cl_command_queue queue = hwQueue;
+    auto commandBuffer = clCreateCommandBufferKHR(1, &queue, nullptr, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    uint32_t pattern = 0xABCDu;
+    EXPECT_EQ(CL_SUCCESS, clCommandFillBufferKHR(commandBuffer, nullptr, buffer, &pattern, sizeof(pattern), 0, 32, 0, nullptr, nullptr, nullptr));
+    EXPECT_EQ(CL_SUCCESS, clCommandBarrierWithWaitListKHR(commandBuffer, nullptr, 0, nullptr, nullptr, nullptr));
+
+    auto taskLevel = hwQueue->taskLevel;
+    auto taskCount = hwQueue->taskCount;
+    EXPECT_EQ(CL_SUCCESS, clFinalizeCommandBufferKHR(commandBuffer));
+
+    EXPECT_EQ(1u, castToObject<ClCommandBuffer>(commandBuffer)->getNumEncodedCommands());
+    EXPECT_FALSE(hwQueue->isRecordingCommands());
+    EXPECT_EQ(nullptr, hwQueue->virtualEvent);
+    EXPECT_EQ(taskLevel, hwQueue->taskLevel);
+    EXPECT_EQ(taskCount, hwQueue->taskCount);
+
+    EXPECT_EQ(CL_SUCCESS, clEnqueueCommandBufferKHR(0, nullptr, commandBuffer, 0, nullptr, nullptr));
+    auto encodedStream = ultCsr.lastFlushedCommandStream;
+    ASSERT_NE(nullptr, encodedStream);
+    auto encodedStreamUsed = encodedStream->getUsed();
+    EXPECT_EQ(taskCount + 1, hwQueue->taskCount);
+
+    *ultCsr.getTagAddress() = hwQueue->taskCount;
+    ultCsr.lastFlushedCommandStream = nullptr;
+    EXPECT_EQ(CL_SUCCESS, clEnqueueCommandBufferKHR(0, nullptr, commandBuffer, 0, nullptr, nullptr));
+    EXPECT_EQ(encodedStream, ultCsr.lastFlushedCommandStream);
+    EXPECT_EQ(encodedStreamUsed, encodedStream->getUsed());
+    EXPECT_EQ(taskCount + 2, hwQueue->taskCount);
+
+    *ultCsr.getTagAddress() = hwQueue->taskCount;
+    EXPECT_EQ(CL_SUCCESS, clReleaseCommandBufferKHR(commandBuffer));
+    hwQueue->release();
+}
+
+TEST_F(clCommandBufferKHRTests, GivenCommandBufferExtensionDisabledWhenQueryingDeviceCommandBufferInfoThenInvalidValueIsReturned) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ExperimentalEnableClCommandBuffer.set(0);
+    auto device = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get()));
+    EXPECT_EQ(std::string::npos, std::string(device->getDeviceInfo().deviceExtensions).find("cl_khr_command_buffer "));
+
+    cl_device_command_buffer_capabilities_khr capabilities = 0u;
+    retVal = device->getDeviceInfo(CL_DEVICE_COMMAND_BUFFER_CAPABILITIES_KHR, sizeof(capabilities), &capabilities, nullptr);
+    EXPECT_EQ(CL_INVALID_VALUE, retVal);
+
+    cl_command_queue_properties requiredProperties = 0u;
+    retVal = device->getDeviceInfo(CL_DEVICE_COMMAND_BUFFER_REQUIRED_QUEUE_PROPERTIES_KHR, sizeof(requiredProperties), &requiredProperties, nullptr);
+    EXPECT_EQ(CL_INVALID_VALUE, retVal);
+}
+
+TEST_F(clCommandBufferKHRTests, GivenCommandBufferExtensionEnabledWhenQueryingDeviceThenExtensionAndCapabilitiesAreReported) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ExperimentalEnableClCommandBuffer.set(1);
+    auto device = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get()));
+    EXPECT_NE(std::string::npos, std::string(device->getDeviceInfo().deviceExtensions).find("cl_khr_command_buffer "));
+
+    cl_device_command_buffer_capabilities_khr capabilities = 0u;
+    retVal = device->getDeviceInfo(CL_DEVICE_COMMAND_BUFFER_CAPABILITIES_KHR, sizeof(capabilities), &capabilities, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(static_cast<cl_device_command_buffer_capabilities_khr>(CL_COMMAND_BUFFER_CAPABILITY_SIMULTANEOUS_USE_KHR), capabilities);
+
+    cl_command_queue_properties requiredProperties = CL_QUEUE_PROFILING_ENABLE;
+    retVal = device->getDeviceInfo(CL_DEVICE_COMMAND_BUFFER_REQUIRED_QUEUE_PROPERTIES_KHR, sizeof(requiredProperties), &requiredProperties, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(0u, requiredProperties);
+}
+
+} // namespace ULT
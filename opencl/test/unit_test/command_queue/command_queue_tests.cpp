@@ -411,6 +411,43 @@ struct CommandQueueCommandStreamTest : public CommandQueueMemoryDevice,
     std::unique_ptr<MockContext> context;
 };
 
+HWTEST_F(CommandQueueCommandStreamTest, givenInOrderQueueWithoutDependenciesWhenObtainingTaskLevelThenBlockedStatusIsNotQueriedAndTaskLevelIsIncremented) {
+    MockCommandQueueHw<FamilyType> cmdQ(context.get(), pClDevice, nullptr);
+    cmdQ.setQueueBlocked = 1;
+    cmdQ.taskLevel = 5u;
+
+    TakeOwnershipWrapper<CommandQueue> queueOwnership(cmdQ);
+    TaskCountType taskLevel = 0u;
+    cl_uint numEventsInWaitList = 0u;
+    const cl_event *eventWaitList = nullptr;
+    bool blockQueue = true;
+    cmdQ.obtainTaskLevelAndBlockedStatus(taskLevel, numEventsInWaitList, eventWaitList, blockQueue, CL_COMMAND_NDRANGE_KERNEL);
+
+    EXPECT_FALSE(blockQueue);
+    EXPECT_EQ(6u, taskLevel);
+    EXPECT_EQ(6u, cmdQ.taskLevel);
+
+    cmdQ.obtainTaskLevelAndBlockedStatus(taskLevel, numEventsInWaitList, eventWaitList, blockQueue, CL_COMMAND_MARKER);
+    EXPECT_FALSE(blockQueue);
+    EXPECT_EQ(6u, taskLevel);
+    EXPECT_EQ(6u, cmdQ.taskLevel);
+}
+
+HWTEST_F(CommandQueueCommandStreamTest, givenOutOfOrderQueueWithoutDependenciesWhenObtainingTaskLevelThenBlockedStatusIsQueried) {
+    MockCommandQueueHw<FamilyType> cmdQ(context.get(), pClDevice, nullptr);
+    cmdQ.setOoqEnabled();
+    cmdQ.setQueueBlocked = 1;
+
+    TakeOwnershipWrapper<CommandQueue> queueOwnership(cmdQ);
+    TaskCountType taskLevel = 0u;
+    cl_uint numEventsInWaitList = 0u;
+    const cl_event *eventWaitList = nullptr;
+    bool blockQueue = false;
+    cmdQ.obtainTaskLevelAndBlockedStatus(taskLevel, numEventsInWaitList, eventWaitList, blockQueue, CL_COMMAND_NDRANGE_KERNEL);
+
+    EXPECT_TRUE(blockQueue);
+}
+
 HWTEST_F(CommandQueueCommandStreamTest, givenCommandQueueThatWaitsOnAbortedUserEventWhenIsQueueBlockedIsCalledThenTaskLevelAlignsToCsr) {
     MockContext context;
     auto mockDevice = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
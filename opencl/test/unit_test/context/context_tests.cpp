@@ -400,6 +400,25 @@ TEST(Context, givenContextWithMultipleSubDevicesWhenGettingDeviceBitfieldForAllo
     context->release();
 }
 
+TEST(ContextTest, givenMemObjReleaseQueueSizeSetWhenContextIsCreatedThenAllocationsReleaseQueueIsCreated) {
+    DebugManagerStateRestore restorer;
+    UltClDeviceFactory deviceFactory{1, 0};
+    cl_int retVal;
+    cl_device_id devices[]{deviceFactory.rootDevices[0]};
+    ClDeviceVector deviceVector(devices, 1);
+
+    auto context = Context::create<Context>(0, deviceVector, nullptr, nullptr, retVal);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(nullptr, context->getAllocationsReleaseQueue());
+    context->release();
+
+    DebugManager.flags.ExperimentalMemObjReleaseQueueSize.set(MemoryConstants::megaByte);
+    context = Context::create<Context>(0, deviceVector, nullptr, nullptr, retVal);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_NE(nullptr, context->getAllocationsReleaseQueue());
+    context->release();
+}
+
 TEST(MultiDeviceContextTest, givenContextWithTwoDifferentSubDevicesFromDifferentRootDevicesWhenGettingDeviceBitfieldForAllocationThenSeparatedDeviceBitfieldsAreReturned) {
     DebugManagerStateRestore restorer;
 
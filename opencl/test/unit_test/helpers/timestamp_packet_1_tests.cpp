@@ -137,6 +137,55 @@ HWTEST_F(TimestampPacketTests, givenCrossCsrDependenciesWhenFillCsrDepsThenFlush
     *mockCmdQ2->getUltCommandStreamReceiver().tagAddress = 1;
 }
 
+HWTEST_F(TimestampPacketTests, givenGroupedCsrDependenciesWhenFillingCsrDepsWithEventsFromInOrderQueueThenOnlyLatestEventIsAdded) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ExperimentalGroupCsrDependencies.set(1);
+
+    auto mockCmdQHw = std::make_unique<MockCommandQueueHw<FamilyType>>(context, device.get(), nullptr);
+    MockTimestampPacketContainer timestamp1(*device->getGpgpuCommandStreamReceiver().getTimestampPacketAllocator(), 1);
+    MockTimestampPacketContainer timestamp2(*device->getGpgpuCommandStreamReceiver().getTimestampPacketAllocator(), 1);
+    MockTimestampPacketContainer timestamp3(*device->getGpgpuCommandStreamReceiver().getTimestampPacketAllocator(), 1);
+
+    Event event1(mockCmdQHw.get(), 0, 0, 1);
+    event1.addTimestampPacketNodes(timestamp1);
+    Event event2(mockCmdQHw.get(), 0, 0, 3);
+    event2.addTimestampPacketNodes(timestamp2);
+    Event event3(mockCmdQHw.get(), 0, 0, 2);
+    event3.addTimestampPacketNodes(timestamp3);
+
+    cl_event waitlist[] = {&event1, &event2, &event3};
+    EventsRequest eventsRequest(3, waitlist, nullptr);
+    CsrDependencies csrDeps;
+    eventsRequest.fillCsrDependenciesForTimestampPacketContainer(csrDeps, device->getGpgpuCommandStreamReceiver(), CsrDependencies::DependenciesType::All);
+
+    ASSERT_EQ(1u, csrDeps.timestampPacketContainer.size());
+    EXPECT_EQ(event2.getTimestampPacketNodes(), csrDeps.timestampPacketContainer[0]);
+}
+
+HWTEST_F(TimestampPacketTests, givenGroupedCsrDependenciesWhenFillingCsrDepsWithEventsFromOutOfOrderQueueThenEachDistinctEventIsAdded) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ExperimentalGroupCsrDependencies.set(1);
+
+    auto mockCmdQHw = std::make_unique<MockCommandQueueHw<FamilyType>>(context, device.get(), nullptr);
+    mockCmdQHw->setOoqEnabled();
+    MockTimestampPacketContainer timestamp1(*device->getGpgpuCommandStreamReceiver().getTimestampPacketAllocator(), 1);
+    MockTimestampPacketContainer timestamp2(*device->getGpgpuCommandStreamReceiver().getTimestampPacketAllocator(), 1);
+
+    Event event1(mockCmdQHw.get(), 0, 0, 1);
+    event1.addTimestampPacketNodes(timestamp1);
+    Event event2(mockCmdQHw.get(), 0, 0, 2);
+    event2.addTimestampPacketNodes(timestamp2);
+
+    cl_event waitlist[] = {&event1, &event2, &event1};
+    EventsRequest eventsRequest(3, waitlist, nullptr);
+    CsrDependencies csrDeps;
+    eventsRequest.fillCsrDependenciesForTimestampPacketContainer(csrDeps, device->getGpgpuCommandStreamReceiver(), CsrDependencies::DependenciesType::All);
+
+    ASSERT_EQ(2u, csrDeps.timestampPacketContainer.size());
+    EXPECT_EQ(event1.getTimestampPacketNodes(), csrDeps.timestampPacketContainer[0]);
+    EXPECT_EQ(event2.getTimestampPacketNodes(), csrDeps.timestampPacketContainer[1]);
+}
+
 HWTEST_F(TimestampPacketTests, givenTimestampPacketWriteEnabledWhenEstimatingStreamSizeWithWaitlistThenAddSizeForSemaphores) {
     MockKernelWithInternals kernel2(*device);
     MockMultiDispatchInfo multiDispatchInfo(device.get(), std::vector<Kernel *>({kernel->mockKernel, kernel2.mockKernel}));
@@ -55,6 +55,56 @@ TEST_F(KernelArgBufferTest, GivenValidBufferWhenSettingKernelArgThenBufferAddres
     delete buffer;
 }
 
+TEST_F(KernelArgBufferTest, GivenSameBufferWhenSettingKernelArgAgainThenPatchedArgIsReused) {
+    MockBuffer buffer;
+    auto val = static_cast<cl_mem>(&buffer);
+
+    EXPECT_EQ(CL_SUCCESS, pKernel->setArg(0, sizeof(cl_mem *), &val));
+    EXPECT_EQ(buffer.getMemObjId(), pKernel->getKernelArgInfo(0).patchedMemObjId);
+
+    auto pKernelArg = reinterpret_cast<void **>(pKernel->getCrossThreadData() + pKernelInfo->argAsPtr(0).stateless);
+    *pKernelArg = nullptr;
+    EXPECT_EQ(CL_SUCCESS, pKernel->setArg(0, sizeof(cl_mem *), &val));
+    EXPECT_EQ(nullptr, *pKernelArg);
+
+    pKernel->unsetArg(0);
+    EXPECT_EQ(CL_SUCCESS, pKernel->setArg(0, sizeof(cl_mem *), &val));
+    EXPECT_EQ(buffer.getCpuAddress(), *pKernelArg);
+}
+
+TEST_F(KernelArgBufferTest, GivenBufferArgOverwrittenBySvmWhenSettingSameBufferAgainThenArgIsPatched) {
+    MockBuffer buffer;
+    auto val = static_cast<cl_mem>(&buffer);
+    EXPECT_EQ(CL_SUCCESS, pKernel->setArg(0, sizeof(cl_mem *), &val));
+
+    char svmPtr[16] = {};
+    EXPECT_EQ(CL_SUCCESS, pKernel->setArgSvmAlloc(0, svmPtr, nullptr, 0u));
+    EXPECT_EQ(0u, pKernel->getKernelArgInfo(0).patchedMemObjId);
+
+    EXPECT_EQ(CL_SUCCESS, pKernel->setArg(0, sizeof(cl_mem *), &val));
+    auto pKernelArg = reinterpret_cast<void **>(pKernel->getCrossThreadData() + pKernelInfo->argAsPtr(0).stateless);
+    EXPECT_EQ(buffer.getCpuAddress(), *pKernelArg);
+}
+
+TEST_F(KernelArgBufferTest, GivenDifferentBuffersWhenCheckingIfPatchedArgIsUpToDateThenOnlyLastPatchedBufferMatches) {
+    MockBuffer buffer1;
+    MockBuffer buffer2;
+    EXPECT_NE(buffer1.getMemObjId(), buffer2.getMemObjId());
+
+    auto val = static_cast<cl_mem>(&buffer1);
+    EXPECT_EQ(CL_SUCCESS, pKernel->setArg(0, sizeof(cl_mem *), &val));
+    EXPECT_TRUE(pKernel->isBufferArgPatchUpToDate(0, buffer1));
+    EXPECT_FALSE(pKernel->isBufferArgPatchUpToDate(0, buffer2));
+
+    val = static_cast<cl_mem>(&buffer2);
+    EXPECT_EQ(CL_SUCCESS, pKernel->setArg(0, sizeof(cl_mem *), &val));
+    EXPECT_FALSE(pKernel->isBufferArgPatchUpToDate(0, buffer1));
+    EXPECT_TRUE(pKernel->isBufferArgPatchUpToDate(0, buffer2));
+
+    auto pKernelArg = reinterpret_cast<void **>(pKernel->getCrossThreadData() + pKernelInfo->argAsPtr(0).stateless);
+    EXPECT_EQ(buffer2.getCpuAddress(), *pKernelArg);
+}
+
 struct MultiDeviceKernelArgBufferTest : public ::testing::Test {
 
     void SetUp() override {
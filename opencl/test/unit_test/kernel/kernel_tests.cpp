@@ -24,6 +24,7 @@
 #include "shared/test/common/helpers/gtest_helpers.h"
 #include "shared/test/common/libult/ult_command_stream_receiver.h"
 #include "shared/test/common/mocks/mock_allocation_properties.h"
+#include "shared/test/common/mocks/mock_compiler_cache.h"
 #include "shared/test/common/mocks/mock_cpu_page_fault_manager.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
 #include "shared/test/common/mocks/mock_memory_manager.h"
@@ -35,6 +36,7 @@
 #include "opencl/source/helpers/cl_gfx_core_helper.h"
 #include "opencl/source/helpers/cl_memory_properties_helpers.h"
 #include "opencl/source/kernel/kernel.h"
+#include "opencl/source/kernel/local_work_size_tuner.h"
 #include "opencl/source/mem_obj/image.h"
 #include "opencl/test/unit_test/fixtures/cl_device_fixture.h"
 #include "opencl/test/unit_test/fixtures/multi_root_device_fixture.h"
@@ -2040,6 +2042,127 @@ HWTEST_F(KernelResidencyTest, givenEnableFullKernelTuningWhenPerformTunningThenK
     EXPECT_EQ(result->second.singleSubdevicePreferred, mockKernel.mockKernel->singleSubdevicePreferredInCurrentEnqueue);
 }
 
+class MockLocalWorkSizeTuner : public LocalWorkSizeTuner {
+  public:
+    using LocalWorkSizeTuner::cache;
+    using LocalWorkSizeTuner::LocalWorkSizeTuner;
+    using LocalWorkSizeTuner::tuningStates;
+};
+
+TEST_F(KernelResidencyTest, givenLocalWorkSizeTuningWhenKernelIsInitializedThenTunerIsCreatedOnlyWhenEnabled) {
+    DebugManagerStateRestore restorer;
+    {
+        MockKernelWithInternals mockKernel(*this->pClDevice);
+        EXPECT_EQ(nullptr, mockKernel.mockKernel->localWorkSizeTuner.get());
+        EXPECT_EQ(Vec3<size_t>(0, 0, 0), mockKernel.mockKernel->getTunedLocalWorkSize(1, {256, 1, 1}));
+    }
+
+    DebugManager.flags.ExperimentalLocalWorkSizeTuning.set(2);
+    MockKernelWithInternals mockKernel(*this->pClDevice);
+    EXPECT_NE(nullptr, mockKernel.mockKernel->localWorkSizeTuner.get());
+}
+
+HWTEST_F(KernelResidencyTest, givenLocalWorkSizeTunerWhenAllCandidatesAreMeasuredThenFastestLocalWorkSizeIsReturnedAndCached) {
+    using TimestampPacketType = typename FamilyType::TimestampPacketType;
+
+    auto &commandStreamReceiver = this->pDevice->getUltCommandStreamReceiver<FamilyType>();
+    MockKernelWithInternals mockKernel(*this->pClDevice);
+    mockKernel.mockKernel->maxKernelWorkGroupSize = 128;
+
+    MockLocalWorkSizeTuner tuner(*mockKernel.mockKernel, *this->pClDevice, 1u);
+    auto cache = new CompilerCacheMock();
+    cache->cacheResult = true;
+    tuner.cache.reset(cache);
+
+    Vec3<size_t> gws{256, 1, 1};
+    std::vector<std::unique_ptr<MockTimestampPacketContainer>> containers;
+    std::vector<Vec3<size_t>> launchedLws;
+
+    auto lws = tuner.getLocalWorkSize(1, gws);
+    while (lws.x != 0) {
+        EXPECT_EQ(0u, gws.x % lws.x);
+        containers.push_back(std::make_unique<MockTimestampPacketContainer>(*commandStreamReceiver.getTimestampPacketAllocator(), 1));
+        tuner.registerLaunch(gws, lws, *containers.back());
+        launchedLws.push_back(lws);
+        lws = tuner.getLocalWorkSize(1, gws);
+    }
+    ASSERT_LT(1u, launchedLws.size());
+    EXPECT_GE(LocalWorkSizeTuner::maxCandidates, launchedLws.size());
+    EXPECT_EQ(1u, tuner.tuningStates.size());
+    EXPECT_EQ(0u, cache->cacheInvoked);
+
+    for (auto i = 0u; i < containers.size(); i++) {
+        auto duration = static_cast<TimestampPacketType>(100 - i);
+        TimestampPacketType data[4] = {0, 0, duration, duration};
+        containers[i]->getNode(0u)->assignDataToAllTimestamps(0, data);
+    }
+
+    EXPECT_EQ(launchedLws.back(), tuner.getLocalWorkSize(1, gws));
+    EXPECT_EQ(1u, cache->cacheInvoked);
+
+    tuner.registerLaunch(gws, launchedLws[0], *containers[0]);
+    EXPECT_EQ(launchedLws.back(), tuner.getLocalWorkSize(1, gws));
+}
+
+HWTEST_F(KernelResidencyTest, givenLocalWorkSizeTunerWhenLaunchIsRegisteredWithZeroUnusedDimensionsThenItIsAccountedToEnqueuedGeometry) {
+    auto &commandStreamReceiver = this->pDevice->getUltCommandStreamReceiver<FamilyType>();
+    MockKernelWithInternals mockKernel(*this->pClDevice);
+    mockKernel.mockKernel->maxKernelWorkGroupSize = 128;
+
+    MockLocalWorkSizeTuner tuner(*mockKernel.mockKernel, *this->pClDevice, 1u);
+    tuner.cache.reset();
+
+    auto lws = tuner.getLocalWorkSize(1, {256, 1, 1});
+    ASSERT_NE(0u, lws.x);
+    MockTimestampPacketContainer container(*commandStreamReceiver.getTimestampPacketAllocator(), 1);
+    tuner.registerLaunch({256, 0, 0}, lws, container);
+
+    ASSERT_EQ(1u, tuner.tuningStates.size());
+    EXPECT_EQ(1u, tuner.tuningStates.begin()->second.pendingLaunches.size());
+}
+
+HWTEST_F(KernelResidencyTest, givenLocalWorkSizeTunerWhenLaunchOfOtherGeometryHasFinishedThenItsTimestampNodesAreReleased) {
+    using TimestampPacketType = typename FamilyType::TimestampPacketType;
+
+    auto &commandStreamReceiver = this->pDevice->getUltCommandStreamReceiver<FamilyType>();
+    MockKernelWithInternals mockKernel(*this->pClDevice);
+    mockKernel.mockKernel->maxKernelWorkGroupSize = 128;
+
+    MockLocalWorkSizeTuner tuner(*mockKernel.mockKernel, *this->pClDevice, 1u);
+    tuner.cache.reset();
+
+    Vec3<size_t> gws{256, 1, 1};
+    auto lws = tuner.getLocalWorkSize(1, gws);
+    ASSERT_NE(0u, lws.x);
+    auto container = std::make_unique<MockTimestampPacketContainer>(*commandStreamReceiver.getTimestampPacketAllocator(), 1);
+    tuner.registerLaunch(gws, lws, *container);
+    TimestampPacketType data[4] = {0, 0, 10, 10};
+    container->getNode(0u)->assignDataToAllTimestamps(0, data);
+    auto node = container->getNode(0u);
+    container.reset();
+    EXPECT_EQ(1u, node->refCountFetchSub(0));
+
+    tuner.getLocalWorkSize(1, {512, 1, 1});
+    EXPECT_TRUE(tuner.tuningStates[std::make_tuple(size_t{256}, size_t{1}, size_t{1})].pendingLaunches.empty());
+    EXPECT_EQ(0u, node->refCountFetchSub(0));
+}
+
+TEST_F(KernelResidencyTest, givenLocalWorkSizeTunerWhenMaxTuningStatesAreTrackedThenNewGeometryUsesDefaultLocalWorkSize) {
+    MockKernelWithInternals mockKernel(*this->pClDevice);
+    mockKernel.mockKernel->maxKernelWorkGroupSize = 128;
+
+    MockLocalWorkSizeTuner tuner(*mockKernel.mockKernel, *this->pClDevice, 1u);
+    tuner.cache.reset();
+
+    for (size_t i = 1; i <= LocalWorkSizeTuner::maxTuningStates; i++) {
+        tuner.getLocalWorkSize(1, {256 * i, 1, 1});
+    }
+    EXPECT_EQ(LocalWorkSizeTuner::maxTuningStates, tuner.tuningStates.size());
+
+    EXPECT_EQ(Vec3<size_t>(0, 0, 0), tuner.getLocalWorkSize(1, {128, 1, 1}));
+    EXPECT_EQ(LocalWorkSizeTuner::maxTuningStates, tuner.tuningStates.size());
+}
+
 HWTEST_F(KernelResidencyTest, givenSimpleKernelTunningAndNoAtomicsWhenPerformTunningThenSingleSubdeviceIsPreferred) {
     DebugManagerStateRestore restorer;
     DebugManager.flags.EnableKernelTunning.set(1u);
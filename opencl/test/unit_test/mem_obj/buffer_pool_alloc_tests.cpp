@@ -273,6 +273,85 @@ TEST_F(AggregatedSmallBuffersEnabledTest, givenAggregatedSmallBuffersEnabledAndB
     EXPECT_EQ(size, poolAllocator->bufferPools[1].chunkAllocator->getUsedSize());
 }
 
+TEST_F(AggregatedSmallBuffersEnabledTest, givenAggregatedSmallBuffersEnabledAndPoolsExhaustedWhenDrainingThenPoolsAreRecycledRoundRobin) {
+    constexpr auto buffersToCreate = PoolAllocator::aggregatedSmallBuffersPoolSize / PoolAllocator::smallBufferThreshold;
+    std::vector<std::unique_ptr<Buffer>> buffers;
+    mockMemoryManager->deferAllocInUse = true;
+    for (auto i = 0u; i < 2 * buffersToCreate; i++) {
+        buffers.emplace_back(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+        EXPECT_EQ(retVal, CL_SUCCESS);
+    }
+    EXPECT_EQ(2u, poolAllocator->bufferPools.size());
+    EXPECT_EQ(0u, poolAllocator->drainCursors[0]);
+
+    mockMemoryManager->deferAllocInUse = false;
+    buffers.emplace_back(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+    EXPECT_EQ(retVal, CL_SUCCESS);
+    EXPECT_EQ(2u, poolAllocator->bufferPools.size());
+    EXPECT_EQ(1u, poolAllocator->drainCursors[0]);
+    EXPECT_EQ(size, poolAllocator->bufferPools[0].chunkAllocator->getUsedSize());
+    EXPECT_EQ(size * buffersToCreate, poolAllocator->bufferPools[1].chunkAllocator->getUsedSize());
+
+    for (auto i = 1u; i < buffersToCreate; i++) {
+        buffers.emplace_back(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+        EXPECT_EQ(retVal, CL_SUCCESS);
+    }
+    buffers.emplace_back(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+    EXPECT_EQ(retVal, CL_SUCCESS);
+    EXPECT_EQ(2u, poolAllocator->bufferPools.size());
+    EXPECT_EQ(2u, poolAllocator->drainCursors[0]);
+    EXPECT_EQ(size * buffersToCreate, poolAllocator->bufferPools[0].chunkAllocator->getUsedSize());
+    EXPECT_EQ(size, poolAllocator->bufferPools[1].chunkAllocator->getUsedSize());
+}
+
+TEST_F(AggregatedSmallBuffersEnabledTest, givenDefaultSizeClassesWhenBufferLargerThanSmallBufferThresholdIsCreatedThenDoNotUsePool) {
+    EXPECT_EQ(1u, poolAllocator->enabledSizeClasses);
+    size = 8 * KB;
+    std::unique_ptr<Buffer> buffer(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+    EXPECT_EQ(retVal, CL_SUCCESS);
+    EXPECT_NE(nullptr, buffer);
+    EXPECT_FALSE(poolAllocator->isPoolBuffer(buffer->getAssociatedMemObject()));
+    EXPECT_EQ(1u, poolAllocator->bufferPools.size());
+}
+
+class AggregatedSmallBuffersSizeClassesTest : public AggregatedSmallBuffersTestTemplate<1, false, false> {
+  public:
+    void SetUp() override {
+        DebugManager.flags.ExperimentalBufferPoolSizeClasses.set(3);
+        setUpImpl();
+    }
+};
+
+TEST_F(AggregatedSmallBuffersSizeClassesTest, givenAllSizeClassesEnabledWhenBuffersAreCreatedThenEachUsesPoolOfItsSizeClass) {
+    EXPECT_EQ(3u, poolAllocator->enabledSizeClasses);
+    EXPECT_EQ(1u, poolAllocator->bufferPools.size());
+
+    std::unique_ptr<Buffer> smallBuffer(Buffer::create(context.get(), flags, PoolAllocator::smallBufferThreshold, hostPtr, retVal));
+    EXPECT_EQ(retVal, CL_SUCCESS);
+    EXPECT_EQ(poolAllocator->bufferPools[0].mainStorage.get(), smallBuffer->getAssociatedMemObject());
+    EXPECT_EQ(1u, poolAllocator->bufferPools.size());
+
+    std::unique_ptr<Buffer> mediumBuffer(Buffer::create(context.get(), flags, 32 * KB, hostPtr, retVal));
+    EXPECT_EQ(retVal, CL_SUCCESS);
+    ASSERT_EQ(2u, poolAllocator->bufferPools.size());
+    EXPECT_EQ(1u, poolAllocator->bufferPools[1].sizeClass);
+    EXPECT_EQ(2 * MB, poolAllocator->bufferPools[1].mainStorage->getSize());
+    EXPECT_EQ(poolAllocator->bufferPools[1].mainStorage.get(), mediumBuffer->getAssociatedMemObject());
+    EXPECT_EQ(32 * KB, mediumBuffer->getSize());
+
+    std::unique_ptr<Buffer> largeBuffer(Buffer::create(context.get(), flags, 512 * KB, hostPtr, retVal));
+    EXPECT_EQ(retVal, CL_SUCCESS);
+    ASSERT_EQ(3u, poolAllocator->bufferPools.size());
+    EXPECT_EQ(2u, poolAllocator->bufferPools[2].sizeClass);
+    EXPECT_EQ(16 * MB, poolAllocator->bufferPools[2].mainStorage->getSize());
+    EXPECT_EQ(poolAllocator->bufferPools[2].mainStorage.get(), largeBuffer->getAssociatedMemObject());
+
+    std::unique_ptr<Buffer> hugeBuffer(Buffer::create(context.get(), flags, 2 * MB, hostPtr, retVal));
+    EXPECT_EQ(retVal, CL_SUCCESS);
+    EXPECT_EQ(nullptr, hugeBuffer->getAssociatedMemObject());
+    EXPECT_EQ(3u, poolAllocator->bufferPools.size());
+}
+
 TEST_F(AggregatedSmallBuffersEnabledTest, givenCopyHostPointerWhenCreatingBufferButCopyFailedThenDoNotUsePool) {
     class MockCommandQueueFailFirstEnqueueWrite : public MockCommandQueue {
       public:
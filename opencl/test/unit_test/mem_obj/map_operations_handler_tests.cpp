@@ -18,6 +18,7 @@ using namespace NEO;
 
 struct MockMapOperationsHandler : public MapOperationsHandler {
     using MapOperationsHandler::isOverlapping;
+    using MapOperationsHandler::mappedLengths;
     using MapOperationsHandler::mappedPointers;
 };
 
@@ -82,27 +83,27 @@ TEST_F(MapOperationsHandlerTests, givenMappedPtrsWhenDoubleRemovedThenDoNothing)
 TEST_F(MapOperationsHandlerTests, givenMapInfoWhenAddedThenSetReadOnlyFlag) {
     mapFlags = CL_MAP_READ;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
-    EXPECT_TRUE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_TRUE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_WRITE;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_WRITE_INVALIDATE_REGION;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_READ | CL_MAP_WRITE;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_READ | CL_MAP_WRITE_INVALIDATE_REGION;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 }
 
@@ -112,7 +113,7 @@ TEST_F(MapOperationsHandlerTests, givenNonReadOnlyOverlappingPtrWhenAddingThenRe
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
 
     EXPECT_EQ(1u, mockHandler.size());
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     EXPECT_TRUE(mockHandler.isOverlapping(mappedPtrs[0]));
     EXPECT_FALSE(mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get()));
     EXPECT_EQ(1u, mockHandler.size());
@@ -124,11 +125,11 @@ TEST_F(MapOperationsHandlerTests, givenReadOnlyOverlappingPtrWhenAddingThenRetur
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
 
     EXPECT_EQ(1u, mockHandler.size());
-    EXPECT_TRUE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_TRUE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     EXPECT_FALSE(mockHandler.isOverlapping(mappedPtrs[0]));
     EXPECT_TRUE(mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get()));
     EXPECT_EQ(2u, mockHandler.size());
-    EXPECT_TRUE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_TRUE(mockHandler.mappedPointers.rbegin()->second.readOnly);
 }
 
 const std::tuple<void *, size_t, void *, size_t, bool> overlappingCombinations[] = {
@@ -169,6 +170,35 @@ INSTANTIATE_TEST_CASE_P(MapOperationsHandlerOverlapTests,
                         MapOperationsHandlerOverlapTests,
                         ::testing::ValuesIn(overlappingCombinations));
 
+TEST(MapOperationsHandlerTest, givenLongMappedRegionStartingFarBeforeRequestedPtrWhenCheckingOverlapAndHostPtrThenRegionIsFound) {
+    MockMapOperationsHandler mockHandler;
+    MemObjSizeArray size = {{1, 1, 1}};
+    MemObjOffsetArray offset = {{0, 0, 0}};
+    cl_map_flags mapFlags = CL_MAP_READ;
+
+    EXPECT_TRUE(mockHandler.add(reinterpret_cast<void *>(0x1000), 0x10000, mapFlags, size, offset, 0, nullptr));
+    for (uintptr_t i = 0; i < 64; i++) {
+        EXPECT_TRUE(mockHandler.add(reinterpret_cast<void *>(0x2000 + i * 0x10), 0x10, mapFlags, size, offset, 0, nullptr));
+    }
+    EXPECT_EQ(65u, mockHandler.size());
+
+    MapInfo outMapInfo;
+    EXPECT_TRUE(mockHandler.findInfoForHostPtr(reinterpret_cast<void *>(0x8000), 0x100, outMapInfo));
+    EXPECT_EQ(reinterpret_cast<void *>(0x1000), outMapInfo.ptr);
+    EXPECT_TRUE(mockHandler.findInfoForHostPtr(reinterpret_cast<void *>(0x2010), 0x10, outMapInfo));
+    EXPECT_LE(outMapInfo.ptr, reinterpret_cast<void *>(0x2010));
+    EXPECT_FALSE(mockHandler.findInfoForHostPtr(reinterpret_cast<void *>(0x10ff0), 0x20, outMapInfo));
+
+    MapInfo writeMapInfo(reinterpret_cast<void *>(0x9000), 0x10, size, offset, 0);
+    EXPECT_TRUE(mockHandler.isOverlapping(writeMapInfo));
+
+    mockHandler.remove(reinterpret_cast<void *>(0x1000));
+    EXPECT_FALSE(mockHandler.isOverlapping(writeMapInfo));
+    EXPECT_FALSE(mockHandler.findInfoForHostPtr(reinterpret_cast<void *>(0x8000), 0x100, outMapInfo));
+    EXPECT_EQ(64u, mockHandler.mappedLengths.size());
+    EXPECT_EQ(0x10u, *mockHandler.mappedLengths.rbegin());
+}
+
 struct MapOperationsStorageWhitebox : MapOperationsStorage {
     using MapOperationsStorage::handlers;
 };
@@ -57,6 +57,8 @@ class MockContext : public Context {
       public:
         using BufferPoolAllocator::BufferPool;
         using BufferPoolAllocator::bufferPools;
+        using BufferPoolAllocator::drainCursors;
+        using BufferPoolAllocator::enabledSizeClasses;
         using BufferPoolAllocator::isAggregatedSmallBuffersEnabled;
     };
 
@@ -117,6 +117,7 @@ class MockKernel : public Kernel {
     using Kernel::kernelSvmGfxAllocations;
     using Kernel::kernelUnifiedMemoryGfxAllocations;
     using Kernel::localIdsCache;
+    using Kernel::localWorkSizeTuner;
     using Kernel::maxKernelWorkGroupSize;
     using Kernel::maxWorkGroupSizeForCrossThreadData;
     using Kernel::numberOfBindingTableStates;
@@ -18,8 +18,11 @@ namespace NEO {
 
 class MockMultiCommand : public MultiCommand {
   public:
+    using MultiCommand::allowCaching;
     using MultiCommand::argHelper;
+    using MultiCommand::cacheDir;
     using MultiCommand::lines;
+    using MultiCommand::numJobs;
     using MultiCommand::quiet;
     using MultiCommand::retValues;
 
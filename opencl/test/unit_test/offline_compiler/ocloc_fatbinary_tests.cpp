@@ -1446,6 +1446,52 @@ TEST_F(OclocFatBinaryTest, givenBitFlagsWhenBuildingFatbinaryThenFilesInArchiveH
     }
 }
 
+TEST_F(OclocFatBinaryTest, givenParallelJobsWhenBuildingFatbinaryThenArchiveIsSameAsForSequentialBuild) {
+    const auto devices = prepareTwoDevices(&mockArgHelper);
+    if (devices.empty()) {
+        GTEST_SKIP();
+    }
+    std::vector<std::string> args = {
+        "ocloc",
+        "-output",
+        outputArchiveName,
+        "-file",
+        spirvFilename,
+        "-output_no_suffix",
+        "-spirv_input",
+        "-device",
+        devices};
+
+    mockArgHelper.getPrinterRef() = MessagePrinter{true};
+    auto buildResult = buildFatBinary(args, &mockArgHelper);
+    ASSERT_EQ(OclocErrorCode::SUCCESS, buildResult);
+    ASSERT_EQ(1u, mockArgHelper.interceptedFiles.count(outputArchiveName));
+    const auto sequentialArchive = mockArgHelper.interceptedFiles[outputArchiveName];
+    mockArgHelper.interceptedFiles.clear();
+
+    args.push_back("-j");
+    args.push_back("2");
+    buildResult = buildFatBinary(args, &mockArgHelper);
+    ASSERT_EQ(OclocErrorCode::SUCCESS, buildResult);
+    ASSERT_EQ(1u, mockArgHelper.interceptedFiles.count(outputArchiveName));
+
+    EXPECT_EQ(sequentialArchive, mockArgHelper.interceptedFiles[outputArchiveName]);
+}
+
+TEST_F(OclocFatBinaryTest, givenInvalidNumberOfParallelJobsWhenBuildingFatbinaryThenErrorIsReported) {
+    const std::array<std::vector<std::string>, 2> argsToTest = {{{"ocloc", "-device", "dg1,acm-g10", "-j", "0"},
+                                                                 {"ocloc", "-device", "dg1,acm-g10", "-j"}}};
+
+    for (const auto &args : argsToTest) {
+        ::testing::internal::CaptureStdout();
+        const auto result = buildFatBinary(args, &mockArgHelper);
+        const auto output{::testing::internal::GetCapturedStdout()};
+
+        EXPECT_EQ(OclocErrorCode::INVALID_COMMAND_LINE, result);
+        EXPECT_EQ("Error! Invalid number of parallel jobs for -j option.\n", output);
+    }
+}
+
 TEST_F(OclocFatBinaryTest, givenOutputDirectoryFlagWhenBuildingFatbinaryThenArchiveIsStoredInThatDirectory) {
     const auto devices = prepareTwoDevices(&mockArgHelper);
     if (devices.empty()) {
@@ -321,6 +321,95 @@ TEST_F(MultiCommandTests, GivenOutputFileListFlagWhenBuildingMultiCommandThenSuc
     delete pMultiCommand;
 }
 
+TEST_F(MultiCommandTests, GivenParallelJobsWhenBuildingMultiCommandThenAllBuildsSucceedAndOutputFileListKeepsCommandOrder) {
+    nameOfFileWithArgs = "ImAMulitiComandMinimalGoodFile.txt";
+    std::vector<std::string> argv = {
+        "ocloc",
+        "multi",
+        nameOfFileWithArgs.c_str(),
+        "-q",
+        "-j",
+        "3",
+        "-output_file_list",
+        "outFileList.txt",
+    };
+
+    std::vector<std::string> singleArgs = {
+        "-file",
+        clFiles + "copybuffer.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str()};
+
+    int numOfBuild = 4;
+    createFileWithArgs(singleArgs, numOfBuild);
+
+    pMultiCommand = MultiCommand::create(argv, retVal, oclocArgHelperWithoutInput.get());
+
+    EXPECT_NE(nullptr, pMultiCommand);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    outFileList = pMultiCommand->outputFileList;
+    ASSERT_TRUE(fileExists(outFileList));
+
+    std::vector<std::string> outFileListLines;
+    oclocArgHelperWithoutInput->readFileToVectorOfStrings(outFileList, outFileListLines);
+    ASSERT_EQ(static_cast<size_t>(numOfBuild), outFileListLines.size());
+    for (int i = 0; i < numOfBuild; i++) {
+        std::string outFileName = pMultiCommand->outDirForBuilds + "/build_no_" + std::to_string(i + 1);
+        EXPECT_TRUE(compilerOutputExists(outFileName, "bin"));
+        EXPECT_NE(std::string::npos, outFileListLines[i].find("build_no_" + std::to_string(i + 1) + ".bin"));
+    }
+
+    deleteFileWithArgs();
+    deleteOutFileList();
+    delete pMultiCommand;
+}
+
+TEST(MultiCommandWhiteboxTest, GivenInvalidNumberOfJobsWhenInitializingThenInvalidCommandLineIsReturned) {
+    MockMultiCommand mockMultiCommand{};
+
+    const std::vector<std::string> args = {
+        "ocloc",
+        "multi",
+        "commands.txt",
+        "-j",
+        "0"};
+
+    ::testing::internal::CaptureStdout();
+    const auto result = mockMultiCommand.initialize(args);
+    const auto output = testing::internal::GetCapturedStdout();
+
+    EXPECT_EQ(OclocErrorCode::INVALID_COMMAND_LINE, result);
+    EXPECT_EQ("Invalid number of parallel jobs: 0\n", output);
+}
+
+TEST(MultiCommandWhiteboxTest, GivenAllowCachingWhenAddingAdditionalOptionsToSingleCommandLineThenCachingOptionsArePassedToBuild) {
+    MockMultiCommand mockMultiCommand{};
+    mockMultiCommand.quiet = false;
+    mockMultiCommand.allowCaching = true;
+    mockMultiCommand.cacheDir = "SomeCacheDirectory";
+
+    std::vector<std::string> singleArgs = {
+        "-file",
+        clFiles + "copybuffer.cl",
+        "-output",
+        "SpecialOutputFilename",
+        "-out_dir",
+        "SomeOutputDirectory",
+        "-device",
+        gEnvironment->devicePrefix.c_str()};
+
+    auto expectedArgs{singleArgs};
+    expectedArgs.push_back("-allow_caching");
+    expectedArgs.push_back("-cache_dir");
+    expectedArgs.push_back("SomeCacheDirectory");
+
+    mockMultiCommand.addAdditionalOptionsToSingleCommandLine(singleArgs, 0);
+    EXPECT_EQ(expectedArgs, singleArgs);
+
+    mockMultiCommand.addAdditionalOptionsToSingleCommandLine(singleArgs, 0);
+    EXPECT_EQ(expectedArgs, singleArgs);
+}
+
 TEST(MultiCommandWhiteboxTest, GivenVerboseModeWhenShowingResultsThenLogsArePrintedForEachBuild) {
     MockMultiCommand mockMultiCommand{};
     mockMultiCommand.retValues = {OclocErrorCode::SUCCESS, OclocErrorCode::INVALID_FILE};
@@ -390,6 +479,16 @@ Usage: ocloc multi <file_name>
   -output_file_list             Name of optional file containing 
                                 paths to outputs .bin files
 
+  -j <jobs>                     Number of builds executed concurrently.
+                                Messages of each build are printed in
+                                command file order. Default is 1.
+
+  -allow_caching                Passes -allow_caching to every build, so
+                                builds with unchanged sources and options
+                                are loaded from compiler cache.
+
+  -cache_dir <cache_dir>        Caching directory used with -allow_caching.
+
 )===";
 
     EXPECT_EQ(expectedOutput, output);
@@ -3255,6 +3255,58 @@ TEST(BuildProgramTest, givenMultiDeviceProgramWhenBuildingThenStoreAndProcessBin
     EXPECT_EQ(CL_SUCCESS, retVal);
 }
 
+TEST(BuildProgramTest, givenParallelProgramBuildEnabledAndMultiDeviceProgramWhenBuildingThenEachRootDeviceGetsItsOwnCopyOfBinary) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ExperimentalParallelProgramBuild.set(1);
+
+    KernelBinaryHelper kbHelper("CopyBuffer_simd16");
+
+    std::string testFile;
+    testFile.append(clFiles);
+    testFile.append("CopyBuffer_simd16.cl");
+
+    size_t sourceSize = 0;
+    auto pSource = loadDataFromFile(testFile.c_str(), sourceSize);
+    ASSERT_NE(0u, sourceSize);
+    ASSERT_NE(nullptr, pSource);
+
+    const char *sources[1] = {pSource.get()};
+
+    MockUnrestrictiveContextMultiGPU context;
+    cl_int retVal = CL_INVALID_PROGRAM;
+
+    auto pProgram = Program::create<MockProgram>(&context, 1, sources, &sourceSize, retVal);
+    ASSERT_NE(nullptr, pProgram);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    retVal = clBuildProgram(pProgram, 0, nullptr, nullptr, nullptr, nullptr);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    auto &rootDeviceIndices = context.getRootDeviceIndices();
+    ASSERT_LT(1u, rootDeviceIndices.size());
+    auto &firstBuildInfo = pProgram->buildInfos[rootDeviceIndices[0]];
+    for (auto &rootDeviceIndex : rootDeviceIndices) {
+        EXPECT_EQ(1, pProgram->replaceDeviceBinaryCalledPerRootDevice[rootDeviceIndex]);
+        EXPECT_EQ(1, pProgram->processGenBinaryCalledPerRootDevice[rootDeviceIndex]);
+
+        auto &buildInfo = pProgram->buildInfos[rootDeviceIndex];
+        ASSERT_EQ(firstBuildInfo.packedDeviceBinarySize, buildInfo.packedDeviceBinarySize);
+        EXPECT_EQ(0, memcmp(firstBuildInfo.packedDeviceBinary.get(), buildInfo.packedDeviceBinary.get(), buildInfo.packedDeviceBinarySize));
+        if (&buildInfo != &firstBuildInfo) {
+            EXPECT_NE(firstBuildInfo.packedDeviceBinary.get(), buildInfo.packedDeviceBinary.get());
+        }
+    }
+
+    cl_build_status buildStatus;
+    for (const auto &device : context.getDevices()) {
+        EXPECT_EQ(CL_SUCCESS, clGetProgramBuildInfo(pProgram, device, CL_PROGRAM_BUILD_STATUS, sizeof(buildStatus), &buildStatus, nullptr));
+        EXPECT_EQ(CL_BUILD_SUCCESS, buildStatus);
+    }
+
+    retVal = clReleaseProgram(pProgram);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+}
+
 TEST(BuildProgramTest, givenMultiDeviceProgramWhenBuildingThenStoreKernelInfoPerEachRootDevice) {
     MockProgram *pProgram = nullptr;
     std::unique_ptr<char[]> pSource = nullptr;
@@ -11,25 +11,32 @@
 #include "shared/offline_compiler/source/ocloc_fatbinary.h"
 #include "shared/source/utilities/const_stringref.h"
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
+#include <thread>
 
 namespace NEO {
 int MultiCommand::singleBuild(const std::vector<std::string> &args) {
+    return executeBuild(args, outFileName, outputFile, true);
+}
+
+int MultiCommand::executeBuild(const std::vector<std::string> &args, std::string buildOutFileName, std::ostream &buildOutputFile, bool useSafetyGuard) {
     int retVal = OclocErrorCode::SUCCESS;
 
     if (requestedFatBinary(args, argHelper)) {
-        retVal = buildFatBinary(args, argHelper);
+        retVal = buildFatBinary(args, argHelper, useSafetyGuard);
     } else {
         std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(args.size(), args, true, retVal, argHelper)};
         if (retVal == OclocErrorCode::SUCCESS) {
-            retVal = buildWithSafetyGuard(pCompiler.get());
+            retVal = useSafetyGuard ? buildWithSafetyGuard(pCompiler.get()) : pCompiler->build();
 
             std::string &buildLog = pCompiler->getBuildLog();
             if (buildLog.empty() == false) {
                 argHelper->printf("%s\n", buildLog.c_str());
             }
         }
-        outFileName += ".bin";
+        buildOutFileName += ".bin";
     }
     if (retVal == OclocErrorCode::SUCCESS) {
         if (!quiet)
@@ -39,11 +46,11 @@ int MultiCommand::singleBuild(const std::vector<std::string> &args) {
     }
 
     if (retVal == OclocErrorCode::SUCCESS) {
-        outputFile << getCurrentDirectoryOwn(outDirForBuilds) + outFileName;
+        buildOutputFile << getCurrentDirectoryOwn(outDirForBuilds) + buildOutFileName;
     } else {
-        outputFile << "Unsuccesful build";
+        buildOutputFile << "Unsuccesful build";
     }
-    outputFile << '\n';
+    buildOutputFile << '\n';
 
     return retVal;
 }
@@ -68,11 +75,17 @@ MultiCommand *MultiCommand::create(const std::vector<std::string> &args, int &re
 void MultiCommand::addAdditionalOptionsToSingleCommandLine(std::vector<std::string> &singleLineWithArguments, size_t buildId) {
     bool hasOutDir = false;
     bool hasOutName = false;
+    bool hasAllowCaching = false;
+    bool hasCacheDir = false;
     for (const auto &arg : singleLineWithArguments) {
         if (ConstStringRef("-out_dir") == arg) {
             hasOutDir = true;
         } else if (ConstStringRef("-output") == arg) {
             hasOutName = true;
+        } else if (ConstStringRef("-allow_caching") == arg) {
+            hasAllowCaching = true;
+        } else if (ConstStringRef("-cache_dir") == arg) {
+            hasCacheDir = true;
         }
     }
 
@@ -86,6 +99,13 @@ void MultiCommand::addAdditionalOptionsToSingleCommandLine(std::vector<std::stri
         outFileName = "build_no_" + std::to_string(buildId + 1);
         singleLineWithArguments.push_back(outFileName);
     }
+    if (allowCaching && !hasAllowCaching) {
+        singleLineWithArguments.push_back("-allow_caching");
+    }
+    if (allowCaching && !cacheDir.empty() && !hasCacheDir) {
+        singleLineWithArguments.push_back("-cache_dir");
+        singleLineWithArguments.push_back(cacheDir);
+    }
     if (quiet)
         singleLineWithArguments.push_back("-q");
 }
@@ -105,6 +125,17 @@ int MultiCommand::initialize(const std::vector<std::string> &args) {
             outputFileList = args[++argIndex];
         } else if (ConstStringRef("-q") == currArg) {
             quiet = true;
+        } else if (hasMoreArgs && ConstStringRef("-j") == currArg) {
+            auto jobs = atoi(args[++argIndex].c_str());
+            if (jobs <= 0) {
+                argHelper->printf("Invalid number of parallel jobs: %s\n", args[argIndex].c_str());
+                return OclocErrorCode::INVALID_COMMAND_LINE;
+            }
+            numJobs = static_cast<uint32_t>(jobs);
+        } else if (ConstStringRef("-allow_caching") == currArg) {
+            allowCaching = true;
+        } else if (hasMoreArgs && ConstStringRef("-cache_dir") == currArg) {
+            cacheDir = args[++argIndex];
         } else {
             argHelper->printf("Invalid option (arg %zu): %s\n", argIndex, currArg.c_str());
             printHelp();
@@ -124,7 +155,11 @@ int MultiCommand::initialize(const std::vector<std::string> &args) {
         return OclocErrorCode::INVALID_FILE;
     }
 
-    runBuilds(args[0]);
+    if (numJobs > 1 && lines.size() > 1) {
+        runBuildsInParallel(args[0]);
+    } else {
+        runBuilds(args[0]);
+    }
 
     if (outputFileList != "") {
         argHelper->saveOutput(outputFileList, outputFile);
@@ -152,6 +187,66 @@ void MultiCommand::runBuilds(const std::string &argZero) {
     }
 }
 
+void MultiCommand::runBuildsInParallel(const std::string &argZero) {
+    struct BuildJob {
+        std::vector<std::string> args;
+        std::string outFileName;
+        MessagePrinter log{true};
+        std::stringstream outputFileEntry;
+        int retVal = OclocErrorCode::SUCCESS;
+    };
+
+    std::vector<BuildJob> jobs(lines.size());
+    for (size_t i = 0; i < lines.size(); ++i) {
+        auto &job = jobs[i];
+        job.args.push_back(argZero);
+        job.retVal = splitLineInSeparateArgs(job.args, lines[i], i);
+        if (job.retVal != OclocErrorCode::SUCCESS) {
+            job.args.clear();
+            continue;
+        }
+        addAdditionalOptionsToSingleCommandLine(job.args, i);
+        job.outFileName = outFileName;
+    }
+
+    // messages of each build are captured and printed in command file order once all builds are done,
+    // safety guard installs process wide signal handlers so it is not used by concurrent builds
+    std::atomic<size_t> nextJob{0};
+    auto buildJobs = [&]() {
+        for (auto jobId = nextJob++; jobId < jobs.size(); jobId = nextJob++) {
+            auto &job = jobs[jobId];
+            if (job.args.empty()) {
+                continue;
+            }
+            argHelper->setThreadMessagePrinter(&job.log);
+            job.retVal = executeBuild(job.args, job.outFileName, job.outputFileEntry, false);
+            argHelper->setThreadMessagePrinter(nullptr);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    auto numWorkers = std::min(static_cast<size_t>(numJobs), jobs.size());
+    for (size_t i = 1; i < numWorkers; i++) {
+        workers.emplace_back(buildJobs);
+    }
+    buildJobs();
+    for (auto &worker : workers) {
+        worker.join();
+    }
+
+    for (size_t i = 0; i < jobs.size(); ++i) {
+        auto &job = jobs[i];
+        if (!job.args.empty()) {
+            if (!quiet) {
+                argHelper->printf("Command number %zu: \n", i + 1);
+            }
+            argHelper->printf(job.log.getLog().str().c_str());
+            outputFile << job.outputFileEntry.str();
+        }
+        retValues.push_back(job.retVal);
+    }
+}
+
 void MultiCommand::printHelp() {
     argHelper->printf(R"===(Compiles multiple files using a config file.
 
@@ -167,6 +262,16 @@ Usage: ocloc multi <file_name>
   -output_file_list             Name of optional file containing 
                                 paths to outputs .bin files
 
+  -j <jobs>                     Number of builds executed concurrently.
+                                Messages of each build are printed in
+                                command file order. Default is 1.
+
+  -allow_caching                Passes -allow_caching to every build, so
+                                builds with unchanged sources and options
+                                are loaded from compiler cache.
+
+  -cache_dir <cache_dir>        Caching directory used with -allow_caching.
+
 )===");
 }
 
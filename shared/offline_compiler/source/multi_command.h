@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2022 Intel Corporation
+ * Copyright (C) 2020-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -39,9 +39,11 @@ class MultiCommand {
     int splitLineInSeparateArgs(std::vector<std::string> &qargs, const std::string &command, size_t numberOfBuild);
     int showResults();
     MOCKABLE_VIRTUAL int singleBuild(const std::vector<std::string> &args);
+    int executeBuild(const std::vector<std::string> &args, std::string buildOutFileName, std::ostream &buildOutputFile, bool useSafetyGuard);
     void addAdditionalOptionsToSingleCommandLine(std::vector<std::string> &, size_t buildId);
     void printHelp();
     void runBuilds(const std::string &argZero);
+    void runBuildsInParallel(const std::string &argZero);
 
     OclocArgHelper *argHelper = nullptr;
     std::vector<int> retValues;
@@ -49,6 +51,9 @@ class MultiCommand {
     std::string outFileName;
     std::string pathToCommandFile;
     std::stringstream outputFile;
+    std::string cacheDir;
+    uint32_t numJobs = 1;
     bool quiet = false;
+    bool allowCaching = false;
 };
 } // namespace NEO
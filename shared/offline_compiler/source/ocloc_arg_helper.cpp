@@ -49,6 +49,8 @@ Output::Output(const std::string &name, const void *data, const size_t &size)
     memcpy_s(reinterpret_cast<void *>(this->data), this->size, data, size);
 };
 
+thread_local MessagePrinter *OclocArgHelper::threadMessagePrinter = nullptr;
+
 OclocArgHelper::OclocArgHelper(const uint32_t numSources, const uint8_t **dataSources,
                                const uint64_t *lenSources, const char **nameSources,
                                const uint32_t numInputHeaders,
@@ -15,6 +15,7 @@
 #include <fstream>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -53,11 +54,15 @@ class OclocArgHelper {
     uint64_t **lenOutputs = nullptr;
     bool hasOutput = false;
     MessagePrinter messagePrinter;
+    std::mutex printMutex;
+    std::mutex outputsMutex;
+    static thread_local MessagePrinter *threadMessagePrinter;
     void moveOutputs();
     Source *findSourceFile(const std::string &filename);
     bool sourceFileExists(const std::string &filename) const;
 
     inline void addOutput(const std::string &filename, const void *data, const size_t &size) {
+        std::lock_guard<std::mutex> lock(outputsMutex);
         outputs.push_back(new Output(filename, data, size));
     }
 
@@ -92,12 +97,23 @@ class OclocArgHelper {
     MOCKABLE_VIRTUAL void saveOutput(const std::string &filename, const void *pData, const size_t &dataSize);
     void saveOutput(const std::string &filename, const std::ostream &stream);
 
-    MessagePrinter &getPrinterRef() { return messagePrinter; }
+    MessagePrinter &getPrinterRef() { return threadMessagePrinter ? *threadMessagePrinter : messagePrinter; }
+    void setThreadMessagePrinter(MessagePrinter *printer) { threadMessagePrinter = printer; }
     void printf(const char *message) {
+        if (threadMessagePrinter) {
+            threadMessagePrinter->printf(message);
+            return;
+        }
+        std::lock_guard<std::mutex> lock(printMutex);
         messagePrinter.printf(message);
     }
     template <typename... Args>
     void printf(const char *format, Args... args) {
+        if (threadMessagePrinter) {
+            threadMessagePrinter->printf(format, std::forward<Args>(args)...);
+            return;
+        }
+        std::lock_guard<std::mutex> lock(printMutex);
         messagePrinter.printf(format, std::forward<Args>(args)...);
     }
     template <typename EqComparableT>
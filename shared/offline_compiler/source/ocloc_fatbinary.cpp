@@ -22,9 +22,12 @@
 #include "igfxfmid.h"
 #include "platforms.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <cstdio>
+#include <thread>
 
 namespace NEO {
 bool requestedFatBinary(const std::vector<std::string> &args, OclocArgHelper *helper) {
@@ -240,30 +243,24 @@ std::vector<ConstStringRef> getTargetProductsForFatbinary(ConstStringRef deviceA
     return retVal;
 }
 
-int buildFatBinaryForTarget(int retVal, const std::vector<std::string> &argsCopy, std::string pointerSize, Ar::ArEncoder &fatbinary,
-                            OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &product) {
-
-    if (retVal == 0) {
-        retVal = buildWithSafetyGuard(pCompiler);
-        std::string buildLog = pCompiler->getBuildLog();
-        if (buildLog.empty() == false) {
-            argHelper->printf("%s\n", buildLog.c_str());
-        }
-        if (retVal == 0) {
-            if (!pCompiler->isQuiet())
-                argHelper->printf("Build succeeded for : %s.\n", product.c_str());
-        } else {
-            argHelper->printf("Build failed for : %s with error code: %d\n", product.c_str(), retVal);
-            argHelper->printf("Command was:");
-            for (const auto &arg : argsCopy)
-                argHelper->printf(" %s", arg.c_str());
-            argHelper->printf("\n");
-        }
+void printFatBinaryTargetBuildResult(int retVal, const std::vector<std::string> &argsCopy, OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &product) {
+    std::string buildLog = pCompiler->getBuildLog();
+    if (buildLog.empty() == false) {
+        argHelper->printf("%s\n", buildLog.c_str());
     }
-    if (retVal) {
-        return retVal;
+    if (retVal == 0) {
+        if (!pCompiler->isQuiet())
+            argHelper->printf("Build succeeded for : %s.\n", product.c_str());
+    } else {
+        argHelper->printf("Build failed for : %s with error code: %d\n", product.c_str(), retVal);
+        argHelper->printf("Command was:");
+        for (const auto &arg : argsCopy)
+            argHelper->printf(" %s", arg.c_str());
+        argHelper->printf("\n");
     }
+}
 
+void appendFatBinaryTarget(const std::string &pointerSize, Ar::ArEncoder &fatbinary, OfflineCompiler *pCompiler, const std::string &product) {
     std::string productConfig("");
     if (product.find(".") != std::string::npos) {
         productConfig = product;
@@ -272,10 +269,68 @@ int buildFatBinaryForTarget(int retVal, const std::vector<std::string> &argsCopy
     }
 
     fatbinary.appendFileEntry(pointerSize + "." + productConfig, pCompiler->getPackedDeviceBinaryOutput());
+}
+
+int buildFatBinaryForTarget(int retVal, const std::vector<std::string> &argsCopy, std::string pointerSize, Ar::ArEncoder &fatbinary,
+                            OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &product, bool useSafetyGuard) {
+
+    if (retVal == 0) {
+        retVal = useSafetyGuard ? buildWithSafetyGuard(pCompiler) : pCompiler->build();
+        printFatBinaryTargetBuildResult(retVal, argsCopy, pCompiler, argHelper, product);
+    }
+    if (retVal) {
+        return retVal;
+    }
+
+    appendFatBinaryTarget(pointerSize, fatbinary, pCompiler, product);
     return retVal;
 }
 
-int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelper) {
+int buildFatBinaryForTargetsInParallel(const std::vector<std::string> &argsCopy, size_t deviceArgIndex, const std::string &pointerSize, Ar::ArEncoder &fatbinary,
+                                       const std::vector<ConstStringRef> &targetProducts, uint32_t numJobs, OclocArgHelper *argHelper) {
+    std::vector<std::vector<std::string>> targetArgs(targetProducts.size(), argsCopy);
+    std::vector<std::unique_ptr<OfflineCompiler>> compilers(targetProducts.size());
+    for (size_t i = 0; i < targetProducts.size(); i++) {
+        int retVal = 0;
+        targetArgs[i][deviceArgIndex] = targetProducts[i].str();
+        compilers[i].reset(OfflineCompiler::create(targetArgs[i].size(), targetArgs[i], false, retVal, argHelper));
+        if (OclocErrorCode::SUCCESS != retVal) {
+            argHelper->printf("Error! Couldn't create OfflineCompiler. Exiting.\n");
+            return retVal;
+        }
+    }
+
+    // Every target is compiled by an isolated OfflineCompiler, results are consumed in target order afterwards
+    std::vector<int> buildResults(targetProducts.size(), OclocErrorCode::SUCCESS);
+    std::atomic<size_t> nextTarget{0};
+    auto buildTargets = [&]() {
+        for (auto target = nextTarget++; target < compilers.size(); target = nextTarget++) {
+            buildResults[target] = compilers[target]->build();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    auto numWorkers = std::min(static_cast<size_t>(numJobs), targetProducts.size());
+    for (size_t i = 1; i < numWorkers; i++) {
+        workers.emplace_back(buildTargets);
+    }
+    buildTargets();
+    for (auto &worker : workers) {
+        worker.join();
+    }
+
+    for (size_t i = 0; i < targetProducts.size(); i++) {
+        auto product = targetProducts[i].str();
+        printFatBinaryTargetBuildResult(buildResults[i], targetArgs[i], compilers[i].get(), argHelper, product);
+        if (buildResults[i]) {
+            return buildResults[i];
+        }
+        appendFatBinaryTarget(pointerSize, fatbinary, compilers[i].get(), product);
+    }
+    return OclocErrorCode::SUCCESS;
+}
+
+int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelper, bool useSafetyGuard) {
     std::string pointerSizeInBits = (sizeof(void *) == 4) ? "32" : "64";
     size_t deviceArgIndex = -1;
     std::string inputFileName = "";
@@ -283,6 +338,7 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
     std::string outputDirectory = "";
     bool spirvInput = false;
     bool excludeIr = false;
+    int numJobs = 1;
 
     std::vector<std::string> argsCopy(args);
     for (size_t argIndex = 1; argIndex < args.size(); argIndex++) {
@@ -308,6 +364,13 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
             excludeIr = true;
         } else if (ConstStringRef("-spirv_input") == currArg) {
             spirvInput = true;
+        } else if (ConstStringRef("-j") == currArg) {
+            numJobs = hasMoreArgs ? atoi(args[argIndex + 1].c_str()) : 0;
+            if (numJobs <= 0) {
+                argHelper->printf("Error! Invalid number of parallel jobs for -j option.\n");
+                return OclocErrorCode::INVALID_COMMAND_LINE;
+            }
+            ++argIndex;
         }
     }
 
@@ -328,19 +391,28 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
         argHelper->printf("Failed to parse target devices from : %s\n", args[deviceArgIndex].c_str());
         return 1;
     }
-    for (const auto &product : targetProducts) {
-        int retVal = 0;
-        argsCopy[deviceArgIndex] = product.str();
 
-        std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(argsCopy.size(), argsCopy, false, retVal, argHelper)};
-        if (OclocErrorCode::SUCCESS != retVal) {
-            argHelper->printf("Error! Couldn't create OfflineCompiler. Exiting.\n");
+    const bool buildInParallel = numJobs > 1 && targetProducts.size() > 1;
+    if (buildInParallel) {
+        auto retVal = buildFatBinaryForTargetsInParallel(argsCopy, deviceArgIndex, pointerSizeInBits, fatbinary, targetProducts, static_cast<uint32_t>(numJobs), argHelper);
+        if (retVal) {
             return retVal;
         }
+    } else {
+        for (const auto &product : targetProducts) {
+            int retVal = 0;
+            argsCopy[deviceArgIndex] = product.str();
+
+            std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(argsCopy.size(), argsCopy, false, retVal, argHelper)};
+            if (OclocErrorCode::SUCCESS != retVal) {
+                argHelper->printf("Error! Couldn't create OfflineCompiler. Exiting.\n");
+                return retVal;
+            }
 
-        retVal = buildFatBinaryForTarget(retVal, argsCopy, pointerSizeInBits, fatbinary, pCompiler.get(), argHelper, product.str());
-        if (retVal) {
-            return retVal;
+            retVal = buildFatBinaryForTarget(retVal, argsCopy, pointerSizeInBits, fatbinary, pCompiler.get(), argHelper, product.str(), useSafetyGuard);
+            if (retVal) {
+                return retVal;
+            }
         }
     }
 
@@ -24,7 +24,7 @@ inline bool requestedFatBinary(int argc, const char *argv[], OclocArgHelper *hel
     return requestedFatBinary(args, helper);
 }
 
-int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelper);
+int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelper, bool useSafetyGuard = true);
 inline int buildFatBinary(int argc, const char *argv[], OclocArgHelper *argHelper) {
     std::vector<std::string> args;
     args.assign(argv, argv + argc);
@@ -36,7 +36,11 @@ void getProductsAcronymsForTarget(std::vector<NEO::ConstStringRef> &out, Target
 void getProductsForRange(unsigned int productFrom, unsigned int productTo, std::vector<ConstStringRef> &out, OclocArgHelper *argHelper);
 std::vector<ConstStringRef> getTargetProductsForFatbinary(ConstStringRef deviceArg, OclocArgHelper *argHelper);
 int buildFatBinaryForTarget(int retVal, const std::vector<std::string> &argsCopy, std::string pointerSize, Ar::ArEncoder &fatbinary,
-                            OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &deviceConfig);
+                            OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &deviceConfig, bool useSafetyGuard = true);
+int buildFatBinaryForTargetsInParallel(const std::vector<std::string> &argsCopy, size_t deviceArgIndex, const std::string &pointerSize, Ar::ArEncoder &fatbinary,
+                                       const std::vector<ConstStringRef> &targetProducts, uint32_t numJobs, OclocArgHelper *argHelper);
+void printFatBinaryTargetBuildResult(int retVal, const std::vector<std::string> &argsCopy, OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &product);
+void appendFatBinaryTarget(const std::string &pointerSize, Ar::ArEncoder &fatbinary, OfflineCompiler *pCompiler, const std::string &product);
 int appendGenericIr(Ar::ArEncoder &fatbinary, const std::string &inputFile, OclocArgHelper *argHelper);
 std::vector<uint8_t> createEncodedElfWithSpirv(const ArrayRef<const uint8_t> &spirv);
 
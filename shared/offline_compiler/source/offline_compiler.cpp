@@ -743,6 +743,9 @@ int OfflineCompiler::parseCommandLine(size_t numArgs, const std::vector<std::str
             argIndex++;
         } else if ("-allow_caching" == currArg) {
             allowCaching = true;
+        } else if (("-j" == currArg) && hasMoreArgs) {
+            // number of parallel jobs is consumed by fat binary builds
+            argIndex++;
         } else {
             argHelper->printf("Invalid option (arg %d): %s\n", argIndex, argv[argIndex].c_str());
             retVal = INVALID_COMMAND_LINE;
@@ -871,7 +874,7 @@ void OfflineCompiler::printUsage() {
 Additionally, outputs intermediate representation (e.g. spirV).
 Different input and intermediate file formats are available.
 
-Usage: ocloc [compile] -file <filename> -device <device_type> [-output <filename>] [-out_dir <output_dir>] [-options <options>] [-32|-64] [-internal_options <options>] [-llvm_text|-llvm_input|-spirv_input] [-options_name] [-q] [-cpp_file] [-output_no_suffix] [--help]
+Usage: ocloc [compile] -file <filename> -device <device_type> [-output <filename>] [-out_dir <output_dir>] [-options <options>] [-32|-64] [-internal_options <options>] [-llvm_text|-llvm_input|-spirv_input] [-options_name] [-q] [-cpp_file] [-output_no_suffix] [-j <jobs>] [--help]
 
   -file <filename>              The input file to be compiled
                                 (by default input source format is
@@ -1009,6 +1012,10 @@ Usage: ocloc [compile] -file <filename> -device <device_type> [-output <filename
 
   -exclude_ir                   Excludes IR from the output binary file.
 
+  -j <jobs>                     Number of targets compiled concurrently
+                                when building a fatbinary archive.
+                                Default is 1.
+
   --format                      Enforce given binary format. The possible values are:
                                 --format zebin - Enforce generating zebin binary
                                 --format patchtokens - Enforce generating patchtokens (legacy) binary.
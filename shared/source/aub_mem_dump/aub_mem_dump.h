@@ -8,9 +8,12 @@
 #pragma once
 #include "shared/source/aub_mem_dump/aub_data.h"
 
+#include <condition_variable>
 #include <fstream>
 #include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 namespace NEO {
 class AubHelper;
@@ -120,6 +123,7 @@ struct AubStream {
 };
 
 struct AubFileStream : public AubStream {
+    ~AubFileStream() override;
     void open(const char *filePath) override;
     void close() override;
     bool init(uint32_t stepping, uint32_t device) override;
@@ -139,10 +143,29 @@ struct AubFileStream : public AubStream {
                                        uint32_t addressSpace, uint32_t compareOperation);
     MOCKABLE_VIRTUAL bool addComment(const char *message);
     [[nodiscard]] MOCKABLE_VIRTUAL std::unique_lock<std::mutex> lockStream();
+    bool isBufferedWriterActive() const { return writerThread.joinable(); }
 
     std::ofstream fileHandle;
     std::string fileName;
     std::mutex mutex;
+
+  protected:
+    void startBufferedWriter(size_t bufferSize);
+    void stopBufferedWriter();
+    void submitWriteBuffer();
+    void waitForBufferedWrites();
+    void syncBufferedWrites();
+    void bufferedWriterLoop();
+
+    // writes are gathered in writeBuffer and handed over to writerThread, which stores them in the file
+    std::vector<char> writeBuffer;
+    std::vector<char> pendingWriteBuffer;
+    size_t writeBufferCapacity = 0;
+    std::thread writerThread;
+    std::mutex writerMutex;
+    std::condition_variable writerCondition;
+    bool writePending = false;
+    bool stopWriter = false;
 };
 
 template <int addressingBits>
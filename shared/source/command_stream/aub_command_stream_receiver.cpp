@@ -11,6 +11,7 @@
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/hw_info.h"
@@ -90,24 +91,127 @@ static auto sizeMemoryWriteHeader = sizeof(CmdServicesMemTraceMemoryWrite) - siz
 
 extern const size_t g_dwordCountMax;
 
+AubFileStream::~AubFileStream() {
+    stopBufferedWriter();
+}
+
 void AubFileStream::open(const char *filePath) {
     fileHandle.open(filePath, std::ofstream::binary);
     fileName.assign(filePath);
+
+    if (DebugManager.flags.AubDumpWriteBufferSizeInKb.get() > 0 && fileHandle.is_open()) {
+        startBufferedWriter(static_cast<size_t>(DebugManager.flags.AubDumpWriteBufferSizeInKb.get()) * MemoryConstants::kiloByte);
+    }
 }
 
 void AubFileStream::close() {
+    stopBufferedWriter();
     fileHandle.close();
     fileName.clear();
 }
 
 void AubFileStream::write(const char *data, size_t size) {
-    fileHandle.write(data, size);
+    if (!isBufferedWriterActive()) {
+        fileHandle.write(data, size);
+        return;
+    }
+
+    if (writeBuffer.size() + size > writeBufferCapacity) {
+        submitWriteBuffer();
+
+        if (size >= writeBufferCapacity) {
+            waitForBufferedWrites();
+            fileHandle.write(data, size);
+            return;
+        }
+    }
+    writeBuffer.insert(writeBuffer.end(), data, data + size);
 }
 
 void AubFileStream::flush() {
+    if (isBufferedWriterActive()) {
+        // the writer thread owns the file, gathered writes are only handed over to it
+        submitWriteBuffer();
+        return;
+    }
+    fileHandle.flush();
+}
+
+void AubFileStream::syncBufferedWrites() {
+    if (isBufferedWriterActive()) {
+        submitWriteBuffer();
+        waitForBufferedWrites();
+    }
     fileHandle.flush();
 }
 
+void AubFileStream::startBufferedWriter(size_t bufferSize) {
+    writeBufferCapacity = bufferSize;
+    writeBuffer.reserve(writeBufferCapacity);
+    pendingWriteBuffer.reserve(writeBufferCapacity);
+    writePending = false;
+    stopWriter = false;
+    writerThread = std::thread(&AubFileStream::bufferedWriterLoop, this);
+}
+
+void AubFileStream::stopBufferedWriter() {
+    if (!isBufferedWriterActive()) {
+        return;
+    }
+
+    submitWriteBuffer();
+    {
+        std::lock_guard<std::mutex> lock(writerMutex);
+        stopWriter = true;
+    }
+    writerCondition.notify_all();
+    writerThread.join();
+
+    writeBuffer = {};
+    pendingWriteBuffer = {};
+    writeBufferCapacity = 0;
+}
+
+void AubFileStream::submitWriteBuffer() {
+    if (writeBuffer.empty()) {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(writerMutex);
+    writerCondition.wait(lock, [this] { return !writePending; });
+    writeBuffer.swap(pendingWriteBuffer);
+    writePending = true;
+    lock.unlock();
+    writerCondition.notify_all();
+
+    writeBuffer.clear();
+}
+
+void AubFileStream::waitForBufferedWrites() {
+    std::unique_lock<std::mutex> lock(writerMutex);
+    writerCondition.wait(lock, [this] { return !writePending; });
+}
+
+void AubFileStream::bufferedWriterLoop() {
+    std::unique_lock<std::mutex> lock(writerMutex);
+    while (true) {
+        writerCondition.wait(lock, [this] { return writePending || stopWriter; });
+
+        if (writePending) {
+            lock.unlock();
+            fileHandle.write(pendingWriteBuffer.data(), pendingWriteBuffer.size());
+            pendingWriteBuffer.clear();
+            lock.lock();
+
+            writePending = false;
+            writerCondition.notify_all();
+            continue;
+        }
+
+        return;
+    }
+}
+
 bool AubFileStream::init(uint32_t stepping, uint32_t device) {
     CmdServicesMemTraceVersion header = {};
 
@@ -202,6 +306,7 @@ void AubFileStream::registerPoll(uint32_t registerOffset, uint32_t mask, uint32_
     header.dwordCount = (sizeof(header) / sizeof(uint32_t)) - 1;
 
     write(reinterpret_cast<char *>(&header), sizeof(header));
+    syncBufferedWrites();
 }
 
 void AubFileStream::expectMMIO(uint32_t mmioRegister, uint32_t expectedValue) {
@@ -220,6 +325,7 @@ void AubFileStream::expectMMIO(uint32_t mmioRegister, uint32_t expectedValue) {
     header.dwordCount = (sizeof(header) / sizeof(uint32_t)) - 1;
 
     write(reinterpret_cast<char *>(&header), sizeof(header));
+    syncBufferedWrites();
 }
 
 void AubFileStream::expectMemory(uint64_t physAddress, const void *memory, size_t sizeRemaining,
@@ -268,6 +374,7 @@ void AubFileStream::expectMemory(uint64_t physAddress, const void *memory, size_
             write(reinterpret_cast<char *>(&zero), sizeof(uint32_t) - remainder);
         }
     }
+    syncBufferedWrites();
 }
 
 void AubFileStream::createContext(const AubPpgttContextCreate &cmd) {
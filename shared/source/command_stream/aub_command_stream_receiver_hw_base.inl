@@ -679,7 +679,17 @@ bool AUBCommandStreamReceiverHw<GfxFamily>::writeMemory(GraphicsAllocation &gfxA
 
     auto streamLocked = getAubStream()->lockStream();
 
-    if (aubManager) {
+    if (this->isMemoryWriteDeduplicationAllowed(gfxAllocation, cpuAddress)) {
+        auto memoryBank = this->getMemoryBank(&gfxAllocation);
+        auto entryBits = this->getPPGTTAdditionalBits(&gfxAllocation);
+        this->writeChangedPages(gfxAllocation.getAubWrittenPages(this->osContext->getContextId()), memoryBank, cpuAddress, size, gfxAllocation.getUsedPageSize(), [&](size_t offset, size_t rangeSize) {
+            if (aubManager) {
+                this->writeMemoryRangeWithAubManager(gfxAllocation, gpuAddress + offset, ptrOffset(cpuAddress, offset), rangeSize);
+            } else {
+                writeMemory(gpuAddress + offset, ptrOffset(cpuAddress, offset), rangeSize, memoryBank, entryBits);
+            }
+        });
+    } else if (aubManager) {
         this->writeMemoryWithAubManager(gfxAllocation);
     } else {
         writeMemory(gpuAddress, cpuAddress, size, this->getMemoryBank(&gfxAllocation), this->getPPGTTAdditionalBits(&gfxAllocation));
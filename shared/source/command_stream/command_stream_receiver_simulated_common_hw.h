@@ -12,6 +12,8 @@
 #include "aub_mapper.h"
 #include "aubstream/hardware_context.h"
 
+#include <functional>
+
 namespace aub_stream {
 class AubManager;
 struct AubStream;
@@ -21,6 +23,7 @@ namespace NEO {
 class AddressMapper;
 class GraphicsAllocation;
 class HardwareContextController;
+struct WrittenPagesInfo;
 template <typename GfxFamily>
 class CommandStreamReceiverSimulatedCommonHw : public CommandStreamReceiverHw<GfxFamily> {
   protected:
@@ -31,6 +34,9 @@ class CommandStreamReceiverSimulatedCommonHw : public CommandStreamReceiverHw<Gf
     bool getParametersForWriteMemory(GraphicsAllocation &graphicsAllocation, uint64_t &gpuAddress, void *&cpuAddress, size_t &size) const;
     void freeEngineInfo(AddressMapper &gttRemap);
     MOCKABLE_VIRTUAL uint32_t getDeviceIndex() const;
+    bool isMemoryWriteDeduplicationAllowed(GraphicsAllocation &graphicsAllocation, const void *cpuAddress) const;
+    void writeChangedPages(WrittenPagesInfo &writtenPages, uint32_t banks, const void *cpuAddress, size_t size, size_t pageSize,
+                           const std::function<void(size_t offset, size_t size)> &writeRange);
 
   public:
     using CommandStreamReceiverHw<GfxFamily>::peekExecutionEnvironment;
@@ -87,5 +93,8 @@ class CommandStreamReceiverSimulatedCommonHw : public CommandStreamReceiverHw<Gf
     } engineInfo = {};
 
     AubMemDump::AubStream *stream;
+
+    uint64_t memoryWriteBytesWritten = 0;
+    uint64_t memoryWriteBytesSkipped = 0;
 };
 } // namespace NEO
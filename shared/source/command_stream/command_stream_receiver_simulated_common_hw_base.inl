@@ -17,6 +17,8 @@
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/hardware_context_controller.h"
+#include "shared/source/helpers/hash.h"
+#include "shared/source/helpers/string.h"
 #include "shared/source/memory_manager/address_mapper.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
@@ -71,6 +73,63 @@ bool CommandStreamReceiverSimulatedCommonHw<GfxFamily>::getParametersForWriteMem
     return true;
 }
 
+template <typename GfxFamily>
+bool CommandStreamReceiverSimulatedCommonHw<GfxFamily>::isMemoryWriteDeduplicationAllowed(GraphicsAllocation &graphicsAllocation, const void *cpuAddress) const {
+    if (DebugManager.flags.SimulatedMemoryWriteDeduplication.get() != 1) {
+        return false;
+    }
+
+    // contents of written pages are compared against what was last written from CPU, so only allocations never written by GPU can be skipped
+    const auto allocationType = graphicsAllocation.getAllocationType();
+    const bool gpuReadOnly = GraphicsAllocation::isIsaAllocationType(allocationType) ||
+                             allocationType == AllocationType::CONSTANT_SURFACE;
+
+    return gpuReadOnly && cpuAddress != nullptr && !graphicsAllocation.isCompressionEnabled();
+}
+
+template <typename GfxFamily>
+void CommandStreamReceiverSimulatedCommonHw<GfxFamily>::writeChangedPages(WrittenPagesInfo &writtenPages, uint32_t banks, const void *cpuAddress, size_t size, size_t pageSize,
+                                                                          const std::function<void(size_t offset, size_t size)> &writeRange) {
+    const auto pageCount = (size + pageSize - 1) / pageSize;
+    const bool pagesTracked = (writtenPages.banks == banks) && (writtenPages.pageHashes.size() == pageCount);
+    if (!pagesTracked) {
+        writtenPages.pageHashes.assign(pageCount, 0u);
+        writtenPages.writtenContents.assign(size, 0u);
+        writtenPages.banks = banks;
+    }
+
+    size_t rangeOffset = 0;
+    size_t rangeSize = 0;
+    for (size_t page = 0; page < pageCount; page++) {
+        const auto pageOffset = page * pageSize;
+        const auto pageBytes = std::min(pageSize, size - pageOffset);
+        const auto pageAddress = ptrOffset(cpuAddress, pageOffset);
+        const auto pageHash = hashMemoryContents(pageAddress, pageBytes);
+        auto writtenPage = writtenPages.writtenContents.data() + pageOffset;
+
+        if (pagesTracked && writtenPages.pageHashes[page] == pageHash && memcmp(writtenPage, pageAddress, pageBytes) == 0) {
+            if (rangeSize > 0) {
+                writeRange(rangeOffset, rangeSize);
+                rangeSize = 0;
+            }
+            memoryWriteBytesSkipped += pageBytes;
+            continue;
+        }
+
+        writtenPages.pageHashes[page] = pageHash;
+        memcpy_s(writtenPage, pageBytes, pageAddress, pageBytes);
+        if (rangeSize == 0) {
+            rangeOffset = pageOffset;
+        }
+        rangeSize += pageBytes;
+        memoryWriteBytesWritten += pageBytes;
+    }
+
+    if (rangeSize > 0) {
+        writeRange(rangeOffset, rangeSize);
+    }
+}
+
 template <typename GfxFamily>
 bool CommandStreamReceiverSimulatedCommonHw<GfxFamily>::expectMemoryEqual(void *gfxAddress, const void *srcAddress, size_t length) {
     return this->expectMemory(gfxAddress, srcAddress, length,
@@ -124,5 +183,9 @@ CommandStreamReceiverSimulatedCommonHw<GfxFamily>::CommandStreamReceiverSimulate
     this->useGpuIdleImplicitFlush = false;
 }
 template <typename GfxFamily>
-CommandStreamReceiverSimulatedCommonHw<GfxFamily>::~CommandStreamReceiverSimulatedCommonHw() = default;
+CommandStreamReceiverSimulatedCommonHw<GfxFamily>::~CommandStreamReceiverSimulatedCommonHw() {
+    PRINT_DEBUG_STRING(DebugManager.flags.PrintDebugMessages.get() && (memoryWriteBytesSkipped > 0), stdout,
+                       "Simulated memory writes: %llu bytes written, %llu bytes skipped as unchanged\n",
+                       static_cast<unsigned long long>(memoryWriteBytesWritten), static_cast<unsigned long long>(memoryWriteBytesSkipped));
+}
 } // namespace NEO
@@ -95,6 +95,10 @@ class CommandStreamReceiverSimulatedHw : public CommandStreamReceiverSimulatedCo
         void *cpuAddress;
         size_t size;
         this->getParametersForWriteMemory(graphicsAllocation, gpuAddress, cpuAddress, size);
+        writeMemoryRangeWithAubManager(graphicsAllocation, gpuAddress, cpuAddress, size);
+    }
+
+    void writeMemoryRangeWithAubManager(GraphicsAllocation &graphicsAllocation, uint64_t gpuAddress, void *cpuAddress, size_t size) {
         int hint = graphicsAllocation.getAllocationType() == AllocationType::COMMAND_BUFFER
                        ? AubMemDump::DataTypeHintValues::TraceBatchBuffer
                        : AubMemDump::DataTypeHintValues::TraceNotype;
@@ -14,6 +14,7 @@
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/helpers/compiler_product_helper.h"
+#include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/os_interface/os_inc_base.h"
 
@@ -107,25 +108,40 @@ TranslationOutput::ErrorCode CompilerInterface::build(
             intermediateCodeType = getPreferredIntermediateRepresentation(device);
         }
 
-        auto fclTranslationCtx = createFclTranslationCtx(device, srcCodeType, intermediateCodeType);
-        auto fclOutput = translate(fclTranslationCtx.get(), inSrc.get(),
-                                   fclOptions.get(), fclInternalOptions.get());
-
-        if (fclOutput == nullptr) {
-            return TranslationOutput::ErrorCode::UnknownError;
+        uint64_t frontendIrKey = 0;
+        if (isFrontendIrCacheEnabled()) {
+            frontendIrKey = getFrontendIrCacheKey(device, input, intermediateCodeType);
         }
 
-        TranslationOutput::makeCopy(output.frontendCompilerLog, fclOutput->GetBuildLog());
+        if (isFrontendIrCacheEnabled() && loadFrontendIr(frontendIrKey, input, output)) {
+            output.intermediateCodeType = intermediateCodeType;
+            auto cachedIr = CIF::Builtins::CreateConstBuffer(igcMain.get(), output.intermediateRepresentation.mem.get(), output.intermediateRepresentation.size);
+            cachedIr->Retain(); // will be used as input to compiler
+            intermediateRepresentation.reset(cachedIr.get());
+        } else {
+            auto fclTranslationCtx = createFclTranslationCtx(device, srcCodeType, intermediateCodeType);
+            auto fclOutput = translate(fclTranslationCtx.get(), inSrc.get(),
+                                       fclOptions.get(), fclInternalOptions.get());
 
-        if (fclOutput->Successful() == false) {
-            return TranslationOutput::ErrorCode::BuildFailure;
-        }
+            if (fclOutput == nullptr) {
+                return TranslationOutput::ErrorCode::UnknownError;
+            }
 
-        output.intermediateCodeType = intermediateCodeType;
-        TranslationOutput::makeCopy(output.intermediateRepresentation, fclOutput->GetOutput());
+            TranslationOutput::makeCopy(output.frontendCompilerLog, fclOutput->GetBuildLog());
 
-        fclOutput->GetOutput()->Retain(); // will be used as input to compiler
-        intermediateRepresentation.reset(fclOutput->GetOutput());
+            if (fclOutput->Successful() == false) {
+                return TranslationOutput::ErrorCode::BuildFailure;
+            }
+
+            output.intermediateCodeType = intermediateCodeType;
+            TranslationOutput::makeCopy(output.intermediateRepresentation, fclOutput->GetOutput());
+            if (isFrontendIrCacheEnabled()) {
+                storeFrontendIr(frontendIrKey, input, output);
+            }
+
+            fclOutput->GetOutput()->Retain(); // will be used as input to compiler
+            intermediateRepresentation.reset(fclOutput->GetOutput());
+        }
     } else {
         inSrc->Retain(); // will be used as input to compiler directly
         intermediateRepresentation.reset(inSrc.get());
@@ -186,6 +202,15 @@ TranslationOutput::ErrorCode CompilerInterface::compile(
         outType = getPreferredIntermediateRepresentation(device);
     }
 
+    uint64_t frontendIrKey = 0;
+    if (isFrontendIrCacheEnabled() && (IGC::CodeType::oclC == input.srcType)) {
+        frontendIrKey = getFrontendIrCacheKey(device, input, outType);
+        if (loadFrontendIr(frontendIrKey, input, output)) {
+            output.intermediateCodeType = outType;
+            return TranslationOutput::ErrorCode::Success;
+        }
+    }
+
     auto fclSrc = CIF::Builtins::CreateConstBuffer(fclMain.get(), input.src.begin(), input.src.size());
     auto fclOptions = CIF::Builtins::CreateConstBuffer(fclMain.get(), input.apiOptions.begin(), input.apiOptions.size());
     auto fclInternalOptions = CIF::Builtins::CreateConstBuffer(fclMain.get(), input.internalOptions.begin(), input.internalOptions.size());
@@ -207,6 +232,9 @@ TranslationOutput::ErrorCode CompilerInterface::compile(
 
     output.intermediateCodeType = outType;
     TranslationOutput::makeCopy(output.intermediateRepresentation, fclOutput->GetOutput());
+    if (isFrontendIrCacheEnabled() && (IGC::CodeType::oclC == input.srcType)) {
+        storeFrontendIr(frontendIrKey, input, output);
+    }
 
     return TranslationOutput::ErrorCode::Success;
 }
@@ -385,6 +413,67 @@ bool CompilerInterface::initialize(std::unique_ptr<CompilerCache> &&cache, bool
     return this->cache && igcAvailable && (fclAvailable || (false == requireFcl));
 }
 
+bool CompilerInterface::isFrontendIrCacheEnabled() const {
+    if (DebugManager.flags.ExperimentalEnableFrontendIrCache.get() != -1) {
+        return !!DebugManager.flags.ExperimentalEnableFrontendIrCache.get();
+    }
+    return false;
+}
+
+uint64_t CompilerInterface::getFrontendIrCacheKey(const Device &device, const TranslationInput &input, IGC::CodeType::CodeType_t intermediateCodeType) const {
+    // frontend device context is created from platform and OpenCL version only, so devices sharing them produce the same IR
+    const auto &hwInfo = device.getHardwareInfo();
+    Hash hash;
+    hash.update(input.src.begin(), input.src.size());
+    hash.update("----", 4);
+    hash.update(input.apiOptions.begin(), input.apiOptions.size());
+    hash.update("----", 4);
+    hash.update(input.internalOptions.begin(), input.internalOptions.size());
+    hash.update("----", 4);
+    hash.update(reinterpret_cast<const char *>(&input.srcType), sizeof(input.srcType));
+    hash.update(reinterpret_cast<const char *>(&intermediateCodeType), sizeof(intermediateCodeType));
+    hash.update(reinterpret_cast<const char *>(&hwInfo.platform), sizeof(hwInfo.platform));
+    hash.update(reinterpret_cast<const char *>(&hwInfo.capabilityTable.clVersionSupport), sizeof(hwInfo.capabilityTable.clVersionSupport));
+    return hash.finish();
+}
+
+bool CompilerInterface::loadFrontendIr(uint64_t key, const TranslationInput &input, TranslationOutput &output) {
+    std::lock_guard<std::mutex> lock(frontendIrCacheMutex);
+    auto it = frontendIrCache.find(key);
+    if (it == frontendIrCache.end() || !it->second.matches(input)) {
+        return false;
+    }
+
+    const auto &cachedIr = it->second.intermediateRepresentation;
+    output.intermediateRepresentation.mem = ::makeCopy(cachedIr.data(), cachedIr.size());
+    output.intermediateRepresentation.size = cachedIr.size();
+    output.frontendCompilerLog = it->second.frontendCompilerLog;
+    return true;
+}
+
+void CompilerInterface::storeFrontendIr(uint64_t key, const TranslationInput &input, const TranslationOutput &output) {
+    if (output.intermediateRepresentation.size == 0) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(frontendIrCacheMutex);
+    if (frontendIrCache.find(key) != frontendIrCache.end()) {
+        return;
+    }
+    if (frontendIrCacheOrder.size() >= maxFrontendIrCacheEntries) {
+        frontendIrCache.erase(frontendIrCacheOrder.front());
+        frontendIrCacheOrder.pop_front();
+    }
+
+    auto &entry = frontendIrCache[key];
+    entry.source.assign(input.src.begin(), input.src.size());
+    entry.apiOptions.assign(input.apiOptions.begin(), input.apiOptions.size());
+    entry.internalOptions.assign(input.internalOptions.begin(), input.internalOptions.size());
+    entry.intermediateRepresentation.assign(output.intermediateRepresentation.mem.get(), output.intermediateRepresentation.size);
+    entry.frontendCompilerLog = output.frontendCompilerLog;
+    frontendIrCacheOrder.push_back(key);
+}
+
 IGC::FclOclDeviceCtxTagOCL *CompilerInterface::getFclDeviceCtx(const Device &device) {
     auto ulock = this->lock();
     auto it = fclDeviceContexts.find(&device);
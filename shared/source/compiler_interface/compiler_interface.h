@@ -14,7 +14,11 @@
 #include "ocl_igc_interface/fcl_ocl_device_ctx.h"
 #include "ocl_igc_interface/igc_ocl_device_ctx.h"
 
+#include <deque>
 #include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
 #include <unordered_map>
 
 namespace NEO {
@@ -80,6 +84,23 @@ struct TranslationOutput {
     static void makeCopy(MemAndSize &dst, CIF::Builtins::BufferSimple *src);
 };
 
+struct FrontendIrCacheEntry {
+    // inputs are kept to tell apart sources sharing the same key hash
+    bool matches(const TranslationInput &input) const {
+        return source == std::string_view(input.src.begin(), input.src.size()) &&
+               apiOptions == std::string_view(input.apiOptions.begin(), input.apiOptions.size()) &&
+               internalOptions == std::string_view(input.internalOptions.begin(), input.internalOptions.size());
+    }
+
+    std::string source;
+    std::string apiOptions;
+    std::string internalOptions;
+    std::string intermediateRepresentation;
+    std::string frontendCompilerLog;
+};
+
+inline constexpr size_t maxFrontendIrCacheEntries = 64;
+
 struct SpecConstantInfo {
     CIF::RAII::UPtr_t<CIF::Builtins::BufferLatest> idsBuffer;
     CIF::RAII::UPtr_t<CIF::Builtins::BufferLatest> sizesBuffer;
@@ -151,6 +172,15 @@ class CompilerInterface {
     std::map<const Device *, fclDevCtxUptr> fclDeviceContexts;
     CIF::RAII::UPtr_t<IGC::FclOclTranslationCtxTagOCL> fclBaseTranslationCtx = nullptr;
 
+    std::mutex frontendIrCacheMutex;
+    std::unordered_map<uint64_t, FrontendIrCacheEntry> frontendIrCache;
+    std::deque<uint64_t> frontendIrCacheOrder;
+
+    bool isFrontendIrCacheEnabled() const;
+    uint64_t getFrontendIrCacheKey(const Device &device, const TranslationInput &input, IGC::CodeType::CodeType_t intermediateCodeType) const;
+    bool loadFrontendIr(uint64_t key, const TranslationInput &input, TranslationOutput &output);
+    void storeFrontendIr(uint64_t key, const TranslationInput &input, const TranslationOutput &output);
+
     MOCKABLE_VIRTUAL IGC::FclOclDeviceCtxTagOCL *getFclDeviceCtx(const Device &device);
     MOCKABLE_VIRTUAL IGC::IgcOclDeviceCtxTagOCL *getIgcDeviceCtx(const Device &device);
     MOCKABLE_VIRTUAL IGC::CodeType::CodeType_t getPreferredIntermediateRepresentation(const Device &device);
@@ -25,9 +25,12 @@ DECLARE_DEBUG_VARIABLE(int32_t, AUBDumpFilterKernelEndIdx, -1, "End index of ker
 DECLARE_DEBUG_VARIABLE(int32_t, AUBDumpToggleCaptureOnOff, 0, "Toggle AUB capture on/off")
 DECLARE_DEBUG_VARIABLE(int32_t, AubDumpOverrideMmioRegister, 0, "Override mmio offset from list with new value from AubDumpOverrideMmioRegisterValue")
 DECLARE_DEBUG_VARIABLE(int32_t, AubDumpOverrideMmioRegisterValue, 0, "Value to override mmio offset from AubDumpOverrideMmioRegister")
+DECLARE_DEBUG_VARIABLE(int32_t, AubDumpWriteBufferSizeInKb, -1, "-1: default (unbuffered), >0: size in KB of the write buffer that is flushed to the AUB file on a background thread")
+DECLARE_DEBUG_VARIABLE(int32_t, SimulatedMemoryWriteDeduplication, -1, "-1: default (disabled), 0: disabled, 1: AUB and TBX skip rewriting unchanged pages of kernel ISA and constant surface allocations")
 DECLARE_DEBUG_VARIABLE(int32_t, ClDeviceGlobalMemSizeAvailablePercent, -1, "Percent of total GPU memory available; CL_DEVICE_GLOBAL_MEM_SIZE")
 DECLARE_DEBUG_VARIABLE(int32_t, SetCommandStreamReceiver, -1, "Set command stream receiver to: 0 - HW, 1 - AUB, 2 - TBX, 3 - HW & AUB, 4 - TBX & AUB")
 DECLARE_DEBUG_VARIABLE(int32_t, TbxPort, 4321, "TCP-IP port of TBX server")
+DECLARE_DEBUG_VARIABLE(int32_t, TbxWriteBatchSizeInKb, -1, "-1: default (every TBX request is sent separately), >0: size in KB of a batch gathering TBX write requests which is sent before any read request or when full")
 DECLARE_DEBUG_VARIABLE(int32_t, HBMSizePerTileInGigabytes, 0, "Size of HBM memory in GigaBytes per tile.")
 DECLARE_DEBUG_VARIABLE(bool, TbxFrontdoorMode, false, "Set TBX frontdoor mode for read and write memory accesses (the default mode is via backdoor)")
 DECLARE_DEBUG_VARIABLE(bool, FlattenBatchBufferForAUBDump, false, "Dump multi-level batch buffers to AUB as single, flat batch buffer")
@@ -309,6 +312,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsCopy, -1, "-1: default, 0:disabled, 1: e
 DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsMask, 0, "0: default, >0: bitmask: indicates bcs engines for split")
 DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsMaskH2D, 0, "0: default, >0: bitmask: indicates bcs engines for H2D split")
 DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsMaskD2H, 0, "0: default, >0: bitmask: indicates bcs engines for D2H split")
+DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsMinChunkSize, -1, "-1: default (1MB), >0: minimal size in bytes of a single split chunk, limits number of bcs engines used for a split copy")
 DECLARE_DEBUG_VARIABLE(int32_t, ReuseKernelBinaries, -1, "-1: default, 0:disabled, 1: enabled. If enabled, driver reuses kernel binaries.")
 DECLARE_DEBUG_VARIABLE(int32_t, SetAmountOfReusableAllocations, -1, "-1: default, 0:disabled, > 1: enabled. If enabled, driver will fill reusable allocation lists with given amount of command buffers and heaps at initialization of immediate command list.")
 DECLARE_DEBUG_VARIABLE(int32_t, UseHighAlignmentForHeapExtended, -1, "-1: default, 0:disabled, > 1: enabled. If enabled, driver aligns HEAP_EXTENDED allocations to GPU VA that is next power of 2 for a given size, if disables GPU VA is using 2MB/64KB alignment.")
@@ -458,7 +462,18 @@ DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalD2HCpuCopyThreshold, -1, "Override d
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalCopyThroughLock, -1, "Experimentally copy memory through locked ptr. -1: default 0: disable 1: enable ")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalForceCopyThroughLock, -1, "Force copy through lock pointer on zeAppendMemoryCopy for all cases -1: default 0: disable 1: enable ")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalSmallBufferPoolAllocator, -1, "Experimentally enable pool allocator for clCreateBuffer under 4KB.")
+DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalBufferPoolSizeClasses, -1, "Number of buffer pool size classes used when pool allocator is enabled. -1: default (1), 1: up to 4KB in 64KB pools, 2: also up to 64KB in 2MB pools, 3: also up to 1MB in 16MB pools")
+DECLARE_DEBUG_VARIABLE(int64_t, ExperimentalHostPtrFragmentCacheSize, -1, "Keep released host pointer fragments pinned for reuse by later allocations from the same host memory, up to given total size. Host memory must stay mapped until the fragments are released. -1: default (disabled), >0: cache size in bytes")
+DECLARE_DEBUG_VARIABLE(int64_t, ExperimentalMemObjReleaseQueueSize, -1, "Free allocations of released memory objects in groups sharing the same last used task counts through the deferred deleter, releasing blocks only when pending allocations exceed given total size. -1: default (disabled), >0: max pending size in bytes")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalCopyThroughLockWaitlistSizeThreshold, -1, "If less than given value, driver will wait for Waitlist on host, instead of sending appendBarrier. If 0, always use barrier.")
+DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalImmediateCmdListSubmissionBatching, -1, "Experimentally batch kernel appends without signal event on immediate command lists into single submission. -1: default (disabled), 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalImmediateCmdListBatchingSizeThreshold, -1, "Flush batched immediate command list appends when batched commands reach given size in bytes. -1: default (16KB), >=0: size in bytes")
+DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalImmediateCmdListBatchingTimeThreshold, -1, "Flush batched immediate command list appends when batch is older than given time in microseconds. -1: default (100us), >=0: time in microseconds")
+DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalCpuCopyStreaming, -1, "Use non-temporal stores for CPU copies into allocations. -1: default (only for write-combined destinations), 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuCopyThreadCount, -1, "Maximal number of threads used for a single large CPU copy. -1: default (up to 4), 0 or 1: single thread, >1: number of threads")
+DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalSysmanTelemetrySamplingInterval, -1, "Experimentally sample sysman power, engine and frequency counters on a background thread and serve queries from the latest sample. -1: default (disabled), >0: sampling interval in milliseconds")
+DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalSysmanTelemetrySampleCount, -1, "Number of samples kept per counter by the sysman telemetry sampler. -1: default (64), >0: number of samples")
+DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalEnableClCommandBuffer, -1, "Experimentally expose cl_khr_command_buffer extension. -1: default (disabled), 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(bool, ExperimentalEnableSourceLevelDebugger, false, "Experimentally enable source level debugger.")
 DECLARE_DEBUG_VARIABLE(bool, ExperimentalEnableL0DebuggerForOpenCL, false, "Experimentally enable debugging OCL with L0 Debug API. When enabled - Level Zero debugging is disabled.")
 DECLARE_DEBUG_VARIABLE(bool, ExperimentalEnableTileAttach, true, "Experimentally enable attaching to tiles (subdevices).")
@@ -521,6 +536,10 @@ DECLARE_DEBUG_VARIABLE(int32_t, SelectCmdListHeapAddressModel, -1, "-1: default,
 DECLARE_DEBUG_VARIABLE(int32_t, EnableSetPair, -1, "Use SET_PAIR to pair two buffer objects behind the same file descriptor, -1: default, 0: disabled, 1: enabled")
 /* Binary Cache */
 DECLARE_DEBUG_VARIABLE(bool, BinaryCacheTrace, false, "enable cl_cache to produce .trace files with information about hash computation")
+DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalEnableFrontendIrCache, -1, "Reuse frontend compiler output for builds with identical source, options and platform. -1: default (disabled), 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalParallelProgramBuild, -1, "Compile OpenCL programs for root devices concurrently and compile once per distinct hardware configuration. -1: default (disabled), 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalGroupCsrDependencies, -1, "Resolve timestamp packet dependencies of a wait list once per event source: duplicated containers are skipped and only the latest event of each in-order queue is waited for. -1: default (disabled), 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalLocalWorkSizeTuning, -1, "Time local work size candidates of kernels enqueued without local work size and use the fastest one for later enqueues, winners are stored in compiler cache directory. -1: default (disabled), 0: disabled, >0: number of timed launches per candidate")
 
 /* WORKAROUND FLAGS */
 DECLARE_DEBUG_VARIABLE(int32_t, ForceDummyBlitWa, 0, "-1: default, 0: disabled, 1: enabled, Forces a workaround with dummy blits, driver adds an extra blit before command MI_ARB_CHECK on bcs")
@@ -22,10 +22,11 @@
 #include "shared/source/os_interface/os_environment.h"
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/os_interface/product_helper.h"
+#include "shared/source/utilities/cpu_copy.h"
 #include "shared/source/utilities/wait_util.h"
 
 namespace NEO {
-ExecutionEnvironment::ExecutionEnvironment() {
+ExecutionEnvironment::ExecutionEnvironment() : cpuCopyThreadPool(std::make_unique<CpuCopy::CopyThreadPool>()) {
     WaitUtils::init();
     this->configureNeoEnvironment();
 }
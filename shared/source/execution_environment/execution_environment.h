@@ -13,6 +13,9 @@
 #include <vector>
 
 namespace NEO {
+namespace CpuCopy {
+class CopyThreadPool;
+}
 class DirectSubmissionController;
 class MemoryManager;
 struct OsEnvironment;
@@ -50,6 +53,7 @@ class ExecutionEnvironment : public ReferenceTrackedObject<ExecutionEnvironment>
 
     DirectSubmissionController *initializeDirectSubmissionController();
 
+    std::unique_ptr<CpuCopy::CopyThreadPool> cpuCopyThreadPool;
     std::unique_ptr<MemoryManager> memoryManager;
     std::unique_ptr<DirectSubmissionController> directSubmissionController;
     std::unique_ptr<OsEnvironment> osEnvironment;
@@ -7,6 +7,7 @@
 
 #include "shared/source/command_container/command_encoder.h"
 #include "shared/source/gmm_helper/gmm_helper.h"
+#include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/blit_properties.h"
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/register_offsets.h"
@@ -462,8 +463,8 @@ template <typename GfxFamily>
 size_t BlitCommandsHelper<GfxFamily>::getNumberOfBlitsForCopyRegion(const Vec3<size_t> &copySize, const RootDeviceEnvironment &rootDeviceEnvironment, bool isSystemMemoryPoolUsed) {
     auto maxWidthToCopy = getMaxBlitWidth(rootDeviceEnvironment);
     auto maxHeightToCopy = getMaxBlitHeight(rootDeviceEnvironment, isSystemMemoryPoolUsed);
-    auto xBlits = static_cast<size_t>(std::ceil(copySize.x / static_cast<double>(maxWidthToCopy)));
-    auto yBlits = static_cast<size_t>(std::ceil(copySize.y / static_cast<double>(maxHeightToCopy)));
+    auto xBlits = Math::divideAndRoundUp(copySize.x, static_cast<size_t>(maxWidthToCopy));
+    auto yBlits = Math::divideAndRoundUp(copySize.y, static_cast<size_t>(maxHeightToCopy));
     auto zBlits = static_cast<size_t>(copySize.z);
     auto nBlits = xBlits * yBlits * zBlits;
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2022 Intel Corporation
+ * Copyright (C) 2018-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,7 @@
 #pragma once
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 
 namespace NEO {
 // clang-format off
@@ -104,6 +105,37 @@ class Hash {
     uint32_t a, hi, lo;
 };
 
+// Fast non-cryptographic hash of memory contents; four independent lanes let the compiler vectorize the main loop
+inline uint64_t hashMemoryContents(const void *data, size_t size) {
+    constexpr uint64_t prime1 = 0x9E3779B185EBCA87ull;
+    constexpr uint64_t prime2 = 0xC2B2AE3D27D4EB4Full;
+    constexpr uint64_t prime3 = 0x165667B19E3779F9ull;
+    auto rotateLeft = [](uint64_t value, uint32_t shift) { return (value << shift) | (value >> (64 - shift)); };
+
+    auto bytes = static_cast<const uint8_t *>(data);
+    uint64_t lanes[4] = {prime1 + prime2, prime2, 0, 0 - prime1};
+    size_t offset = 0;
+    for (; offset + sizeof(lanes) <= size; offset += sizeof(lanes)) {
+        for (uint32_t lane = 0; lane < 4; lane++) {
+            uint64_t value;
+            memcpy(&value, bytes + offset + lane * sizeof(uint64_t), sizeof(uint64_t));
+            lanes[lane] = rotateLeft(lanes[lane] + value * prime2, 31) * prime1;
+        }
+    }
+
+    uint64_t hash = rotateLeft(lanes[0], 1) + rotateLeft(lanes[1], 7) + rotateLeft(lanes[2], 12) + rotateLeft(lanes[3], 18) + size;
+    for (; offset < size; offset++) {
+        hash = rotateLeft(hash ^ (bytes[offset] * prime3), 11) * prime1;
+    }
+
+    hash ^= hash >> 33;
+    hash *= prime2;
+    hash ^= hash >> 29;
+    hash *= prime3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
 template <typename T>
 uint32_t hashPtrToU32(const T *src) {
     auto asInt = reinterpret_cast<uintptr_t>(src);
@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/memory_manager/allocations_release_queue.h"
+
+#include "shared/source/helpers/engine_control.h"
+#include "shared/source/memory_manager/deferrable_allocation_deletion.h"
+#include "shared/source/memory_manager/deferred_deleter.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/os_interface/os_context.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+AllocationsReleaseQueue::AllocationsReleaseQueue(MemoryManager &memoryManager, size_t maxPendingSize) : memoryManager(memoryManager),
+                                                                                                        maxPendingSize(maxPendingSize) {
+    if (!memoryManager.isAsyncDeleterEnabled()) {
+        ownDeleter = std::make_unique<DeferredDeleter>();
+    }
+    memoryManager.registerAllocationsReleaseQueue(this);
+}
+
+AllocationsReleaseQueue::~AllocationsReleaseQueue() {
+    memoryManager.unregisterAllocationsReleaseQueue(this);
+    drain();
+}
+
+bool AllocationsReleaseQueue::deferRelease(GraphicsAllocation &allocation) {
+    if (!allocation.isUsed() || allocation.isUsedByManyOsContexts()) {
+        return false;
+    }
+
+    std::vector<TaskCountType> taskCounts;
+    for (auto &engine : memoryManager.getRegisteredEngines()) {
+        auto contextId = engine.osContext->getContextId();
+        if (allocation.isUsedByOsContext(contextId)) {
+            if (contextId >= taskCounts.size()) {
+                taskCounts.resize(contextId + 1, GraphicsAllocation::objectNotUsed);
+            }
+            taskCounts[contextId] = allocation.getTaskCount(contextId);
+        }
+    }
+
+    const auto allocationSize = allocation.getUnderlyingBufferSize();
+    std::shared_ptr<AllocationsGroup> newGroup;
+    size_t pendingSize = 0u;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        bool addedToLastGroup = false;
+        if (!groups.empty()) {
+            auto &lastGroup = groups.back();
+            std::lock_guard<std::mutex> groupLock(lastGroup->mtx);
+            if (!lastGroup->released && lastGroup->taskCounts == taskCounts) {
+                lastGroup->allocations.push_back(&allocation);
+                lastGroup->size += allocationSize;
+                addedToLastGroup = true;
+            }
+        }
+
+        if (!addedToLastGroup) {
+            newGroup = std::make_shared<AllocationsGroup>();
+            newGroup->taskCounts = std::move(taskCounts);
+            newGroup->allocations.push_back(&allocation);
+            newGroup->size = allocationSize;
+            groups.push_back(newGroup);
+        }
+        pendingSize = removeReleasedGroups();
+    }
+
+    if (newGroup) {
+        getDeleter().deferDeletion(new DeferrableAllocationsGroupDeletion{memoryManager, std::move(newGroup)});
+    }
+
+    if (pendingSize > maxPendingSize) {
+        // only groups of this queue are waited for, oldest first and just until the limit is met again
+        std::vector<std::shared_ptr<AllocationsGroup>> pendingGroups;
+        appendPendingGroups(pendingGroups);
+        for (auto &group : pendingGroups) {
+            if (getPendingSize() <= maxPendingSize) {
+                break;
+            }
+            group->release(memoryManager, true);
+        }
+    }
+    getDeleter().clearQueueTillFirstFailure();
+    return true;
+}
+
+void AllocationsReleaseQueue::drain() {
+    std::vector<std::shared_ptr<AllocationsGroup>> pendingGroups;
+    appendPendingGroups(pendingGroups);
+    for (auto &group : pendingGroups) {
+        group->release(memoryManager, true);
+    }
+    getPendingSize();
+}
+
+void AllocationsReleaseQueue::appendPendingGroups(std::vector<std::shared_ptr<AllocationsGroup>> &pendingGroups) {
+    std::lock_guard<std::mutex> lock(mtx);
+    removeReleasedGroups();
+    pendingGroups.insert(pendingGroups.end(), groups.begin(), groups.end());
+}
+
+size_t AllocationsReleaseQueue::getPendingSize() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return removeReleasedGroups();
+}
+
+size_t AllocationsReleaseQueue::removeReleasedGroups() {
+    // called with mtx held, returns the size of allocations still waiting to be freed
+    size_t pendingSize = 0u;
+    auto isReleased = [&pendingSize](const std::shared_ptr<AllocationsGroup> &group) {
+        std::lock_guard<std::mutex> groupLock(group->mtx);
+        pendingSize += group->released ? 0u : group->size;
+        return group->released;
+    };
+    groups.erase(std::remove_if(groups.begin(), groups.end(), isReleased), groups.end());
+    return pendingSize;
+}
+
+DeferredDeleter &AllocationsReleaseQueue::getDeleter() const {
+    return ownDeleter ? *ownDeleter : *memoryManager.getDeferredDeleter();
+}
+} // namespace NEO
@@ -0,0 +1,47 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/command_stream/task_count_helper.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class DeferredDeleter;
+class GraphicsAllocation;
+class MemoryManager;
+struct AllocationsGroup;
+
+// Released allocations are handed over to the deferred deleter right away. An allocation last used by the same
+// task counts as the most recently submitted group joins that group while it is still queued, so a whole group
+// is freed once all of its task counts are completed. Allocations used by many os contexts are not accepted,
+// they go through MemoryManager::checkGpuUsageAndDestroyGraphicsAllocations.
+class AllocationsReleaseQueue : NonCopyableOrMovableClass {
+  public:
+    AllocationsReleaseQueue(MemoryManager &memoryManager, size_t maxPendingSize);
+    ~AllocationsReleaseQueue();
+
+    bool deferRelease(GraphicsAllocation &allocation);
+    void drain();
+    void appendPendingGroups(std::vector<std::shared_ptr<AllocationsGroup>> &pendingGroups);
+
+    size_t getPendingSize();
+
+  protected:
+    size_t removeReleasedGroups();
+    DeferredDeleter &getDeleter() const;
+
+    MemoryManager &memoryManager;
+    const size_t maxPendingSize;
+    std::unique_ptr<DeferredDeleter> ownDeleter;
+    std::vector<std::shared_ptr<AllocationsGroup>> groups;
+    std::mutex mtx;
+};
+} // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2022 Intel Corporation
+ * Copyright (C) 2018-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,7 +8,10 @@
 #include "shared/source/memory_manager/deferrable_allocation_deletion.h"
 
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/command_stream/csr_definitions.h"
+#include "shared/source/command_stream/wait_status.h"
 #include "shared/source/helpers/engine_control.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
 
@@ -39,4 +42,41 @@ bool DeferrableAllocationDeletion::apply() {
     memoryManager.freeGraphicsMemory(&graphicsAllocation);
     return true;
 }
+
+bool AllocationsGroup::release(MemoryManager &memoryManager, bool waitForCompletion) {
+    std::lock_guard<std::mutex> lock(mtx);
+    if (released) {
+        return true;
+    }
+    for (auto &engine : memoryManager.getRegisteredEngines()) {
+        auto contextId = engine.osContext->getContextId();
+        if (contextId >= taskCounts.size() || taskCounts[contextId] == GraphicsAllocation::objectNotUsed) {
+            continue;
+        }
+        auto commandStreamReceiver = engine.commandStreamReceiver;
+        if (!commandStreamReceiver->testTaskCountReady(commandStreamReceiver->getTagAddress(), taskCounts[contextId])) {
+            if (waitForCompletion) {
+                commandStreamReceiver->waitForCompletionWithTimeout(WaitParams{false, false, TimeoutControls::maxTimeout}, taskCounts[contextId]);
+                continue;
+            }
+            if (commandStreamReceiver->peekLatestFlushedTaskCount() < taskCounts[contextId]) {
+                commandStreamReceiver->updateTagFromWait();
+            }
+            return false;
+        }
+    }
+    for (auto graphicsAllocation : allocations) {
+        memoryManager.freeGraphicsMemory(graphicsAllocation);
+    }
+    allocations.clear();
+    released = true;
+    return true;
+}
+
+DeferrableAllocationsGroupDeletion::DeferrableAllocationsGroupDeletion(MemoryManager &memoryManager, std::shared_ptr<AllocationsGroup> group)
+    : memoryManager(memoryManager), group(std::move(group)) {}
+
+bool DeferrableAllocationsGroupDeletion::apply() {
+    return group->release(memoryManager, false);
+}
 } // namespace NEO
@@ -1,13 +1,18 @@
 /*
- * Copyright (C) 2020-2021 Intel Corporation
+ * Copyright (C) 2020-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #pragma once
+#include "shared/source/command_stream/task_count_helper.h"
 #include "shared/source/memory_manager/deferrable_deletion.h"
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 namespace NEO {
 
 class GraphicsAllocation;
@@ -22,4 +27,26 @@ class DeferrableAllocationDeletion : public DeferrableDeletion {
     MemoryManager &memoryManager;
     GraphicsAllocation &graphicsAllocation;
 };
+
+// Allocations last used by the same task counts, the group may grow until it is released
+struct AllocationsGroup {
+    // returns true once the group is freed, waits for its task counts only when waitForCompletion is set
+    bool release(MemoryManager &memoryManager, bool waitForCompletion);
+
+    std::vector<TaskCountType> taskCounts;
+    std::vector<GraphicsAllocation *> allocations;
+    size_t size = 0u;
+    bool released = false;
+    std::mutex mtx;
+};
+
+class DeferrableAllocationsGroupDeletion : public DeferrableDeletion {
+  public:
+    DeferrableAllocationsGroupDeletion(MemoryManager &memoryManager, std::shared_ptr<AllocationsGroup> group);
+    bool apply() override;
+
+  protected:
+    MemoryManager &memoryManager;
+    std::shared_ptr<AllocationsGroup> group;
+};
 } // namespace NEO
@@ -16,6 +16,8 @@
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/utilities/logger.h"
 
+#include <mutex>
+
 namespace NEO {
 void GraphicsAllocation::setAllocationType(AllocationType allocationType) {
     if (this->allocationType != allocationType) {
@@ -87,6 +89,19 @@ bool GraphicsAllocation::isAllocationLockable() const {
     return 0 == gmm->resourceParams.Flags.Info.NotLockable;
 }
 
+WrittenPagesInfo &GraphicsAllocation::getAubWrittenPages(uint32_t contextId) {
+    // command stream receivers of different contexts may add their entries concurrently
+    static std::mutex writtenPagesMutex;
+    std::lock_guard<std::mutex> lock(writtenPagesMutex);
+    return aubInfo.aubWrittenPages[contextId];
+}
+
+WrittenPagesInfo &GraphicsAllocation::getTbxWrittenPages(uint32_t contextId) {
+    static std::mutex writtenPagesMutex;
+    std::lock_guard<std::mutex> lock(writtenPagesMutex);
+    return aubInfo.tbxWrittenPages[contextId];
+}
+
 void GraphicsAllocation::setAubWritable(bool writable, uint32_t banks) {
     UNRECOVERABLE_IF(banks == 0);
     aubInfo.aubWritable = static_cast<uint32_t>(setBits(aubInfo.aubWritable, writable, banks));
@@ -18,6 +18,9 @@
 #include "shared/source/memory_manager/residency.h"
 #include "shared/source/utilities/idlist.h"
 
+#include <map>
+#include <vector>
+
 namespace NEO {
 
 using osHandle = unsigned int;
@@ -36,6 +39,12 @@ class Gmm;
 class MemoryManager;
 class CommandStreamReceiver;
 
+struct WrittenPagesInfo {
+    std::vector<uint64_t> pageHashes;
+    std::vector<uint8_t> writtenContents;
+    uint32_t banks = 0;
+};
+
 struct AubInfo {
     uint32_t aubWritable = std::numeric_limits<uint32_t>::max();
     uint32_t tbxWritable = std::numeric_limits<uint32_t>::max();
@@ -43,6 +52,8 @@ struct AubInfo {
     bool bcsDumpOnly = false;
     bool memObjectsAllocationWithWritableFlags = false;
     bool writeMemoryOnly = false;
+    std::map<uint32_t, WrittenPagesInfo> aubWrittenPages;
+    std::map<uint32_t, WrittenPagesInfo> tbxWrittenPages;
 };
 
 class GraphicsAllocation : public IDNode<GraphicsAllocation> {
@@ -135,6 +146,8 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation> {
     }
     bool isAllocDumpable() const { return aubInfo.allocDumpable; }
     bool isMemObjectsAllocationWithWritableFlags() const { return aubInfo.memObjectsAllocationWithWritableFlags; }
+    WrittenPagesInfo &getAubWrittenPages(uint32_t contextId);
+    WrittenPagesInfo &getTbxWrittenPages(uint32_t contextId);
     void setMemObjectsAllocationWithWritableFlags(bool newValue) { aubInfo.memObjectsAllocationWithWritableFlags = newValue; }
 
     void incReuseCount() { sharingInfo.reuseCount++; }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2022 Intel Corporation
+ * Copyright (C) 2018-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,10 +7,13 @@
 
 #include "shared/source/memory_manager/host_ptr_manager.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/abort.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/memory_manager/memory_manager.h"
 
+#include <algorithm>
+
 using namespace NEO;
 
 HostPtrFragmentsContainer::iterator HostPtrManager::findElement(HostPtrEntryKey key) {
@@ -95,7 +98,7 @@ OsHandleStorage HostPtrManager::populateAlreadyAllocatedFragments(AllocationRequ
                                                                           requirements.allocationFragments[i].allocationSize, overlapStatus);
         if (overlapStatus == OverlapStatus::FRAGMENT_WITHIN_STORED_FRAGMENT) {
             UNRECOVERABLE_IF(fragmentStorage == nullptr);
-            fragmentStorage->refCount++;
+            retainFragment(requirements.rootDeviceIndex, *fragmentStorage);
             handleStorage.fragmentStorageData[i].osHandleStorage = fragmentStorage->osInternalStorage;
             handleStorage.fragmentStorageData[i].cpuPtr = requirements.allocationFragments[i].allocationPtr;
             handleStorage.fragmentStorageData[i].fragmentSize = requirements.allocationFragments[i].allocationSize;
@@ -103,7 +106,7 @@ OsHandleStorage HostPtrManager::populateAlreadyAllocatedFragments(AllocationRequ
         } else if (overlapStatus != OverlapStatus::FRAGMENT_OVERLAPING_AND_BIGGER_THEN_STORED_FRAGMENT) {
             if (fragmentStorage != nullptr) {
                 DEBUG_BREAK_IF(overlapStatus != OverlapStatus::FRAGMENT_WITH_EXACT_SIZE_AS_STORED_FRAGMENT);
-                fragmentStorage->refCount++;
+                retainFragment(requirements.rootDeviceIndex, *fragmentStorage);
                 handleStorage.fragmentStorageData[i].osHandleStorage = fragmentStorage->osInternalStorage;
                 handleStorage.fragmentStorageData[i].residency = fragmentStorage->residency;
             } else {
@@ -126,7 +129,7 @@ void HostPtrManager::storeFragment(uint32_t rootDeviceIndex, FragmentStorage &fr
     HostPtrEntryKey key{fragment.fragmentCpuPointer, rootDeviceIndex};
     auto element = findElement(key);
     if (element != partialAllocations.end()) {
-        element->second.refCount++;
+        retainFragment(rootDeviceIndex, element->second);
     } else {
         fragment.refCount++;
         partialAllocations.insert(std::pair<HostPtrEntryKey, FragmentStorage>(key, fragment));
@@ -163,7 +166,7 @@ bool HostPtrManager::releaseHostPtr(uint32_t rootDeviceIndex, const void *ptr) {
     DEBUG_BREAK_IF(element == partialAllocations.end());
 
     element->second.refCount--;
-    if (element->second.refCount <= 0) {
+    if (element->second.refCount <= 0 && !cacheReleasedFragment(element)) {
         fragmentReadyToBeReleased = true;
         partialAllocations.erase(element);
     }
@@ -171,6 +174,103 @@ bool HostPtrManager::releaseHostPtr(uint32_t rootDeviceIndex, const void *ptr) {
     return fragmentReadyToBeReleased;
 }
 
+void HostPtrManager::retainFragment(uint32_t rootDeviceIndex, FragmentStorage &fragment) {
+    if (fragment.refCount == 0) {
+        auto cachedFragment = std::find_if(cachedFragments.begin(), cachedFragments.end(), [&](const HostPtrEntryKey &key) {
+            return key.ptr == fragment.fragmentCpuPointer && key.rootDeviceIndex == rootDeviceIndex;
+        });
+        if (cachedFragment != cachedFragments.end()) {
+            cachedFragments.erase(cachedFragment);
+            cachedFragmentsSize -= fragment.fragmentSize;
+        }
+    }
+    fragment.refCount++;
+}
+
+size_t HostPtrManager::getFragmentCacheSize() {
+    return static_cast<size_t>(std::max(DebugManager.flags.ExperimentalHostPtrFragmentCacheSize.get(), static_cast<int64_t>(0)));
+}
+
+bool HostPtrManager::cacheReleasedFragment(HostPtrFragmentsContainer::iterator element) {
+    auto &fragment = element->second;
+    auto fragmentCacheSize = getFragmentCacheSize();
+    if (fragmentCacheSize == 0 || fragment.driverAllocation || fragment.refCount != 0 || fragment.fragmentSize > fragmentCacheSize) {
+        return false;
+    }
+    cachedFragments.push_back(element->first);
+    cachedFragmentsSize += fragment.fragmentSize;
+    return true;
+}
+
+void HostPtrManager::freeCachedFragment(MemoryManager &memoryManager, HostPtrEntryKey key) {
+    auto element = partialAllocations.find(key);
+    UNRECOVERABLE_IF(element == partialAllocations.end() || element->second.refCount != 0);
+    auto &fragment = element->second;
+
+    OsHandleStorage handleStorage;
+    handleStorage.fragmentCount = 1;
+    handleStorage.fragmentStorageData[0].cpuPtr = fragment.fragmentCpuPointer;
+    handleStorage.fragmentStorageData[0].fragmentSize = fragment.fragmentSize;
+    handleStorage.fragmentStorageData[0].osHandleStorage = fragment.osInternalStorage;
+    handleStorage.fragmentStorageData[0].residency = fragment.residency;
+    handleStorage.fragmentStorageData[0].freeTheFragment = true;
+
+    cachedFragments.erase(std::find_if(cachedFragments.begin(), cachedFragments.end(), [&](const HostPtrEntryKey &cachedKey) {
+        return cachedKey.ptr == key.ptr && cachedKey.rootDeviceIndex == key.rootDeviceIndex;
+    }));
+    cachedFragmentsSize -= fragment.fragmentSize;
+    partialAllocations.erase(element);
+
+    memoryManager.cleanOsHandles(handleStorage, key.rootDeviceIndex);
+}
+
+void HostPtrManager::trimFragmentCache(MemoryManager &memoryManager) {
+    std::lock_guard<decltype(allocationsMutex)> lock(allocationsMutex);
+    auto fragmentCacheSize = getFragmentCacheSize();
+    while (!cachedFragments.empty() && cachedFragmentsSize > fragmentCacheSize) {
+        freeCachedFragment(memoryManager, cachedFragments.front());
+    }
+}
+
+void HostPtrManager::releaseCachedFragments(MemoryManager &memoryManager) {
+    std::lock_guard<decltype(allocationsMutex)> lock(allocationsMutex);
+    while (!cachedFragments.empty()) {
+        freeCachedFragment(memoryManager, cachedFragments.front());
+    }
+}
+
+// must be called before host memory backing cached fragments is unmapped, pinned pages would be stale otherwise
+void HostPtrManager::releaseCachedFragments(MemoryManager &memoryManager, uint32_t rootDeviceIndex, const void *ptr, size_t size) {
+    std::lock_guard<decltype(allocationsMutex)> lock(allocationsMutex);
+    releaseOverlappingCachedFragments(memoryManager, ptr, size, [rootDeviceIndex](uint32_t fragmentRootDeviceIndex) { return fragmentRootDeviceIndex == rootDeviceIndex; });
+}
+
+void HostPtrManager::releaseCachedFragments(MemoryManager &memoryManager, const void *ptr, size_t size) {
+    std::lock_guard<decltype(allocationsMutex)> lock(allocationsMutex);
+    releaseOverlappingCachedFragments(memoryManager, ptr, size, [](uint32_t fragmentRootDeviceIndex) { return true; });
+}
+
+void HostPtrManager::releaseOverlappingCachedFragments(MemoryManager &memoryManager, const void *ptr, size_t size, const std::function<bool(uint32_t)> &rootDeviceIndexMatches) {
+    if (cachedFragments.empty()) {
+        return;
+    }
+    auto startAddress = reinterpret_cast<uintptr_t>(ptr);
+    auto endAddress = startAddress + size;
+
+    std::vector<HostPtrEntryKey> fragmentsToRelease;
+    for (auto &key : cachedFragments) {
+        auto &fragment = partialAllocations.find(key)->second;
+        auto fragmentStartAddress = reinterpret_cast<uintptr_t>(fragment.fragmentCpuPointer);
+        auto fragmentEndAddress = fragmentStartAddress + fragment.fragmentSize;
+        if (rootDeviceIndexMatches(key.rootDeviceIndex) && fragmentStartAddress < endAddress && startAddress < fragmentEndAddress) {
+            fragmentsToRelease.push_back(key);
+        }
+    }
+    for (auto &key : fragmentsToRelease) {
+        freeCachedFragment(memoryManager, key);
+    }
+}
+
 FragmentStorage *HostPtrManager::getFragment(HostPtrEntryKey key) {
     std::lock_guard<decltype(allocationsMutex)> lock(allocationsMutex);
     auto element = findElement(key);
@@ -270,6 +370,14 @@ RequirementsStatus HostPtrManager::checkAllocationsForOverlapping(MemoryManager
 
         getFragmentAndCheckForOverlaps(requirements->rootDeviceIndex, requirements->allocationFragments[i].allocationPtr,
                                        requirements->allocationFragments[i].allocationSize, overlapStatus);
+        if (overlapStatus == OverlapStatus::FRAGMENT_OVERLAPING_AND_BIGGER_THEN_STORED_FRAGMENT && !cachedFragments.empty()) {
+            // drop cached fragments in the way
+            releaseCachedFragments(memoryManager, requirements->rootDeviceIndex, requirements->allocationFragments[i].allocationPtr,
+                                   requirements->allocationFragments[i].allocationSize);
+
+            getFragmentAndCheckForOverlaps(requirements->rootDeviceIndex, requirements->allocationFragments[i].allocationPtr,
+                                           requirements->allocationFragments[i].allocationSize, overlapStatus);
+        }
         if (overlapStatus == OverlapStatus::FRAGMENT_OVERLAPING_AND_BIGGER_THEN_STORED_FRAGMENT) {
             // clean temporary allocations
             memoryManager.cleanTemporaryAllocationListOnAllEngines(false);
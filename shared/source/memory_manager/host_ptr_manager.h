@@ -6,8 +6,10 @@
  */
 
 #pragma once
+#include <functional>
 #include <map>
 #include <mutex>
+#include <vector>
 
 namespace NEO {
 struct AllocationRequirements;
@@ -45,6 +47,10 @@ class HostPtrManager {
     void storeFragment(uint32_t rootDeviceIndex, AllocationStorageData &storageData);
     void storeFragment(uint32_t rootDeviceIndex, FragmentStorage &fragment);
     [[nodiscard]] std::unique_lock<std::recursive_mutex> obtainOwnership();
+    void trimFragmentCache(MemoryManager &memoryManager);
+    void releaseCachedFragments(MemoryManager &memoryManager);
+    void releaseCachedFragments(MemoryManager &memoryManager, uint32_t rootDeviceIndex, const void *ptr, size_t size);
+    void releaseCachedFragments(MemoryManager &memoryManager, const void *ptr, size_t size);
 
   protected:
     static AllocationRequirements getAllocationRequirements(uint32_t rootDeviceIndex, const void *inputPtr, size_t size);
@@ -53,7 +59,16 @@ class HostPtrManager {
     RequirementsStatus checkAllocationsForOverlapping(MemoryManager &memoryManager, AllocationRequirements *requirements);
 
     HostPtrFragmentsContainer::iterator findElement(HostPtrEntryKey key);
+    void retainFragment(uint32_t rootDeviceIndex, FragmentStorage &fragment);
+    bool cacheReleasedFragment(HostPtrFragmentsContainer::iterator element);
+    void freeCachedFragment(MemoryManager &memoryManager, HostPtrEntryKey key);
+    void releaseOverlappingCachedFragments(MemoryManager &memoryManager, const void *ptr, size_t size, const std::function<bool(uint32_t)> &rootDeviceIndexMatches);
+    static size_t getFragmentCacheSize();
+
     HostPtrFragmentsContainer partialAllocations;
+    // released fragments kept pinned for reuse, least recently released first
+    std::vector<HostPtrEntryKey> cachedFragments;
+    size_t cachedFragmentsSize = 0;
     std::recursive_mutex allocationsMutex;
 };
 } // namespace NEO
@@ -26,6 +26,7 @@
 #include "shared/source/helpers/string.h"
 #include "shared/source/helpers/surface_format_info.h"
 #include "shared/source/memory_manager/allocation_properties.h"
+#include "shared/source/memory_manager/allocations_release_queue.h"
 #include "shared/source/memory_manager/compression_selector.h"
 #include "shared/source/memory_manager/deferrable_allocation_deletion.h"
 #include "shared/source/memory_manager/deferred_deleter.h"
@@ -39,6 +40,7 @@
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/os_interface/product_helper.h"
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
+#include "shared/source/utilities/cpu_copy.h"
 
 #include <algorithm>
 
@@ -166,6 +168,7 @@ GraphicsAllocation *MemoryManager::allocateGraphicsMemoryWithHostPtr(const Alloc
         if (graphicsAllocation == nullptr) {
             hostPtrManager->releaseHandleStorage(allocationData.rootDeviceIndex, osStorage);
             cleanOsHandles(osStorage, allocationData.rootDeviceIndex);
+            hostPtrManager->trimFragmentCache(*this);
         }
     }
     return graphicsAllocation;
@@ -183,6 +186,7 @@ GraphicsAllocation *MemoryManager::allocateGraphicsMemoryForImageFromHostPtr(con
 void MemoryManager::cleanGraphicsMemoryCreatedFromHostPtr(GraphicsAllocation *graphicsAllocation) {
     hostPtrManager->releaseHandleStorage(graphicsAllocation->getRootDeviceIndex(), graphicsAllocation->fragmentsStorage);
     cleanOsHandles(graphicsAllocation->fragmentsStorage, graphicsAllocation->getRootDeviceIndex());
+    hostPtrManager->trimFragmentCache(*this);
 }
 
 void *MemoryManager::createMultiGraphicsAllocationInSystemMemoryPool(RootDeviceIndicesContainer &rootDeviceIndices, AllocationProperties &properties, MultiGraphicsAllocation &multiGraphicsAllocation, void *ptr) {
@@ -309,6 +313,33 @@ bool MemoryManager::isAsyncDeleterEnabled() const {
     return asyncDeleterEnabled;
 }
 
+void MemoryManager::registerAllocationsReleaseQueue(AllocationsReleaseQueue *releaseQueue) {
+    std::lock_guard<std::mutex> lock(allocationsReleaseQueuesMutex);
+    allocationsReleaseQueues.push_back(releaseQueue);
+}
+
+void MemoryManager::unregisterAllocationsReleaseQueue(AllocationsReleaseQueue *releaseQueue) {
+    std::lock_guard<std::mutex> lock(allocationsReleaseQueuesMutex);
+    allocationsReleaseQueues.erase(std::remove(allocationsReleaseQueues.begin(), allocationsReleaseQueues.end(), releaseQueue), allocationsReleaseQueues.end());
+}
+
+bool MemoryManager::drainAllocationsReleaseQueues() {
+    std::vector<std::shared_ptr<AllocationsGroup>> pendingGroups;
+    {
+        std::lock_guard<std::mutex> lock(allocationsReleaseQueuesMutex);
+        for (auto releaseQueue : allocationsReleaseQueues) {
+            releaseQueue->appendPendingGroups(pendingGroups);
+        }
+    }
+
+    // called when an allocation fails, so only groups whose task counts are already completed are freed
+    bool released = false;
+    for (auto &group : pendingGroups) {
+        released |= group->release(*this, false);
+    }
+    return released;
+}
+
 bool MemoryManager::isLocalMemorySupported(uint32_t rootDeviceIndex) const {
     return localMemorySupported[rootDeviceIndex];
 }
@@ -585,6 +616,10 @@ GraphicsAllocation *MemoryManager::allocateGraphicsMemoryInPreferredPool(const A
         allocation = nullptr;
     }
     if (!allocation) {
+        // memory of released objects may still be pending in release queues
+        if (drainAllocationsReleaseQueues()) {
+            return allocateGraphicsMemoryInPreferredPool(properties, hostPtr);
+        }
         return nullptr;
     }
 
@@ -791,9 +826,10 @@ bool MemoryManager::copyMemoryToAllocation(GraphicsAllocation *graphicsAllocatio
         return false;
     }
 
+    auto writeCombined = !MemoryPoolHelper::isSystemMemoryPool(graphicsAllocation->getMemoryPool());
     for (auto i = 0u; i < graphicsAllocation->storageInfo.getNumBanks(); ++i) {
-        memcpy_s(ptrOffset(static_cast<uint8_t *>(graphicsAllocation->getUnderlyingBuffer()) + i * graphicsAllocation->getUnderlyingBufferSize(), destinationOffset),
-                 (graphicsAllocation->getUnderlyingBufferSize() - destinationOffset), memoryToCopy, sizeToCopy);
+        CpuCopy::copy(ptrOffset(static_cast<uint8_t *>(graphicsAllocation->getUnderlyingBuffer()) + i * graphicsAllocation->getUnderlyingBufferSize(), destinationOffset),
+                      (graphicsAllocation->getUnderlyingBufferSize() - destinationOffset), memoryToCopy, sizeToCopy, writeCombined, executionEnvironment.cpuCopyThreadPool.get());
         if (!GraphicsAllocation::isDebugSurfaceAllocationType(graphicsAllocation->getAllocationType())) {
             break;
         }
@@ -802,8 +838,8 @@ bool MemoryManager::copyMemoryToAllocation(GraphicsAllocation *graphicsAllocatio
 }
 
 bool MemoryManager::copyMemoryToAllocationBanks(GraphicsAllocation *graphicsAllocation, size_t destinationOffset, const void *memoryToCopy, size_t sizeToCopy, DeviceBitfield handleMask) {
-    memcpy_s(ptrOffset(static_cast<uint8_t *>(graphicsAllocation->getUnderlyingBuffer()), destinationOffset),
-             (graphicsAllocation->getUnderlyingBufferSize() - destinationOffset), memoryToCopy, sizeToCopy);
+    CpuCopy::copy(ptrOffset(static_cast<uint8_t *>(graphicsAllocation->getUnderlyingBuffer()), destinationOffset),
+                  (graphicsAllocation->getUnderlyingBufferSize() - destinationOffset), memoryToCopy, sizeToCopy, !MemoryPoolHelper::isSystemMemoryPool(graphicsAllocation->getMemoryPool()), executionEnvironment.cpuCopyThreadPool.get());
     return true;
 }
 void MemoryManager::waitForEnginesCompletion(GraphicsAllocation &graphicsAllocation) {
@@ -1017,6 +1053,7 @@ OsContext *MemoryManager::getDefaultEngineContext(uint32_t rootDeviceIndex, Devi
 
 void MemoryManager::commonCleanup() {
     multiContextResourceDestructor->drain(false);
+    hostPtrManager->releaseCachedFragments(*this);
 }
 
 bool MemoryTransferHelper::transferMemoryToAllocation(bool useBlitter, const Device &device, GraphicsAllocation *dstAllocation, size_t dstOffset, const void *srcMemory, size_t srcSize) {
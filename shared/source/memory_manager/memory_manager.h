@@ -36,6 +36,7 @@ class GmmHelper;
 enum class DriverModelType;
 struct AllocationProperties;
 class LocalMemoryUsageBankSelector;
+class AllocationsReleaseQueue;
 class DeferredDeleter;
 class ExecutionEnvironment;
 class Gmm;
@@ -186,6 +187,9 @@ class MemoryManager {
     void cleanTemporaryAllocationListOnAllEngines(bool waitForCompletion);
 
     bool isAsyncDeleterEnabled() const;
+    void registerAllocationsReleaseQueue(AllocationsReleaseQueue *releaseQueue);
+    void unregisterAllocationsReleaseQueue(AllocationsReleaseQueue *releaseQueue);
+    bool drainAllocationsReleaseQueues();
     bool isLocalMemorySupported(uint32_t rootDeviceIndex) const;
     virtual bool isMemoryBudgetExhausted() const;
 
@@ -347,6 +351,8 @@ class MemoryManager {
     std::mutex virtualMemoryReservationMapMutex;
     std::map<void *, PhysicalMemoryAllocation *> physicalMemoryAllocationMap;
     std::mutex physicalMemoryAllocationMapMutex;
+    std::vector<AllocationsReleaseQueue *> allocationsReleaseQueues;
+    std::mutex allocationsReleaseQueuesMutex;
 };
 
 std::unique_ptr<DeferredDeleter> createDeferredDeleter();
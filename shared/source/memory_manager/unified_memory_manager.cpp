@@ -17,6 +17,7 @@
 #include "shared/source/helpers/memory_properties_helpers.h"
 #include "shared/source/memory_manager/allocation_properties.h"
 #include "shared/source/memory_manager/compression_selector.h"
+#include "shared/source/memory_manager/host_ptr_manager.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/os_interface/product_helper.h"
@@ -507,6 +508,10 @@ void SVMAllocsManager::freeSVMAllocImpl(void *ptr, FreePolicyType policy, SvmAll
     if (svmData->cpuAllocation && pageFaultManager) {
         pageFaultManager->removeAllocation(svmData->cpuAllocation->getUnderlyingBuffer());
     }
+    if (svmData->memoryType != InternalMemoryType::DEVICE_UNIFIED_MEMORY) {
+        // host memory of this allocation is released, host pointer fragments cached over it would pin stale pages
+        this->memoryManager->getHostPtrManager()->releaseCachedFragments(*this->memoryManager, ptr, svmData->size);
+    }
     if (svmData->gpuAllocations.getAllocationType() == AllocationType::SVM_ZERO_COPY) {
         freeZeroCopySvmAllocation(svmData);
     } else {
@@ -41,6 +41,7 @@
 #include "shared/source/os_interface/linux/memory_info.h"
 #include "shared/source/os_interface/linux/os_context_linux.h"
 #include "shared/source/os_interface/os_interface.h"
+#include "shared/source/utilities/cpu_copy.h"
 
 #include <cstring>
 #include <iostream>
@@ -1461,7 +1462,7 @@ bool DrmMemoryManager::copyMemoryToAllocationBanks(GraphicsAllocation *graphicsA
         if (!ptr) {
             return false;
         }
-        memcpy_s(ptrOffset(ptr, destinationOffset), graphicsAllocation->getUnderlyingBufferSize() - destinationOffset, memoryToCopy, sizeToCopy);
+        CpuCopy::copy(ptrOffset(ptr, destinationOffset), graphicsAllocation->getUnderlyingBufferSize() - destinationOffset, memoryToCopy, sizeToCopy, true, executionEnvironment.cpuCopyThreadPool.get());
         this->unlockBufferObject(drmAllocation->getBOs()[handleId]);
     }
     return true;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2020 Intel Corporation
+ * Copyright (C) 2018-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,8 @@
 
 #include "shared/source/tbx/tbx_sockets_imp.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/string.h"
 
@@ -20,6 +22,7 @@ typedef int socklen_t;
 #include <netdb.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/uio.h>
 #include <unistd.h>
 typedef struct sockaddr SOCKADDR;
 #define SOCKET_ERROR -1
@@ -34,10 +37,15 @@ namespace NEO {
 
 TbxSocketsImp::TbxSocketsImp(std::ostream &err)
     : cerrStream(err) {
+    if (DebugManager.flags.TbxWriteBatchSizeInKb.get() > 0) {
+        writeBatchSize = static_cast<size_t>(DebugManager.flags.TbxWriteBatchSizeInKb.get()) * MemoryConstants::kiloByte;
+        pendingWrites.reserve(writeBatchSize);
+    }
 }
 
 void TbxSocketsImp::close() {
     if (0 != m_socket) {
+        flushPendingWrites();
 #ifdef WIN32
         ::shutdown(m_socket, 0x02 /*SD_BOTH*/);
 
@@ -146,7 +154,7 @@ bool TbxSocketsImp::readMMIO(uint32_t offset, uint32_t *data) {
         cmd.u.mmio_req.msg_type = MSG_TYPE_MMIO;
         cmd.u.mmio_req.size = sizeof(uint32_t);
 
-        success = sendWriteData(&cmd, sizeof(HAS_HDR) + cmd.hdr.size);
+        success = queueWriteData(&cmd, sizeof(HAS_HDR) + cmd.hdr.size) && flushPendingWrites();
         if (!success) {
             break;
         }
@@ -183,7 +191,7 @@ bool TbxSocketsImp::writeMMIO(uint32_t offset, uint32_t value) {
     cmd.u.mmio_req.write = 1;
     cmd.u.mmio_req.size = sizeof(uint32_t);
 
-    return sendWriteData(&cmd, sizeof(HAS_HDR) + cmd.hdr.size);
+    return queueWriteData(&cmd, sizeof(HAS_HDR) + cmd.hdr.size);
 }
 
 bool TbxSocketsImp::readMemory(uint64_t addrOffset, void *data, size_t size) {
@@ -202,7 +210,7 @@ bool TbxSocketsImp::readMemory(uint64_t addrOffset, void *data, size_t size) {
 
     bool success;
     do {
-        success = sendWriteData(&cmd, sizeof(HAS_HDR) + sizeof(HAS_READ_DATA_REQ));
+        success = queueWriteData(&cmd, sizeof(HAS_HDR) + sizeof(HAS_READ_DATA_REQ)) && flushPendingWrites();
         if (!success) {
             break;
         }
@@ -244,12 +252,12 @@ bool TbxSocketsImp::writeMemory(uint64_t physAddr, const void *data, size_t size
 
     bool success;
     do {
-        success = sendWriteData(&cmd, sizeof(HAS_HDR) + sizeof(HAS_WRITE_DATA_REQ));
+        success = queueWriteData(&cmd, sizeof(HAS_HDR) + sizeof(HAS_WRITE_DATA_REQ));
         if (!success) {
             break;
         }
 
-        success = sendWriteData(data, size);
+        success = queueWriteData(data, size);
         if (!success) {
             cerrStream << "Problem sending write data?" << std::endl;
             break;
@@ -271,7 +279,33 @@ bool TbxSocketsImp::writeGTT(uint32_t offset, uint64_t entry) {
     cmd.u.gtt64_req.data = static_cast<uint32_t>(entry & 0xffffffff);
     cmd.u.gtt64_req.data_h = static_cast<uint32_t>(entry >> 32);
 
-    return sendWriteData(&cmd, sizeof(HAS_HDR) + cmd.hdr.size);
+    return queueWriteData(&cmd, sizeof(HAS_HDR) + cmd.hdr.size);
+}
+
+bool TbxSocketsImp::queueWriteData(const void *buffer, size_t sizeInBytes) {
+    if (writeBatchSize == 0) {
+        return sendWriteData(buffer, sizeInBytes);
+    }
+
+    if (pendingWrites.size() + sizeInBytes > writeBatchSize) {
+        auto success = sendWriteData(pendingWrites.data(), pendingWrites.size(), buffer, sizeInBytes);
+        pendingWrites.clear();
+        return success;
+    }
+
+    auto dataBuffer = reinterpret_cast<const char *>(buffer);
+    pendingWrites.insert(pendingWrites.end(), dataBuffer, dataBuffer + sizeInBytes);
+    return true;
+}
+
+bool TbxSocketsImp::flushPendingWrites() {
+    if (pendingWrites.empty()) {
+        return true;
+    }
+
+    auto success = sendWriteData(pendingWrites.data(), pendingWrites.size());
+    pendingWrites.clear();
+    return success;
 }
 
 bool TbxSocketsImp::sendWriteData(const void *buffer, size_t sizeInBytes) {
@@ -295,6 +329,48 @@ bool TbxSocketsImp::sendWriteData(const void *buffer, size_t sizeInBytes) {
     return true;
 }
 
+bool TbxSocketsImp::sendWriteData(const void *buffer0, size_t sizeInBytes0, const void *buffer1, size_t sizeInBytes1) {
+#ifdef WIN32
+    return sendWriteData(buffer0, sizeInBytes0) && sendWriteData(buffer1, sizeInBytes1);
+#else
+    iovec buffers[2] = {{const_cast<void *>(buffer0), sizeInBytes0},
+                        {const_cast<void *>(buffer1), sizeInBytes1}};
+    iovec *currentBuffer = buffers;
+    int buffersCount = 2;
+
+    while (buffersCount > 0) {
+        if (currentBuffer->iov_len == 0) {
+            currentBuffer++;
+            buffersCount--;
+            continue;
+        }
+
+        auto bytesSent = ::writev(m_socket, currentBuffer, buffersCount);
+        if (bytesSent == 0) {
+            logErrorInfo("Connection Closed.");
+            return false;
+        }
+
+        if (bytesSent == SOCKET_ERROR) {
+            logErrorInfo("Error on writev()");
+            return false;
+        }
+
+        auto bytesRemaining = static_cast<size_t>(bytesSent);
+        while (buffersCount > 0 && bytesRemaining >= currentBuffer->iov_len) {
+            bytesRemaining -= currentBuffer->iov_len;
+            currentBuffer++;
+            buffersCount--;
+        }
+        if (buffersCount > 0) {
+            currentBuffer->iov_base = static_cast<char *>(currentBuffer->iov_base) + bytesRemaining;
+            currentBuffer->iov_len -= bytesRemaining;
+        }
+    }
+    return true;
+#endif
+}
+
 bool TbxSocketsImp::getResponseData(void *buffer, size_t sizeInBytes) {
     size_t totalRecv = 0;
     auto dataBuffer = static_cast<char *>(buffer);
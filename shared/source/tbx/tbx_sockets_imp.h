@@ -12,6 +12,7 @@
 
 #include <cstdint>
 #include <iostream>
+#include <vector>
 
 namespace NEO {
 
@@ -37,6 +38,9 @@ class TbxSocketsImp : public TbxSockets {
 
     bool connectToServer(const std::string &hostNameOrIp, uint16_t port);
     bool sendWriteData(const void *buffer, size_t sizeInBytes);
+    bool sendWriteData(const void *buffer0, size_t sizeInBytes0, const void *buffer1, size_t sizeInBytes1);
+    bool queueWriteData(const void *buffer, size_t sizeInBytes);
+    bool flushPendingWrites();
     bool getResponseData(void *buffer, size_t sizeInBytes);
 
     inline uint32_t getNextTransID() { return transID++; }
@@ -44,5 +48,9 @@ class TbxSocketsImp : public TbxSockets {
     void logErrorInfo(const char *tag);
 
     uint32_t transID = 0;
+
+    // requests which don't expect a response are gathered and sent together, before any read or when the batch is full
+    std::vector<char> pendingWrites;
+    size_t writeBatchSize = 0;
 };
 } // namespace NEO
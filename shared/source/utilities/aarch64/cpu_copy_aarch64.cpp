@@ -0,0 +1,20 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/cpu_copy.h"
+
+#include <cstring>
+
+namespace NEO {
+namespace CpuCopy {
+
+void streamingCopy(void *dst, const void *src, size_t size) {
+    memcpy(dst, src, size);
+}
+
+} // namespace CpuCopy
+} // namespace NEO
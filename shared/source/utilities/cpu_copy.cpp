@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/cpu_copy.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/ptr_math.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <thread>
+
+namespace NEO {
+namespace CpuCopy {
+
+static void cachedCopy(void *dst, const void *src, size_t size) {
+    memcpy(dst, src, size);
+}
+
+CopyThreadPool::~CopyThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        stopWorkers = true;
+    }
+    workCondition.notify_all();
+    for (auto &worker : workers) {
+        worker.join();
+    }
+}
+
+void CopyThreadPool::copy(CopyFunction copyFunc, void *dst, const void *src, size_t size, size_t chunkSize, size_t threadCount) {
+    size_t chunksRemaining = 0;
+
+    std::unique_lock<std::mutex> lock(mtx);
+    while (workers.size() < threadCount - 1) {
+        workers.emplace_back(&CopyThreadPool::workerLoop, this);
+    }
+    for (size_t offset = chunkSize; offset < size; offset += chunkSize) {
+        tasks.push_back({copyFunc, ptrOffset(dst, offset), ptrOffset(src, offset), std::min(chunkSize, size - offset), &chunksRemaining});
+        chunksRemaining++;
+    }
+    lock.unlock();
+    workCondition.notify_all();
+
+    copyFunc(dst, src, std::min(chunkSize, size));
+
+    // workers may be busy with other copies, so chunks of this copy still queued are taken by the caller
+    lock.lock();
+    while (chunksRemaining != 0) {
+        auto task = std::find_if(tasks.begin(), tasks.end(), [&chunksRemaining](const CopyTask &task) { return task.chunksRemaining == &chunksRemaining; });
+        if (task == tasks.end()) {
+            doneCondition.wait(lock, [&chunksRemaining] { return chunksRemaining == 0; });
+            break;
+        }
+        auto ownTask = *task;
+        tasks.erase(task);
+        lock.unlock();
+
+        ownTask.copyFunc(ownTask.dst, ownTask.src, ownTask.size);
+
+        lock.lock();
+        chunksRemaining--;
+    }
+}
+
+void CopyThreadPool::workerLoop() {
+    std::unique_lock<std::mutex> lock(mtx);
+    while (true) {
+        workCondition.wait(lock, [this] { return stopWorkers || !tasks.empty(); });
+        if (tasks.empty()) {
+            return;
+        }
+        auto task = tasks.front();
+        tasks.pop_front();
+        lock.unlock();
+
+        task.copyFunc(task.dst, task.src, task.size);
+
+        lock.lock();
+        if (--(*task.chunksRemaining) == 0) {
+            doneCondition.notify_all();
+        }
+    }
+}
+
+bool isStreamingCopyPreferred(size_t size, bool writeCombinedDestination) {
+    if (DebugManager.flags.ExperimentalCpuCopyStreaming.get() != -1) {
+        return !!DebugManager.flags.ExperimentalCpuCopyStreaming.get();
+    }
+    return writeCombinedDestination && size >= streamingCopyMinSize;
+}
+
+size_t getThreadCountForCopy(size_t size) {
+    size_t maxThreads = parallelCopyMaxThreads;
+    if (DebugManager.flags.CpuCopyThreadCount.get() != -1) {
+        maxThreads = static_cast<size_t>(DebugManager.flags.CpuCopyThreadCount.get());
+    } else {
+        maxThreads = std::min(maxThreads, static_cast<size_t>(std::thread::hardware_concurrency()));
+    }
+
+    if (maxThreads <= 1 || size < parallelCopyMinSize) {
+        return 1;
+    }
+    return std::min(maxThreads, size / (parallelCopyMinSize / parallelCopyMaxThreads));
+}
+
+int copy(void *dst, size_t destSize, const void *src, size_t size, bool writeCombinedDestination, CopyThreadPool *threadPool) {
+    if ((dst == nullptr) || (src == nullptr)) {
+        return -EINVAL;
+    }
+    if (destSize < size) {
+        return -ERANGE;
+    }
+
+    auto copyFunc = isStreamingCopyPreferred(size, writeCombinedDestination) ? streamingCopy : cachedCopy;
+
+    auto threadCount = threadPool ? getThreadCountForCopy(size) : 1u;
+    if (threadCount == 1) {
+        copyFunc(dst, src, size);
+        return 0;
+    }
+
+    auto chunkSize = alignUp(Math::divideAndRoundUp(size, threadCount), MemoryConstants::cacheLineSize);
+    threadPool->copy(copyFunc, dst, src, size, chunkSize, threadCount);
+    return 0;
+}
+
+} // namespace CpuCopy
+} // namespace NEO
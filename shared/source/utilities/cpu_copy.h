@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace NEO {
+namespace CpuCopy {
+inline constexpr size_t streamingCopyMinSize = 4 * MemoryConstants::kiloByte;
+inline constexpr size_t parallelCopyMinSize = 16 * MemoryConstants::megaByte;
+inline constexpr size_t parallelCopyMaxThreads = 4;
+
+using CopyFunction = void (*)(void *dst, const void *src, size_t size);
+
+// Workers are created on the first parallel copy needing them and are reused by all later copies.
+// The pool is owned by the execution environment, its workers are joined when the environment is destroyed.
+class CopyThreadPool : NonCopyableOrMovableClass {
+  public:
+    ~CopyThreadPool();
+
+    void copy(CopyFunction copyFunc, void *dst, const void *src, size_t size, size_t chunkSize, size_t threadCount);
+
+  protected:
+    struct CopyTask {
+        CopyFunction copyFunc;
+        void *dst;
+        const void *src;
+        size_t size;
+        size_t *chunksRemaining;
+    };
+
+    void workerLoop();
+
+    std::vector<std::thread> workers;
+    std::deque<CopyTask> tasks;
+    std::mutex mtx;
+    std::condition_variable workCondition;
+    std::condition_variable doneCondition;
+    bool stopWorkers = false;
+};
+
+// Same contract as memcpy_s.
+// Destinations mapped as write-combined (e.g. locked local memory) are written with non-temporal stores,
+// copies above parallelCopyMinSize are split across threads of threadPool, copies without a pool stay on the calling thread.
+int copy(void *dst, size_t destSize, const void *src, size_t size, bool writeCombinedDestination, CopyThreadPool *threadPool);
+
+size_t getThreadCountForCopy(size_t size);
+bool isStreamingCopyPreferred(size_t size, bool writeCombinedDestination);
+
+// Architecture specific, falls back to memcpy when non-temporal stores are not available.
+void streamingCopy(void *dst, const void *src, size_t size);
+} // namespace CpuCopy
+} // namespace NEO
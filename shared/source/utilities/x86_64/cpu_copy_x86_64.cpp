@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/utilities/cpu_copy.h"
+
+#include <algorithm>
+#include <cstring>
+#include <emmintrin.h>
+
+namespace NEO {
+namespace CpuCopy {
+
+void streamingCopy(void *dst, const void *src, size_t size) {
+    auto dstBytes = static_cast<uint8_t *>(dst);
+    auto srcBytes = static_cast<const uint8_t *>(src);
+
+    auto headSize = std::min(size, ptrDiff(alignUp(dstBytes, sizeof(__m128i)), dstBytes));
+    memcpy(dstBytes, srcBytes, headSize);
+    dstBytes += headSize;
+    srcBytes += headSize;
+    size -= headSize;
+
+    // 4 x 16B stores fill a whole cache line, so WC buffers are flushed as full lines
+    constexpr size_t bytesPerIteration = 4 * sizeof(__m128i);
+    auto dstVector = reinterpret_cast<__m128i *>(dstBytes);
+    auto srcVector = reinterpret_cast<const __m128i *>(srcBytes);
+    for (size_t i = 0; i < size / bytesPerIteration; i++) {
+        auto v0 = _mm_loadu_si128(srcVector);
+        auto v1 = _mm_loadu_si128(srcVector + 1);
+        auto v2 = _mm_loadu_si128(srcVector + 2);
+        auto v3 = _mm_loadu_si128(srcVector + 3);
+        _mm_stream_si128(dstVector, v0);
+        _mm_stream_si128(dstVector + 1, v1);
+        _mm_stream_si128(dstVector + 2, v2);
+        _mm_stream_si128(dstVector + 3, v3);
+        dstVector += 4;
+        srcVector += 4;
+    }
+    _mm_sfence();
+
+    auto copiedSize = alignDown(size, bytesPerIteration);
+    memcpy(dstBytes + copiedSize, srcBytes + copiedSize, size - copiedSize);
+}
+
+} // namespace CpuCopy
+} // namespace NEO
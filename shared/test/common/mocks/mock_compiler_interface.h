@@ -23,6 +23,7 @@ class MockCompilerInterface : public CompilerInterface {
   public:
     using CompilerInterface::fclBaseTranslationCtx;
     using CompilerInterface::fclDeviceContexts;
+    using CompilerInterface::frontendIrCache;
     using CompilerInterface::initialize;
     using CompilerInterface::isCompilerAvailable;
     using CompilerInterface::isFclAvailable;
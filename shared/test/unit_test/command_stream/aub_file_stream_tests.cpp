@@ -1004,3 +1004,69 @@ HWTEST_F(AubFileStreamTests, givenAubCommandStreamReceiverWithAubManagerWhenInit
 
     EXPECT_EQ(expectedAddedComments, mockAubManager->receivedComments);
 }
+
+TEST(AubFileStreamBufferedWriterTests, givenAubDumpWriteBufferSizeSetWhenWritingToStreamThenDataIsStoredInFileInOrder) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.AubDumpWriteBufferSizeInKb.set(1);
+
+    std::vector<char> data(10 * MemoryConstants::kiloByte);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = static_cast<char>(i * 7);
+    }
+
+    const char *fileName = "buffered_writer_test.aub";
+    AubMemDump::AubFileStream stream;
+    stream.open(fileName);
+    ASSERT_TRUE(stream.isOpen());
+    EXPECT_TRUE(stream.isBufferedWriterActive());
+
+    const size_t chunkSizes[] = {3, 100, 1000, 2 * MemoryConstants::kiloByte, 17};
+    size_t offset = 0;
+    for (uint32_t i = 0; offset < data.size(); i++) {
+        auto chunkSize = std::min(chunkSizes[i % 5], data.size() - offset);
+        stream.write(data.data() + offset, chunkSize);
+        offset += chunkSize;
+    }
+    stream.close();
+    EXPECT_FALSE(stream.isBufferedWriterActive());
+
+    std::ifstream file(fileName, std::ios::binary);
+    std::vector<char> fileContents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    file.close();
+    std::remove(fileName);
+
+    EXPECT_EQ(data, fileContents);
+}
+
+TEST(AubFileStreamBufferedWriterTests, givenDefaultSettingsWhenOpeningStreamThenBufferedWriterIsNotActive) {
+    const char *fileName = "unbuffered_writer_test.aub";
+    AubMemDump::AubFileStream stream;
+    stream.open(fileName);
+    EXPECT_FALSE(stream.isBufferedWriterActive());
+    stream.close();
+    std::remove(fileName);
+}
+
+TEST(AubFileStreamBufferedWriterTests, givenBufferedWriterWhenRegisterPollIsWrittenThenAllPrecedingDataIsStoredInFile) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.AubDumpWriteBufferSizeInKb.set(1);
+
+    const char *fileName = "buffered_writer_poll_test.aub";
+    AubMemDump::AubFileStream stream;
+    stream.open(fileName);
+    ASSERT_TRUE(stream.isBufferedWriterActive());
+
+    std::vector<char> data(100, 1);
+    stream.write(data.data(), data.size());
+    stream.flush();
+    stream.registerPoll(0x2234, 0x1, 0x1, false, AubMemDump::CmdServicesMemTraceRegisterPoll::TimeoutActionValues::Abort);
+
+    std::ifstream file(fileName, std::ios::binary | std::ios::ate);
+    auto fileSize = static_cast<size_t>(file.tellg());
+    file.close();
+
+    EXPECT_EQ(data.size() + sizeof(AubMemDump::CmdServicesMemTraceRegisterPoll), fileSize);
+
+    stream.close();
+    std::remove(fileName);
+}
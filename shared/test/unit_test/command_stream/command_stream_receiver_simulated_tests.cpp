@@ -595,3 +595,87 @@ HWTEST_F(CommandStreamSimulatedTests, givenSpecificMemoryPoolAllocationWhenWrite
         }
     }
 }
+
+HWTEST_F(CommandStreamSimulatedTests, givenPagesWrittenBeforeWhenWritingChangedPagesThenOnlyModifiedPagesAreWritten) {
+    auto csr = std::make_unique<MockSimulatedCsrHw<FamilyType>>(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+
+    constexpr size_t pageSize = MemoryConstants::pageSize;
+    std::vector<uint8_t> memory(4 * pageSize + 16, 0u);
+    WrittenPagesInfo writtenPages;
+    std::vector<std::pair<size_t, size_t>> writtenRanges;
+    auto writeRange = [&](size_t offset, size_t size) { writtenRanges.push_back({offset, size}); };
+
+    csr->writeChangedPages(writtenPages, 1u, memory.data(), memory.size(), pageSize, writeRange);
+    ASSERT_EQ(1u, writtenRanges.size());
+    EXPECT_EQ(0u, writtenRanges[0].first);
+    EXPECT_EQ(memory.size(), writtenRanges[0].second);
+    EXPECT_EQ(5u, writtenPages.pageHashes.size());
+
+    writtenRanges.clear();
+    csr->writeChangedPages(writtenPages, 1u, memory.data(), memory.size(), pageSize, writeRange);
+    EXPECT_TRUE(writtenRanges.empty());
+    EXPECT_EQ(memory.size(), csr->memoryWriteBytesSkipped);
+
+    memory[pageSize + 1] = 1u;
+    memory[2 * pageSize] = 1u;
+    memory[4 * pageSize] = 1u;
+    csr->writeChangedPages(writtenPages, 1u, memory.data(), memory.size(), pageSize, writeRange);
+    ASSERT_EQ(2u, writtenRanges.size());
+    EXPECT_EQ(pageSize, writtenRanges[0].first);
+    EXPECT_EQ(2 * pageSize, writtenRanges[0].second);
+    EXPECT_EQ(4 * pageSize, writtenRanges[1].first);
+    EXPECT_EQ(16u, writtenRanges[1].second);
+
+    writtenRanges.clear();
+    csr->writeChangedPages(writtenPages, 2u, memory.data(), memory.size(), pageSize, writeRange);
+    ASSERT_EQ(1u, writtenRanges.size());
+    EXPECT_EQ(memory.size(), writtenRanges[0].second);
+}
+
+HWTEST_F(CommandStreamSimulatedTests, givenMatchingPageHashAndDifferentWrittenContentsWhenWritingChangedPagesThenPageIsWritten) {
+    auto csr = std::make_unique<MockSimulatedCsrHw<FamilyType>>(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+
+    constexpr size_t pageSize = MemoryConstants::pageSize;
+    std::vector<uint8_t> memory(2 * pageSize, 0u);
+    WrittenPagesInfo writtenPages;
+    std::vector<std::pair<size_t, size_t>> writtenRanges;
+    auto writeRange = [&](size_t offset, size_t size) { writtenRanges.push_back({offset, size}); };
+
+    csr->writeChangedPages(writtenPages, 1u, memory.data(), memory.size(), pageSize, writeRange);
+    ASSERT_EQ(memory.size(), writtenPages.writtenContents.size());
+
+    writtenRanges.clear();
+    writtenPages.writtenContents[pageSize] = 1u;
+    csr->writeChangedPages(writtenPages, 1u, memory.data(), memory.size(), pageSize, writeRange);
+    ASSERT_EQ(1u, writtenRanges.size());
+    EXPECT_EQ(pageSize, writtenRanges[0].first);
+    EXPECT_EQ(pageSize, writtenRanges[0].second);
+    EXPECT_EQ(0u, writtenPages.writtenContents[pageSize]);
+}
+
+HWTEST_F(CommandStreamSimulatedTests, givenSimulatedMemoryWriteDeduplicationFlagWhenCheckingIfDeduplicationIsAllowedThenFlagAndAllocationAreRespected) {
+    DebugManagerStateRestore restorer;
+    auto csr = std::make_unique<MockSimulatedCsrHw<FamilyType>>(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+
+    int dummy = 1;
+    GraphicsAllocation graphicsAllocation{0, AllocationType::KERNEL_ISA,
+                                          &dummy, 0, 0, sizeof(dummy), MemoryPool::MemoryNull, MemoryManager::maxOsContextCount};
+
+    EXPECT_FALSE(csr->isMemoryWriteDeduplicationAllowed(graphicsAllocation, &dummy));
+
+    DebugManager.flags.SimulatedMemoryWriteDeduplication.set(1);
+    EXPECT_TRUE(csr->isMemoryWriteDeduplicationAllowed(graphicsAllocation, &dummy));
+    EXPECT_FALSE(csr->isMemoryWriteDeduplicationAllowed(graphicsAllocation, nullptr));
+
+    graphicsAllocation.setAllocationType(AllocationType::CONSTANT_SURFACE);
+    EXPECT_TRUE(csr->isMemoryWriteDeduplicationAllowed(graphicsAllocation, &dummy));
+
+    graphicsAllocation.setAllocationType(AllocationType::BUFFER);
+    EXPECT_FALSE(csr->isMemoryWriteDeduplicationAllowed(graphicsAllocation, &dummy));
+
+    graphicsAllocation.setAllocationType(AllocationType::IMAGE);
+    EXPECT_FALSE(csr->isMemoryWriteDeduplicationAllowed(graphicsAllocation, &dummy));
+
+    graphicsAllocation.setAllocationType(AllocationType::GLOBAL_SURFACE);
+    EXPECT_FALSE(csr->isMemoryWriteDeduplicationAllowed(graphicsAllocation, &dummy));
+}
@@ -218,6 +218,78 @@ TEST_F(CompilerInterfaceTest, WhenCompilingToIrThenSuccessIsReturned) {
     gEnvironment->fclPopDebugVars();
 }
 
+TEST_F(CompilerInterfaceTest, GivenSourceAlreadyTranslatedByFrontendWhenBuildingAgainThenCachedIntermediateRepresentationIsUsed) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ExperimentalEnableFrontendIrCache.set(1);
+
+    TranslationOutput firstOutput = {};
+    auto err = pCompilerInterface->build(*pDevice, inputArgs, firstOutput);
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, err);
+    EXPECT_EQ(1u, pCompilerInterface->frontendIrCache.size());
+
+    pCompilerInterface->failCreateFclTranslationCtx = true;
+    TranslationOutput secondOutput = {};
+    err = pCompilerInterface->build(*pDevice, inputArgs, secondOutput);
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, err);
+
+    ASSERT_EQ(firstOutput.intermediateRepresentation.size, secondOutput.intermediateRepresentation.size);
+    EXPECT_EQ(0, memcmp(firstOutput.intermediateRepresentation.mem.get(), secondOutput.intermediateRepresentation.mem.get(), firstOutput.intermediateRepresentation.size));
+    EXPECT_EQ(firstOutput.intermediateCodeType, secondOutput.intermediateCodeType);
+    EXPECT_EQ(firstOutput.frontendCompilerLog, secondOutput.frontendCompilerLog);
+}
+
+TEST_F(CompilerInterfaceTest, GivenDifferentOptionsWhenBuildingThenFrontendIsInvokedAgain) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ExperimentalEnableFrontendIrCache.set(1);
+
+    TranslationOutput translationOutput = {};
+    auto err = pCompilerInterface->build(*pDevice, inputArgs, translationOutput);
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, err);
+
+    std::string apiOptions = "-cl-opt-disable";
+    inputArgs.apiOptions = ArrayRef<const char>(apiOptions.c_str(), apiOptions.length());
+    pCompilerInterface->failCreateFclTranslationCtx = true;
+    err = pCompilerInterface->build(*pDevice, inputArgs, translationOutput);
+    EXPECT_EQ(TranslationOutput::ErrorCode::UnknownError, err);
+    EXPECT_EQ(1u, pCompilerInterface->frontendIrCache.size());
+}
+
+TEST_F(CompilerInterfaceTest, GivenCachedEntryWithSameKeyButDifferentSourceWhenBuildingThenFrontendIsInvokedAgain) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ExperimentalEnableFrontendIrCache.set(1);
+
+    TranslationOutput translationOutput = {};
+    auto err = pCompilerInterface->build(*pDevice, inputArgs, translationOutput);
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, err);
+    ASSERT_EQ(1u, pCompilerInterface->frontendIrCache.size());
+
+    pCompilerInterface->frontendIrCache.begin()->second.source = "different source";
+    pCompilerInterface->failCreateFclTranslationCtx = true;
+    err = pCompilerInterface->build(*pDevice, inputArgs, translationOutput);
+    EXPECT_EQ(TranslationOutput::ErrorCode::UnknownError, err);
+}
+
+TEST_F(CompilerInterfaceTest, GivenDefaultSettingsWhenBuildingThenFrontendIrIsNotCached) {
+    TranslationOutput translationOutput = {};
+    auto err = pCompilerInterface->build(*pDevice, inputArgs, translationOutput);
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, err);
+    EXPECT_TRUE(pCompilerInterface->frontendIrCache.empty());
+}
+
+TEST_F(CompilerInterfaceTest, GivenFrontendIrCacheDisabledWhenBuildingAgainThenFrontendIsInvoked) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ExperimentalEnableFrontendIrCache.set(0);
+
+    TranslationOutput translationOutput = {};
+    auto err = pCompilerInterface->build(*pDevice, inputArgs, translationOutput);
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, err);
+    EXPECT_TRUE(pCompilerInterface->frontendIrCache.empty());
+
+    pCompilerInterface->failCreateFclTranslationCtx = true;
+    err = pCompilerInterface->build(*pDevice, inputArgs, translationOutput);
+    EXPECT_EQ(TranslationOutput::ErrorCode::UnknownError, err);
+}
+
 TEST_F(CompilerInterfaceTest, GivenProgramCreatedFromIrWhenCompileIsCalledThenDontRecompile) {
     TranslationOutput translationOutput = {};
     inputArgs.srcType = IGC::CodeType::spirV;
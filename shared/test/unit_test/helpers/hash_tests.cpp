@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2022 Intel Corporation
+ * Copyright (C) 2018-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -34,3 +34,18 @@ TEST(HashTests, givenDifferentPointersWhenHashIsCalculatedThenUnique32BitValuesA
 
     EXPECT_NE(hash1, hash2);
 }
+
+TEST(HashTests, givenMemoryContentsWhenHashIsCalculatedThenEqualContentsGiveEqualHashesAndAnyChangedByteChangesHash) {
+    uint8_t data1[100] = {};
+    uint8_t data2[100] = {};
+
+    EXPECT_EQ(hashMemoryContents(data1, sizeof(data1)), hashMemoryContents(data2, sizeof(data2)));
+    EXPECT_NE(hashMemoryContents(data1, sizeof(data1)), hashMemoryContents(data1, sizeof(data1) - 1));
+
+    auto initialHash = hashMemoryContents(data1, sizeof(data1));
+    for (size_t i = 0; i < sizeof(data2); i++) {
+        data2[i] = 1;
+        EXPECT_NE(initialHash, hashMemoryContents(data2, sizeof(data2)));
+        data2[i] = 0;
+    }
+}
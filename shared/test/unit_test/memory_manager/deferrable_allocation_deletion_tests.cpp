@@ -7,6 +7,7 @@
 
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/device/device.h"
+#include "shared/source/memory_manager/allocations_release_queue.h"
 #include "shared/source/memory_manager/deferrable_allocation_deletion.h"
 #include "shared/source/memory_manager/deferred_deleter.h"
 #include "shared/source/os_interface/os_context.h"
@@ -256,3 +257,126 @@ HWTEST_F(DeferrableAllocationDeletionTest, givenMultiTileWhenTaskCompletedOnSing
     EXPECT_TRUE(deletion.apply());
     EXPECT_EQ(1u, memoryManager->freeGraphicsMemoryCalled);
 }
+
+HWTEST_F(DeferrableAllocationDeletionTest, givenAllocationsReleasedWithSameTaskCountWhenTagPassesThenWholeGroupIsFreed) {
+    auto &commandStreamReceiver = device->getUltCommandStreamReceiver<FamilyType>();
+    commandStreamReceiver.setLatestFlushedTaskCount(2u);
+    *hwTag = 0u;
+
+    GraphicsAllocation *allocations[4] = {};
+    for (auto &allocation : allocations) {
+        allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+    }
+    allocations[0]->updateTaskCount(1u, defaultOsContextId);
+    allocations[1]->updateTaskCount(1u, defaultOsContextId);
+    allocations[2]->updateTaskCount(2u, defaultOsContextId);
+    allocations[3]->updateTaskCount(2u, defaultOsContextId);
+
+    {
+        AllocationsReleaseQueue releaseQueue(*memoryManager, 10 * MemoryConstants::pageSize);
+        EXPECT_TRUE(releaseQueue.deferRelease(*allocations[0]));
+        EXPECT_TRUE(releaseQueue.deferRelease(*allocations[1]));
+        EXPECT_TRUE(releaseQueue.deferRelease(*allocations[2]));
+        EXPECT_EQ(0u, memoryManager->freeGraphicsMemoryCalled);
+        EXPECT_EQ(3 * MemoryConstants::pageSize, releaseQueue.getPendingSize());
+
+        *hwTag = 1u;
+        EXPECT_TRUE(releaseQueue.deferRelease(*allocations[3]));
+        EXPECT_EQ(2u, memoryManager->freeGraphicsMemoryCalled);
+        EXPECT_EQ(2 * MemoryConstants::pageSize, releaseQueue.getPendingSize());
+
+        *hwTag = 2u;
+    }
+    EXPECT_EQ(4u, memoryManager->freeGraphicsMemoryCalled);
+}
+
+TEST_F(DeferrableAllocationDeletionTest, givenUnusedAllocationWhenDeferringReleaseThenAllocationIsNotQueued) {
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+
+    AllocationsReleaseQueue releaseQueue(*memoryManager, MemoryConstants::pageSize);
+    EXPECT_FALSE(releaseQueue.deferRelease(*allocation));
+    EXPECT_EQ(0u, releaseQueue.getPendingSize());
+
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
+TEST_F(DeferrableAllocationDeletionTest, givenPendingSizeAboveLimitWhenDeferringReleaseThenPendingAllocationsAreFreed) {
+    *hwTag = 0u;
+    auto allocation0 = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+    auto allocation1 = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+    allocation0->updateTaskCount(1u, defaultOsContextId);
+    allocation1->updateTaskCount(1u, defaultOsContextId);
+
+    AllocationsReleaseQueue releaseQueue(*memoryManager, MemoryConstants::pageSize);
+    EXPECT_TRUE(releaseQueue.deferRelease(*allocation0));
+    EXPECT_EQ(0u, memoryManager->freeGraphicsMemoryCalled);
+
+    *hwTag = 1u;
+    EXPECT_TRUE(releaseQueue.deferRelease(*allocation1));
+    EXPECT_EQ(2u, memoryManager->freeGraphicsMemoryCalled);
+    EXPECT_EQ(0u, releaseQueue.getPendingSize());
+}
+
+TEST_F(DeferrableAllocationDeletionTest, givenCompletedTaskCountWhenDeferringReleaseThenAllocationIsFreedWithoutWaitingForNextRelease) {
+    *hwTag = 1u;
+    auto allocation0 = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+    auto allocation1 = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+    allocation0->updateTaskCount(1u, defaultOsContextId);
+    allocation1->updateTaskCount(1u, defaultOsContextId);
+
+    AllocationsReleaseQueue releaseQueue(*memoryManager, 10 * MemoryConstants::pageSize);
+    EXPECT_TRUE(releaseQueue.deferRelease(*allocation0));
+    EXPECT_EQ(1u, memoryManager->freeGraphicsMemoryCalled);
+
+    EXPECT_TRUE(releaseQueue.deferRelease(*allocation1));
+    EXPECT_EQ(2u, memoryManager->freeGraphicsMemoryCalled);
+    EXPECT_EQ(0u, releaseQueue.getPendingSize());
+}
+
+TEST_F(DeferrableAllocationDeletionTest, givenPendingReleasesWhenDrainingReleaseQueuesThroughMemoryManagerThenPendingAllocationsAreFreed) {
+    *hwTag = 0u;
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+    allocation->updateTaskCount(1u, defaultOsContextId);
+
+    AllocationsReleaseQueue releaseQueue(*memoryManager, 10 * MemoryConstants::pageSize);
+    EXPECT_FALSE(memoryManager->drainAllocationsReleaseQueues());
+
+    EXPECT_TRUE(releaseQueue.deferRelease(*allocation));
+    EXPECT_EQ(0u, memoryManager->freeGraphicsMemoryCalled);
+
+    *hwTag = 1u;
+    EXPECT_TRUE(memoryManager->drainAllocationsReleaseQueues());
+    EXPECT_EQ(1u, memoryManager->freeGraphicsMemoryCalled);
+    EXPECT_EQ(0u, releaseQueue.getPendingSize());
+    EXPECT_FALSE(memoryManager->drainAllocationsReleaseQueues());
+}
+
+HWTEST_F(DeferrableAllocationDeletionTest, givenAllocationUsedByManyOsContextsWhenDeferringReleaseThenAllocationIsNotQueued) {
+    auto &nonDefaultCommandStreamReceiver = static_cast<UltCommandStreamReceiver<FamilyType> &>(*device->commandStreamReceivers[1]);
+    auto nonDefaultOsContextId = nonDefaultCommandStreamReceiver.getOsContext().getContextId();
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+    allocation->updateTaskCount(1u, defaultOsContextId);
+    allocation->updateTaskCount(1u, nonDefaultOsContextId);
+    ASSERT_TRUE(allocation->isUsedByManyOsContexts());
+
+    AllocationsReleaseQueue releaseQueue(*memoryManager, MemoryConstants::pageSize);
+    EXPECT_FALSE(releaseQueue.deferRelease(*allocation));
+    EXPECT_EQ(0u, releaseQueue.getPendingSize());
+
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
+TEST_F(DeferrableAllocationDeletionTest, givenIncompleteTaskCountWhenDrainingReleaseQueuesThroughMemoryManagerThenNothingIsFreedAndCallDoesNotWait) {
+    *hwTag = 0u;
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+    allocation->updateTaskCount(1u, defaultOsContextId);
+
+    AllocationsReleaseQueue releaseQueue(*memoryManager, 10 * MemoryConstants::pageSize);
+    EXPECT_TRUE(releaseQueue.deferRelease(*allocation));
+
+    EXPECT_FALSE(memoryManager->drainAllocationsReleaseQueues());
+    EXPECT_EQ(0u, memoryManager->freeGraphicsMemoryCalled);
+    EXPECT_EQ(MemoryConstants::pageSize, releaseQueue.getPendingSize());
+
+    *hwTag = 1u;
+}
@@ -11,6 +11,7 @@
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/test/common/fixtures/memory_manager_fixture.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/engine_descriptor_helper.h"
 #include "shared/test/common/mocks/mock_allocation_properties.h"
 #include "shared/test/common/mocks/mock_csr.h"
@@ -1074,6 +1075,133 @@ TEST_F(HostPtrAllocationTest, GivenAllocationsWithBiggerOverlapWhenChckingForOve
     EXPECT_EQ(RequirementsStatus::SUCCESS, status);
 }
 
+TEST_F(HostPtrAllocationTest, givenFragmentCacheDisabledWhenAllocationIsFreedThenFragmentIsReleased) {
+    void *cpuPtr = reinterpret_cast<void *>(0x100000);
+    auto hostPtrManager = static_cast<MockHostPtrManager *>(memoryManager->getHostPtrManager());
+
+    auto graphicsAllocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), false, MemoryConstants::pageSize, csr->getOsContext().getDeviceBitfield()}, cpuPtr);
+    EXPECT_EQ(1u, hostPtrManager->getFragmentCount());
+    memoryManager->freeGraphicsMemory(graphicsAllocation);
+
+    EXPECT_EQ(0u, hostPtrManager->getFragmentCount());
+    EXPECT_TRUE(hostPtrManager->cachedFragments.empty());
+}
+
+TEST_F(HostPtrAllocationTest, givenFragmentCacheEnabledWhenAllocationIsFreedAndHostPtrIsWrappedAgainThenCachedFragmentIsReused) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ExperimentalHostPtrFragmentCacheSize.set(4 * MemoryConstants::pageSize);
+
+    void *cpuPtr = reinterpret_cast<void *>(0x100000);
+    auto hostPtrManager = static_cast<MockHostPtrManager *>(memoryManager->getHostPtrManager());
+
+    auto graphicsAllocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), false, MemoryConstants::pageSize, csr->getOsContext().getDeviceBitfield()}, cpuPtr);
+    auto osHandle = graphicsAllocation->fragmentsStorage.fragmentStorageData[0].osHandleStorage;
+    memoryManager->freeGraphicsMemory(graphicsAllocation);
+
+    EXPECT_EQ(1u, hostPtrManager->getFragmentCount());
+    EXPECT_EQ(1u, hostPtrManager->cachedFragments.size());
+    EXPECT_EQ(MemoryConstants::pageSize, hostPtrManager->cachedFragmentsSize);
+
+    graphicsAllocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), false, MemoryConstants::pageSize, csr->getOsContext().getDeviceBitfield()}, cpuPtr);
+    EXPECT_EQ(osHandle, graphicsAllocation->fragmentsStorage.fragmentStorageData[0].osHandleStorage);
+    EXPECT_EQ(1u, hostPtrManager->getFragmentCount());
+    EXPECT_TRUE(hostPtrManager->cachedFragments.empty());
+    EXPECT_EQ(0u, hostPtrManager->cachedFragmentsSize);
+
+    memoryManager->freeGraphicsMemory(graphicsAllocation);
+    hostPtrManager->releaseCachedFragments(*memoryManager);
+    EXPECT_EQ(0u, hostPtrManager->getFragmentCount());
+    EXPECT_TRUE(hostPtrManager->cachedFragments.empty());
+}
+
+TEST_F(HostPtrAllocationTest, givenFragmentCacheEnabledWhenCachedFragmentsExceedCacheSizeThenLeastRecentlyReleasedFragmentIsEvicted) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ExperimentalHostPtrFragmentCacheSize.set(2 * MemoryConstants::pageSize);
+
+    void *cpuPtr1 = reinterpret_cast<void *>(0x100000);
+    void *cpuPtr2 = reinterpret_cast<void *>(0x200000);
+    void *cpuPtr3 = reinterpret_cast<void *>(0x300000);
+    auto hostPtrManager = static_cast<MockHostPtrManager *>(memoryManager->getHostPtrManager());
+
+    for (auto cpuPtr : {cpuPtr1, cpuPtr2, cpuPtr3}) {
+        auto graphicsAllocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), false, MemoryConstants::pageSize, csr->getOsContext().getDeviceBitfield()}, cpuPtr);
+        memoryManager->freeGraphicsMemory(graphicsAllocation);
+    }
+
+    EXPECT_EQ(2u, hostPtrManager->getFragmentCount());
+    EXPECT_EQ(2 * MemoryConstants::pageSize, hostPtrManager->cachedFragmentsSize);
+    EXPECT_EQ(nullptr, hostPtrManager->getFragment({cpuPtr1, csr->getRootDeviceIndex()}));
+    EXPECT_NE(nullptr, hostPtrManager->getFragment({cpuPtr2, csr->getRootDeviceIndex()}));
+    EXPECT_NE(nullptr, hostPtrManager->getFragment({cpuPtr3, csr->getRootDeviceIndex()}));
+
+    auto graphicsAllocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), false, 4 * MemoryConstants::pageSize, csr->getOsContext().getDeviceBitfield()}, cpuPtr1);
+    memoryManager->freeGraphicsMemory(graphicsAllocation);
+    EXPECT_EQ(nullptr, hostPtrManager->getFragment({cpuPtr1, csr->getRootDeviceIndex()}));
+    EXPECT_EQ(2u, hostPtrManager->getFragmentCount());
+}
+
+TEST_F(HostPtrAllocationTest, givenCachedFragmentsWhenReleasingCachedFragmentsForHostMemoryRangeThenOnlyOverlappingFragmentsAreReleased) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ExperimentalHostPtrFragmentCacheSize.set(4 * MemoryConstants::pageSize);
+
+    void *cpuPtr1 = reinterpret_cast<void *>(0x100000);
+    void *cpuPtr2 = reinterpret_cast<void *>(0x200000);
+    auto hostPtrManager = static_cast<MockHostPtrManager *>(memoryManager->getHostPtrManager());
+
+    for (auto cpuPtr : {cpuPtr1, cpuPtr2}) {
+        auto graphicsAllocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), false, MemoryConstants::pageSize, csr->getOsContext().getDeviceBitfield()}, cpuPtr);
+        memoryManager->freeGraphicsMemory(graphicsAllocation);
+    }
+    EXPECT_EQ(2u, hostPtrManager->getFragmentCount());
+
+    hostPtrManager->releaseCachedFragments(*memoryManager, csr->getRootDeviceIndex(), ptrOffset(cpuPtr1, MemoryConstants::pageSize), MemoryConstants::pageSize);
+    EXPECT_EQ(2u, hostPtrManager->getFragmentCount());
+
+    hostPtrManager->releaseCachedFragments(*memoryManager, csr->getRootDeviceIndex(), ptrOffset(cpuPtr2, 1), 1);
+    EXPECT_EQ(1u, hostPtrManager->getFragmentCount());
+    EXPECT_EQ(nullptr, hostPtrManager->getFragment({cpuPtr2, csr->getRootDeviceIndex()}));
+    EXPECT_EQ(MemoryConstants::pageSize, hostPtrManager->cachedFragmentsSize);
+}
+
+TEST_F(HostPtrAllocationTest, givenCachedFragmentWhenHostMemoryRangeIsReleasedForAllRootDevicesThenOverlappingFragmentIsReleased) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ExperimentalHostPtrFragmentCacheSize.set(4 * MemoryConstants::pageSize);
+
+    void *cpuPtr = reinterpret_cast<void *>(0x100000);
+    auto hostPtrManager = static_cast<MockHostPtrManager *>(memoryManager->getHostPtrManager());
+
+    auto graphicsAllocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), false, MemoryConstants::pageSize, csr->getOsContext().getDeviceBitfield()}, cpuPtr);
+    memoryManager->freeGraphicsMemory(graphicsAllocation);
+    EXPECT_EQ(1u, hostPtrManager->cachedFragments.size());
+
+    hostPtrManager->releaseCachedFragments(*memoryManager, cpuPtr, 2 * MemoryConstants::pageSize);
+    EXPECT_EQ(0u, hostPtrManager->getFragmentCount());
+    EXPECT_TRUE(hostPtrManager->cachedFragments.empty());
+    EXPECT_EQ(0u, hostPtrManager->cachedFragmentsSize);
+}
+
+TEST_F(HostPtrAllocationTest, givenCachedFragmentWhenBiggerOverlappingHostPtrIsWrappedThenCachedFragmentIsReleasedAndAllocationSucceeds) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ExperimentalHostPtrFragmentCacheSize.set(4 * MemoryConstants::pageSize);
+
+    void *cpuPtr = reinterpret_cast<void *>(0x100000);
+    auto hostPtrManager = static_cast<MockHostPtrManager *>(memoryManager->getHostPtrManager());
+
+    auto graphicsAllocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), false, MemoryConstants::pageSize, csr->getOsContext().getDeviceBitfield()}, cpuPtr);
+    memoryManager->freeGraphicsMemory(graphicsAllocation);
+    EXPECT_EQ(1u, hostPtrManager->cachedFragments.size());
+
+    graphicsAllocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), false, 2 * MemoryConstants::pageSize, csr->getOsContext().getDeviceBitfield()}, cpuPtr);
+    ASSERT_NE(nullptr, graphicsAllocation);
+    EXPECT_TRUE(hostPtrManager->cachedFragments.empty());
+    EXPECT_EQ(1u, hostPtrManager->getFragmentCount());
+    auto fragment = hostPtrManager->getFragment({cpuPtr, csr->getRootDeviceIndex()});
+    ASSERT_NE(nullptr, fragment);
+    EXPECT_EQ(2 * MemoryConstants::pageSize, fragment->fragmentSize);
+
+    memoryManager->freeGraphicsMemory(graphicsAllocation);
+}
+
 TEST(HostPtrEntryKeyTest, givenTwoHostPtrEntryKeysWhenComparingThemThenKeyWithLowerRootDeviceIndexIsLower) {
 
     auto hostPtr0 = reinterpret_cast<void *>(0x100);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2022 Intel Corporation
+ * Copyright (C) 2021-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -19,6 +19,8 @@ class MockSimulatedCsrHw : public CommandStreamReceiverSimulatedHw<GfxFamily> {
     using CommandStreamReceiverSimulatedHw<GfxFamily>::aubManager;
     using CommandStreamReceiverSimulatedHw<GfxFamily>::hardwareContextController;
     using CommandStreamReceiverSimulatedHw<GfxFamily>::writeMemory;
+    using CommandStreamReceiverSimulatedHw<GfxFamily>::isMemoryWriteDeduplicationAllowed;
+    using CommandStreamReceiverSimulatedHw<GfxFamily>::writeChangedPages;
     void writeMemory(uint64_t gpuAddress, void *cpuAddress, size_t size, uint32_t memoryBank, uint64_t entryBits) override {
     }
     void pollForCompletion() override {
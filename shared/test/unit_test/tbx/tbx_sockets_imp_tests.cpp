@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/constants.h"
+#include "shared/source/tbx/tbx_proto.h"
+#include "shared/source/tbx/tbx_sockets_imp.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <sstream>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+
+struct TbxSocketsImpWithLocalServer : public TbxSocketsImp {
+    using TbxSocketsImp::pendingWrites;
+    using TbxSocketsImp::transID;
+
+    TbxSocketsImpWithLocalServer(std::ostream &err) : TbxSocketsImp(err) {
+        int sockets[2] = {};
+        EXPECT_EQ(0, ::socketpair(AF_UNIX, SOCK_STREAM, 0, sockets));
+        m_socket = sockets[0];
+        serverSocket = sockets[1];
+    }
+
+    ~TbxSocketsImpWithLocalServer() override {
+        close();
+        ::close(serverSocket);
+    }
+
+    std::vector<char> receiveOnServer() {
+        std::vector<char> received;
+        char buffer[MemoryConstants::pageSize];
+        ssize_t bytesReceived = 0;
+        while ((bytesReceived = ::recv(serverSocket, buffer, sizeof(buffer), MSG_DONTWAIT)) > 0) {
+            received.insert(received.end(), buffer, buffer + bytesReceived);
+        }
+        return received;
+    }
+
+    std::vector<uint32_t> getMessageTypes(const std::vector<char> &received) {
+        std::vector<uint32_t> messageTypes;
+        size_t offset = 0;
+        while (offset + sizeof(HAS_HDR) <= received.size()) {
+            HAS_MSG message = {};
+            memcpy(&message, received.data() + offset, std::min(sizeof(message), received.size() - offset));
+            messageTypes.push_back(message.hdr.msg_type);
+            offset += sizeof(HAS_HDR) + message.hdr.size;
+            if (message.hdr.msg_type == HAS_WRITE_DATA_REQ_TYPE) {
+                offset += message.u.write_req.size;
+            }
+        }
+        EXPECT_EQ(received.size(), offset);
+        return messageTypes;
+    }
+
+    void respondToMmioRead(uint32_t value) {
+        HAS_MSG response = {};
+        response.hdr.msg_type = HAS_MMIO_RES_TYPE;
+        response.hdr.trans_id = transID;
+        response.hdr.size = sizeof(HAS_MMIO_RES);
+        response.u.mmio_res.data = value;
+        EXPECT_EQ(static_cast<ssize_t>(sizeof(HAS_HDR) + sizeof(HAS_MMIO_RES)), ::send(serverSocket, &response, sizeof(HAS_HDR) + sizeof(HAS_MMIO_RES), 0));
+    }
+
+    int serverSocket = -1;
+};
+
+} // namespace
+
+TEST(TbxSocketsImpTests, givenWriteBatchingDisabledWhenWritingThenEachRequestIsSentImmediately) {
+    std::stringstream err;
+    TbxSocketsImpWithLocalServer tbxSockets(err);
+
+    EXPECT_TRUE(tbxSockets.writeMMIO(0x100, 1u));
+    EXPECT_TRUE(tbxSockets.writeGTT(0x8, 2u));
+    EXPECT_TRUE(tbxSockets.pendingWrites.empty());
+
+    auto messageTypes = tbxSockets.getMessageTypes(tbxSockets.receiveOnServer());
+    std::vector<uint32_t> expectedMessageTypes = {HAS_MMIO_REQ_TYPE, HAS_GTT_REQ_TYPE};
+    EXPECT_EQ(expectedMessageTypes, messageTypes);
+}
+
+TEST(TbxSocketsImpTests, givenWriteBatchingEnabledWhenWritingThenRequestsAreSentTogetherWithNextRead) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.TbxWriteBatchSizeInKb.set(4);
+
+    std::stringstream err;
+    TbxSocketsImpWithLocalServer tbxSockets(err);
+
+    uint8_t data[64] = {};
+    EXPECT_TRUE(tbxSockets.writeMMIO(0x100, 1u));
+    EXPECT_TRUE(tbxSockets.writeGTT(0x8, 2u));
+    EXPECT_TRUE(tbxSockets.writeMemory(0x1000, data, sizeof(data), 0u));
+    EXPECT_FALSE(tbxSockets.pendingWrites.empty());
+    EXPECT_TRUE(tbxSockets.receiveOnServer().empty());
+
+    tbxSockets.respondToMmioRead(0xabcdu);
+    uint32_t value = 0;
+    EXPECT_TRUE(tbxSockets.readMMIO(0x200, &value));
+    EXPECT_EQ(0xabcdu, value);
+    EXPECT_TRUE(tbxSockets.pendingWrites.empty());
+
+    auto messageTypes = tbxSockets.getMessageTypes(tbxSockets.receiveOnServer());
+    std::vector<uint32_t> expectedMessageTypes = {HAS_MMIO_REQ_TYPE, HAS_GTT_REQ_TYPE, HAS_WRITE_DATA_REQ_TYPE, HAS_MMIO_REQ_TYPE};
+    EXPECT_EQ(expectedMessageTypes, messageTypes);
+}
+
+TEST(TbxSocketsImpTests, givenWriteBatchingEnabledWhenWriteExceedsBatchSizeThenPendingRequestsAndDataAreSentAtOnce) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.TbxWriteBatchSizeInKb.set(1);
+
+    std::stringstream err;
+    TbxSocketsImpWithLocalServer tbxSockets(err);
+
+    std::vector<uint8_t> data(2 * MemoryConstants::kiloByte, 0x5au);
+    EXPECT_TRUE(tbxSockets.writeMMIO(0x100, 1u));
+    EXPECT_TRUE(tbxSockets.writeMemory(0x1000, data.data(), data.size(), 0u));
+    EXPECT_TRUE(tbxSockets.pendingWrites.empty());
+
+    auto received = tbxSockets.receiveOnServer();
+    auto messageTypes = tbxSockets.getMessageTypes(received);
+    std::vector<uint32_t> expectedMessageTypes = {HAS_MMIO_REQ_TYPE, HAS_WRITE_DATA_REQ_TYPE};
+    EXPECT_EQ(expectedMessageTypes, messageTypes);
+    ASSERT_LE(data.size(), received.size());
+    EXPECT_EQ(0, memcmp(data.data(), received.data() + received.size() - data.size(), data.size()));
+
+    EXPECT_TRUE(tbxSockets.writeMMIO(0x100, 1u));
+    tbxSockets.close();
+    messageTypes = tbxSockets.getMessageTypes(tbxSockets.receiveOnServer());
+    expectedMessageTypes = {HAS_MMIO_REQ_TYPE};
+    EXPECT_EQ(expectedMessageTypes, messageTypes);
+}
@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/cpu_copy.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include <cerrno>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+std::vector<uint8_t> createPattern(size_t size) {
+    std::vector<uint8_t> pattern(size);
+    for (size_t i = 0; i < size; i++) {
+        pattern[i] = static_cast<uint8_t>(i % 251);
+    }
+    return pattern;
+}
+} // namespace
+
+TEST(CpuCopyTest, givenNullPointerOrTooSmallDestinationWhenCopyingThenErrorIsReturned) {
+    uint8_t src[8] = {};
+    uint8_t dst[8] = {};
+
+    EXPECT_EQ(-EINVAL, CpuCopy::copy(nullptr, sizeof(dst), src, sizeof(src), false, nullptr));
+    EXPECT_EQ(-EINVAL, CpuCopy::copy(dst, sizeof(dst), nullptr, sizeof(src), false, nullptr));
+    EXPECT_EQ(-ERANGE, CpuCopy::copy(dst, sizeof(dst) - 1, src, sizeof(src), false, nullptr));
+    EXPECT_EQ(0, CpuCopy::copy(dst, sizeof(dst), src, sizeof(src), false, nullptr));
+}
+
+TEST(CpuCopyTest, givenUnalignedPointersAndSizesWhenStreamingCopyIsUsedThenOnlyRequestedRangeIsCopied) {
+    constexpr uint8_t guard = 0xcd;
+    for (size_t dstOffset : {0u, 1u, 15u}) {
+        for (size_t size : {0u, 1u, 63u, 64u, 65u, 4099u}) {
+            auto src = createPattern(size + 3);
+            std::vector<uint8_t> dst(size + dstOffset + 1, guard);
+
+            CpuCopy::streamingCopy(dst.data() + dstOffset, src.data() + 3, size);
+
+            EXPECT_EQ(0, memcmp(dst.data() + dstOffset, src.data() + 3, size));
+            for (size_t i = 0; i < dstOffset; i++) {
+                EXPECT_EQ(guard, dst[i]);
+            }
+            EXPECT_EQ(guard, dst[dstOffset + size]);
+        }
+    }
+}
+
+TEST(CpuCopyTest, givenWriteCombinedDestinationWhenCheckingStreamingCopyThenItIsPreferredOnlyForLargerCopies) {
+    EXPECT_FALSE(CpuCopy::isStreamingCopyPreferred(CpuCopy::streamingCopyMinSize, false));
+    EXPECT_FALSE(CpuCopy::isStreamingCopyPreferred(CpuCopy::streamingCopyMinSize - 1, true));
+    EXPECT_TRUE(CpuCopy::isStreamingCopyPreferred(CpuCopy::streamingCopyMinSize, true));
+}
+
+TEST(CpuCopyTest, givenExperimentalCpuCopyStreamingSetWhenCheckingStreamingCopyThenDebugFlagIsUsed) {
+    DebugManagerStateRestore restorer;
+
+    DebugManager.flags.ExperimentalCpuCopyStreaming.set(1);
+    EXPECT_TRUE(CpuCopy::isStreamingCopyPreferred(1, false));
+
+    DebugManager.flags.ExperimentalCpuCopyStreaming.set(0);
+    EXPECT_FALSE(CpuCopy::isStreamingCopyPreferred(CpuCopy::streamingCopyMinSize, true));
+}
+
+TEST(CpuCopyTest, givenCpuCopyThreadCountSetWhenGettingThreadCountThenSmallCopiesUseSingleThread) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.CpuCopyThreadCount.set(4);
+
+    EXPECT_EQ(1u, CpuCopy::getThreadCountForCopy(CpuCopy::parallelCopyMinSize - 1));
+    EXPECT_EQ(4u, CpuCopy::getThreadCountForCopy(CpuCopy::parallelCopyMinSize));
+
+    DebugManager.flags.CpuCopyThreadCount.set(1);
+    EXPECT_EQ(1u, CpuCopy::getThreadCountForCopy(4 * CpuCopy::parallelCopyMinSize));
+
+    DebugManager.flags.CpuCopyThreadCount.set(8);
+    EXPECT_EQ(4u, CpuCopy::getThreadCountForCopy(CpuCopy::parallelCopyMinSize));
+    EXPECT_EQ(8u, CpuCopy::getThreadCountForCopy(2 * CpuCopy::parallelCopyMinSize));
+}
+
+TEST(CpuCopyTest, givenLargeCopyWhenCopyingWithMultipleThreadsThenWholeRangeIsCopied) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.CpuCopyThreadCount.set(3);
+    CpuCopy::CopyThreadPool threadPool;
+
+    auto size = CpuCopy::parallelCopyMinSize + 17;
+    auto src = createPattern(size);
+    std::vector<uint8_t> dst(size, 0);
+
+    for (bool writeCombined : {false, true}) {
+        std::fill(dst.begin(), dst.end(), 0);
+        EXPECT_EQ(0, CpuCopy::copy(dst.data(), dst.size(), src.data(), size, writeCombined, &threadPool));
+        EXPECT_EQ(0, memcmp(dst.data(), src.data(), size));
+    }
+}
+
+TEST(CpuCopyTest, givenLargeCopiesFromMultipleThreadsWhenCopyingWithMultipleThreadsThenEachRangeIsCopied) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.CpuCopyThreadCount.set(4);
+    CpuCopy::CopyThreadPool threadPool;
+
+    auto size = CpuCopy::parallelCopyMinSize + 17;
+    auto src = createPattern(size);
+    std::vector<uint8_t> dst0(size, 0);
+    std::vector<uint8_t> dst1(size, 0);
+
+    std::thread copyThread([&] {
+        EXPECT_EQ(0, CpuCopy::copy(dst1.data(), dst1.size(), src.data(), size, false, &threadPool));
+    });
+    EXPECT_EQ(0, CpuCopy::copy(dst0.data(), dst0.size(), src.data(), size, false, &threadPool));
+    copyThread.join();
+
+    EXPECT_EQ(0, memcmp(dst0.data(), src.data(), size));
+    EXPECT_EQ(0, memcmp(dst1.data(), src.data(), size));
+}
+
+TEST(CpuCopyTest, givenNoThreadPoolWhenCopyingLargeRangeThenItIsCopiedOnCallingThread) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.CpuCopyThreadCount.set(4);
+
+    auto size = CpuCopy::parallelCopyMinSize + 17;
+    auto src = createPattern(size);
+    std::vector<uint8_t> dst(size, 0);
+
+    EXPECT_EQ(0, CpuCopy::copy(dst.data(), dst.size(), src.data(), size, false, nullptr));
+    EXPECT_EQ(0, memcmp(dst.data(), src.data(), size));
+}